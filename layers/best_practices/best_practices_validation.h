@@ -22,6 +22,7 @@
 #include "generated/chassis.h"
 #include "state_tracker/state_tracker.h"
 #include "state_tracker/cmd_buffer_state.h"
+#include "utils/index_buffer_scan.h"
 #include <string>
 #include <deque>
 #include <chrono>
@@ -170,7 +171,6 @@ enum class ZcullDirection {
 namespace bp_state {
 class PhysicalDevice;
 class CommandBuffer;
-class Swapchain;
 class Image;
 class DescriptorPool;
 class Pipeline;
@@ -178,7 +178,6 @@ class Pipeline;
 
 VALSTATETRACK_DERIVED_STATE_OBJECT(VkPhysicalDevice, bp_state::PhysicalDevice, vvl::PhysicalDevice)
 VALSTATETRACK_DERIVED_STATE_OBJECT(VkCommandBuffer, bp_state::CommandBuffer, vvl::CommandBuffer)
-VALSTATETRACK_DERIVED_STATE_OBJECT(VkSwapchainKHR, bp_state::Swapchain, vvl::Swapchain)
 VALSTATETRACK_DERIVED_STATE_OBJECT(VkImage, bp_state::Image, vvl::Image)
 VALSTATETRACK_DERIVED_STATE_OBJECT(VkDescriptorPool, bp_state::DescriptorPool, vvl::DescriptorPool)
 VALSTATETRACK_DERIVED_STATE_OBJECT(VkPipeline, bp_state::Pipeline, vvl::Pipeline)
@@ -283,6 +282,9 @@ class BestPractices : public ValidationStateTracker {
                                                VkCommandBuffer* pCommandBuffers, const ErrorObject& error_obj) const override;
     void PreCallRecordFreeMemory(VkDevice device, VkDeviceMemory memory, const VkAllocationCallbacks* pAllocator,
                                  const RecordObject& record_obj) override;
+    void PreCallRecordUnmapMemory(VkDevice device, VkDeviceMemory memory, const RecordObject& record_obj) override;
+    void PreCallRecordUnmapMemory2KHR(VkDevice device, const VkMemoryUnmapInfoKHR* pMemoryUnmapInfo,
+                                      const RecordObject& record_obj) override;
     bool PreCallValidateFreeMemory(VkDevice device, VkDeviceMemory memory, const VkAllocationCallbacks* pAllocator,
                                    const ErrorObject& error_obj) const override;
     bool ValidateMultisampledBlendingArm(uint32_t create_info_count, const VkGraphicsPipelineCreateInfo* create_infos,
@@ -864,25 +866,39 @@ class BestPractices : public ValidationStateTracker {
                                                                ShaderModuleUniqueIds* shader_unique_id_map) const final;
 
   private:
-    // CacheEntry and PostTransformLRUCacheModel are used on the stack
-    struct CacheEntry {
-        uint32_t value;
-        uint32_t age;
+    // Result of scanning the index buffer of an indexed draw
+    struct IndexBufferScan {
+        index_buffer::MinMax range;
+        // Only computed if the range of indices is smaller than the index count
+        index_buffer::VertexReuse reuse;
+        // Hash of the scanned indices, mapped memory can be written to without any API call
+        uint64_t content_hash = 0;
     };
-
-    class PostTransformLRUCacheModel {
-      public:
-        typedef std::vector<CacheEntry>::iterator cache_iterator;
-
-        void resize(size_t size);
-
-        // Returns true if there was a cache hit - also models LRU behavior which will effect subsequent calls.
-        bool query_cache(uint32_t value);
-
-      private:
-        std::vector<CacheEntry> _entries = {};
-        uint32_t iteration = 0;
+    struct IndexBufferScanKey {
+        VkBuffer buffer;
+        VkDeviceMemory memory;
+        VkDeviceSize offset;
+        uint32_t first_index;
+        uint32_t index_count;
+        VkIndexType index_type;
+        bool primitive_restart_enable;
+
+        bool operator==(const IndexBufferScanKey& other) const {
+            return buffer == other.buffer && memory == other.memory && offset == other.offset &&
+                   first_index == other.first_index && index_count == other.index_count && index_type == other.index_type &&
+                   primitive_restart_enable == other.primitive_restart_enable;
+        }
+        struct Hash {
+            size_t operator()(const IndexBufferScanKey& key) const {
+                hash_util::HashCombiner hc;
+                hc << key.buffer << key.memory << key.offset << key.first_index << key.index_count << key.index_type
+                   << key.primitive_restart_enable;
+                return hc.Value();
+            }
+        };
     };
+    IndexBufferScan ScanIndexBuffer(const IndexBufferScanKey& key, const uint8_t* indices) const;
+    void InvalidateIndexBufferScans(VkDeviceMemory memory);
 
     // Check that vendor-specific checks are enabled for at least one of the vendors
     bool VendorCheckEnabled(BPVendorFlags vendors) const;
@@ -971,4 +987,9 @@ class BestPractices : public ValidationStateTracker {
 
     vvl::unordered_set<VkPipeline> pipelines_used_in_frame_;
     mutable std::shared_mutex pipeline_lock_;
+
+    // Arm tracked
+    // Applications usually draw the same large meshes every frame, scanning their indices is only done once
+    mutable vvl::unordered_map<IndexBufferScanKey, IndexBufferScan, IndexBufferScanKey::Hash> index_buffer_scans_;
+    mutable std::mutex index_buffer_scans_lock_;
 };
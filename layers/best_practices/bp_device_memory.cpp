@@ -130,9 +130,22 @@ void BestPractices::PreCallRecordFreeMemory(VkDevice device, VkDeviceMemory memo
         }
     }
 
+    InvalidateIndexBufferScans(memory);
     ValidationStateTracker::PreCallRecordFreeMemory(device, memory, pAllocator, record_obj);
 }
 
+void BestPractices::PreCallRecordUnmapMemory(VkDevice device, VkDeviceMemory memory, const RecordObject& record_obj) {
+    // Index buffers are only scanned while mapped, cached scans of this memory can't be used anymore
+    InvalidateIndexBufferScans(memory);
+    ValidationStateTracker::PreCallRecordUnmapMemory(device, memory, record_obj);
+}
+
+void BestPractices::PreCallRecordUnmapMemory2KHR(VkDevice device, const VkMemoryUnmapInfoKHR* pMemoryUnmapInfo,
+                                                 const RecordObject& record_obj) {
+    InvalidateIndexBufferScans(pMemoryUnmapInfo->memory);
+    ValidationStateTracker::PreCallRecordUnmapMemory2KHR(device, pMemoryUnmapInfo, record_obj);
+}
+
 bool BestPractices::PreCallValidateFreeMemory(VkDevice device, VkDeviceMemory memory, const VkAllocationCallbacks* pAllocator,
                                               const ErrorObject& error_obj) const {
     bool skip = false;
@@ -282,16 +295,22 @@ bool BestPractices::PreCallValidateBindImageMemory2KHR(VkDevice device, uint32_t
 
 void BestPractices::PreCallRecordSetDeviceMemoryPriorityEXT(VkDevice device, VkDeviceMemory memory, float priority,
                                                             const RecordObject& record_obj) {
-    auto mem_info = std::static_pointer_cast<bp_state::DeviceMemory>(Get<vvl::DeviceMemory>(memory));
-    mem_info->dynamic_priority.emplace(priority);
+    auto mem_info = Get<vvl::DeviceMemory>(memory);
+    ASSERT_AND_RETURN(mem_info);
+    auto* sub_state = bp_state::SubState(*mem_info);
+    ASSERT_AND_RETURN(sub_state);
+    sub_state->dynamic_priority.emplace(priority);
 }
 
 bool BestPractices::ValidateBindMemory(VkDevice device, VkDeviceMemory memory, const Location& loc) const {
     bool skip = false;
 
     if (VendorCheckEnabled(kBPVendorNVIDIA) && IsExtEnabled(device_extensions.vk_ext_pageable_device_local_memory)) {
-        auto mem_info = std::static_pointer_cast<const bp_state::DeviceMemory>(Get<vvl::DeviceMemory>(memory));
-        if (!mem_info->dynamic_priority) {
+        auto mem_info = Get<vvl::DeviceMemory>(memory);
+        ASSERT_AND_RETURN_SKIP(mem_info);
+        const auto* sub_state = bp_state::SubState(*mem_info);
+        ASSERT_AND_RETURN_SKIP(sub_state);
+        if (!sub_state->dynamic_priority) {
             skip |=
                 LogPerformanceWarning("BestPractices-NVIDIA-BindMemory-NoPriority", device, loc,
                                       "%s Use vkSetDeviceMemoryPriorityEXT to provide the OS with information on which allocations "
@@ -308,6 +327,8 @@ bool BestPractices::ValidateBindMemory(VkDevice device, VkDeviceMemory memory, c
 std::shared_ptr<vvl::DeviceMemory> BestPractices::CreateDeviceMemoryState(
     VkDeviceMemory handle, const VkMemoryAllocateInfo* pAllocateInfo, uint64_t fake_address, const VkMemoryType& memory_type,
     const VkMemoryHeap& memory_heap, std::optional<vvl::DedicatedBinding>&& dedicated_binding, uint32_t physical_device_count) {
-    return std::static_pointer_cast<vvl::DeviceMemory>(std::make_shared<bp_state::DeviceMemory>(
-        handle, pAllocateInfo, fake_address, memory_type, memory_heap, std::move(dedicated_binding), physical_device_count));
+    auto mem_state = StateTracker::CreateDeviceMemoryState(handle, pAllocateInfo, fake_address, memory_type, memory_heap,
+                                                           std::move(dedicated_binding), physical_device_count);
+    mem_state->AttachSubState(LayerObjectTypeBestPractices, std::make_unique<bp_state::DeviceMemorySubState>());
+    return mem_state;
 }
@@ -21,7 +21,6 @@
 #include "best_practices/bp_state.h"
 #include "state_tracker/buffer_state.h"
 #include "state_tracker/render_pass_state.h"
-#include <bitset>
 
 // Generic function to handle validation for all CmdDraw* type functions
 bool BestPractices::ValidateCmdDrawType(VkCommandBuffer cmd_buffer, const Location& loc) const {
@@ -164,29 +163,53 @@ bool BestPractices::PreCallValidateCmdDrawIndexed(VkCommandBuffer commandBuffer,
     return skip;
 }
 
-void BestPractices::PostTransformLRUCacheModel::resize(size_t size) { _entries.resize(size); }
+// Scans done for fewer indices are cheap enough to not go through the cache
+static constexpr uint32_t kMinCachedIndexBufferScanIndexCount = 4096;
+// Bounds memory used by the cache, it only needs to hold the meshes drawn in a frame
+static constexpr size_t kMaxCachedIndexBufferScans = 1024;
+
+BestPractices::IndexBufferScan BestPractices::ScanIndexBuffer(const IndexBufferScanKey& key, const uint8_t* indices) const {
+    IndexBufferScan scan;
+    const bool use_cache = key.index_count >= kMinCachedIndexBufferScanIndexCount;
+    if (use_cache) {
+        scan.content_hash = hash_util::IndexBufferHash(indices, size_t(key.index_count) * GetIndexAlignment(key.index_type));
+        std::lock_guard<std::mutex> guard(index_buffer_scans_lock_);
+        auto it = index_buffer_scans_.find(key);
+        if (it != index_buffer_scans_.end() && it->second.content_hash == scan.content_hash) {
+            return it->second;
+        }
+    }
+
+    // Min and max are important to track for some Mali architectures. In older Mali devices without IDVS, all
+    // vertices corresponding to indices between the minimum and maximum may be loaded, and possibly shaded,
+    // irrespective of whether or not they're part of the draw call.
+    scan.range = index_buffer::ScanMinMax(indices, key.index_count, key.index_type);
+
+    // Vertex reuse is only looked at for index buffers using most of their range of indices, which bounds the memory needed
+    if (scan.range.max > scan.range.min && scan.range.max - scan.range.min < key.index_count) {
+        scan.reuse = index_buffer::ScanVertexReuse(indices, key.index_count, key.index_type, key.primitive_restart_enable,
+                                                   scan.range);
+    }
 
-bool BestPractices::PostTransformLRUCacheModel::query_cache(uint32_t value) {
-    // look for a cache hit
-    auto hit = std::find_if(_entries.begin(), _entries.end(), [value](const CacheEntry& entry) { return entry.value == value; });
-    if (hit != _entries.end()) {
-        // mark the cache hit as being most recently used
-        hit->age = iteration++;
-        return true;
+    if (use_cache) {
+        std::lock_guard<std::mutex> guard(index_buffer_scans_lock_);
+        if (index_buffer_scans_.size() >= kMaxCachedIndexBufferScans) {
+            index_buffer_scans_.clear();
+        }
+        index_buffer_scans_.insert_or_assign(key, scan);
     }
+    return scan;
+}
 
-    // if there's no cache hit, we need to model the entry being inserted into the cache
-    CacheEntry new_entry = {value, iteration};
-    if (iteration < static_cast<uint32_t>(std::distance(_entries.begin(), _entries.end()))) {
-        // if there is still space left in the cache, use the next available slot
-        *(_entries.begin() + iteration) = new_entry;
-    } else {
-        // otherwise replace the least recently used cache entry
-        auto lru = std::min_element(_entries.begin(), hit, [](const CacheEntry& a, const CacheEntry& b) { return a.age < b.age; });
-        *lru = new_entry;
+void BestPractices::InvalidateIndexBufferScans(VkDeviceMemory memory) {
+    std::lock_guard<std::mutex> guard(index_buffer_scans_lock_);
+    for (auto it = index_buffer_scans_.begin(); it != index_buffer_scans_.end();) {
+        if (it->first.memory == memory) {
+            it = index_buffer_scans_.erase(it);
+        } else {
+            ++it;
+        }
     }
-    iteration++;
-    return false;
 }
 
 bool BestPractices::ValidateIndexBufferArm(const bp_state::CommandBuffer& cmd_state, uint32_t indexCount, uint32_t instanceCount,
@@ -219,53 +242,12 @@ bool BestPractices::ValidateIndexBufferArm(const bp_state::CommandBuffer& cmd_st
     if (ib_mem) {
         const uint32_t scan_stride = GetIndexAlignment(ib_type);
         const uint8_t* scan_begin = static_cast<const uint8_t*>(ib_mem) + firstIndex * scan_stride;
-        const uint8_t* scan_end = scan_begin + indexCount * scan_stride;
-
-        // Min and max are important to track for some Mali architectures. In older Mali devices without IDVS, all
-        // vertices corresponding to indices between the minimum and maximum may be loaded, and possibly shaded,
-        // irrespective of whether or not they're part of the draw call.
-
-        // start with minimum as 0xFFFFFFFF and adjust to indices in the buffer
-        uint32_t min_index = ~0u;
-        // start with maximum as 0 and adjust to indices in the buffer
-        uint32_t max_index = 0u;
-
-        // first scan-through, we're looking to simulate a model LRU post-transform cache, estimating the number of vertices shaded
-        // for the given index buffer
-        uint32_t vertex_shade_count = 0;
-
-        PostTransformLRUCacheModel post_transform_cache;
-
-        // The size of the cache being modelled positively correlates with how much behaviour it can capture about
-        // arbitrary ground-truth hardware/architecture cache behaviour. I.e. it's a good solution when we don't know the
-        // target architecture.
-        // However, modelling a post-transform cache with more than 32 elements gives diminishing returns in practice.
-        // http://eelpi.gotdns.org/papers/fast_vert_cache_opt.html
-        post_transform_cache.resize(32);
-
-        for (const uint8_t* scan_ptr = scan_begin; scan_ptr < scan_end; scan_ptr += scan_stride) {
-            uint32_t scan_index;
-            uint32_t primitive_restart_value;
-            if (ib_type == VK_INDEX_TYPE_UINT8_KHR) {
-                scan_index = *reinterpret_cast<const uint8_t*>(scan_ptr);
-                primitive_restart_value = 0xFF;
-            } else if (ib_type == VK_INDEX_TYPE_UINT16) {
-                scan_index = *reinterpret_cast<const uint16_t*>(scan_ptr);
-                primitive_restart_value = 0xFFFF;
-            } else {
-                scan_index = *reinterpret_cast<const uint32_t*>(scan_ptr);
-                primitive_restart_value = 0xFFFFFFFF;
-            }
-
-            max_index = std::max(max_index, scan_index);
-            min_index = std::min(min_index, scan_index);
 
-            if (!primitive_restart_enable || scan_index != primitive_restart_value) {
-                const bool in_cache = post_transform_cache.query_cache(scan_index);
-                // if the shaded vertex corresponding to the index is not in the PT-cache, we need to shade again
-                if (!in_cache) vertex_shade_count++;
-            }
-        }
+        const IndexBufferScanKey scan_key = {ib_state->VkHandle(), ib_mem_state->VkHandle(), cmd_state.index_buffer_binding.offset,
+                                             firstIndex, indexCount, ib_type, primitive_restart_enable};
+        const IndexBufferScan scan = ScanIndexBuffer(scan_key, scan_begin);
+        const uint32_t min_index = scan.range.min;
+        const uint32_t max_index = scan.range.max;
 
         // if the max and min values were not set, then we either have no indices, or all primitive restarts, exit...
         // if the max and min are the same, then it implies all the indices are the same, then we don't need to do anything
@@ -283,40 +265,8 @@ bool BestPractices::ValidateIndexBufferArm(const bp_state::CommandBuffer& cmd_st
             return skip;
         }
 
-        // use a dynamic vector of bitsets as a memory-compact representation of which indices are included in the draw call
-        // each bit of the n-th bucket contains the inclusion information for indices (n*n_buckets) to ((n+1)*n_buckets)
-        const size_t refs_per_bucket = 64;
-        std::vector<std::bitset<refs_per_bucket>> vertex_reference_buckets;
-
-        const uint32_t n_indices = max_index - min_index + 1;
-        const uint32_t n_buckets = (n_indices / static_cast<uint32_t>(refs_per_bucket)) +
-                                   ((n_indices % static_cast<uint32_t>(refs_per_bucket)) != 0 ? 1 : 0);
-
-        // there needs to be at least one bitset to store a set of indices smaller than n_buckets
-        vertex_reference_buckets.resize(std::max(1u, n_buckets));
-
-        // To avoid using too much memory, we run over the indices again.
-        // Knowing the size from the last scan allows us to record index usage with bitsets
-        for (const uint8_t* scan_ptr = scan_begin; scan_ptr < scan_end; scan_ptr += scan_stride) {
-            uint32_t scan_index;
-            if (ib_type == VK_INDEX_TYPE_UINT8_KHR) {
-                scan_index = *reinterpret_cast<const uint8_t*>(scan_ptr);
-            } else if (ib_type == VK_INDEX_TYPE_UINT16) {
-                scan_index = *reinterpret_cast<const uint16_t*>(scan_ptr);
-            } else {
-                scan_index = *reinterpret_cast<const uint32_t*>(scan_ptr);
-            }
-            // keep track of the set of all indices used to reference vertices in the draw call
-            size_t index_offset = scan_index - min_index;
-            size_t bitset_bucket_index = index_offset / refs_per_bucket;
-            uint64_t used_indices = 1ull << ((index_offset % refs_per_bucket) & 0xFFFFFFFFu);
-            vertex_reference_buckets[bitset_bucket_index] |= used_indices;
-        }
-
-        uint32_t vertex_reference_count = 0;
-        for (const auto& bitset : vertex_reference_buckets) {
-            vertex_reference_count += static_cast<uint32_t>(bitset.count());
-        }
+        const uint32_t vertex_reference_count = scan.reuse.referenced_count;
+        const uint32_t vertex_shade_count = scan.reuse.shaded_count;
 
         // low index buffer utilization implies that: of the vertices available to the draw call, not all are utilized
         float utilization = static_cast<float>(vertex_reference_count) / static_cast<float>(max_index - min_index + 1);
@@ -98,25 +98,28 @@ class PhysicalDevice : public vvl::PhysicalDevice {
     CALL_STATE vkGetPhysicalDeviceDisplayPlanePropertiesKHRState = UNCALLED;
 };
 
-class Swapchain : public vvl::Swapchain {
+class SwapchainSubState : public vvl::SubState {
   public:
-    Swapchain(ValidationStateTracker& dev_data, const VkSwapchainCreateInfoKHR* pCreateInfo, VkSwapchainKHR handle)
-        : vvl::Swapchain(dev_data, pCreateInfo, handle) {}
-
     CALL_STATE vkGetSwapchainImagesKHRState = UNCALLED;
 };
 
-class DeviceMemory : public vvl::DeviceMemory {
+class DeviceMemorySubState : public vvl::SubState {
   public:
-    DeviceMemory(VkDeviceMemory handle, const VkMemoryAllocateInfo* pAllocateInfo, uint64_t fake_address,
-                 const VkMemoryType& memory_type, const VkMemoryHeap& memory_heap,
-                 std::optional<vvl::DedicatedBinding>&& dedicated_binding, uint32_t physical_device_count)
-        : vvl::DeviceMemory(handle, pAllocateInfo, fake_address, memory_type, memory_heap, std::move(dedicated_binding),
-                            physical_device_count) {}
-
     std::optional<float> dynamic_priority;  // VK_EXT_pageable_device_local_memory priority
 };
 
+// Attached by BestPractices::CreateSwapchainState() and BestPractices::CreateDeviceMemoryState().
+// Return null if the sub state is missing, callers must check.
+inline SwapchainSubState* SubState(vvl::Swapchain& swapchain) {
+    return swapchain.FindSubState<SwapchainSubState>(LayerObjectTypeBestPractices);
+}
+inline const DeviceMemorySubState* SubState(const vvl::DeviceMemory& memory) {
+    return memory.FindSubState<DeviceMemorySubState>(LayerObjectTypeBestPractices);
+}
+inline DeviceMemorySubState* SubState(vvl::DeviceMemory& memory) {
+    return memory.FindSubState<DeviceMemorySubState>(LayerObjectTypeBestPractices);
+}
+
 struct AttachmentInfo {
     uint32_t framebufferAttachment;
     VkImageAspectFlags aspects;
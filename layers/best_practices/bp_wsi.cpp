@@ -332,15 +332,19 @@ void BestPractices::ManualPostCallRecordGetPhysicalDeviceDisplayPlanePropertiesK
 void BestPractices::ManualPostCallRecordGetSwapchainImagesKHR(VkDevice device, VkSwapchainKHR swapchain,
                                                               uint32_t* pSwapchainImageCount, VkImage* pSwapchainImages,
                                                               const RecordObject& record_obj) {
-    auto swapchain_state = Get<bp_state::Swapchain>(swapchain);
+    auto swapchain_state = Get<vvl::Swapchain>(swapchain);
     if (swapchain_state && (pSwapchainImages || *pSwapchainImageCount)) {
-        if (swapchain_state->vkGetSwapchainImagesKHRState < QUERY_DETAILS) {
-            swapchain_state->vkGetSwapchainImagesKHRState = QUERY_DETAILS;
+        auto* sub_state = bp_state::SubState(*swapchain_state);
+        ASSERT_AND_RETURN(sub_state);
+        if (sub_state->vkGetSwapchainImagesKHRState < QUERY_DETAILS) {
+            sub_state->vkGetSwapchainImagesKHRState = QUERY_DETAILS;
         }
     }
 }
 
 std::shared_ptr<vvl::Swapchain> BestPractices::CreateSwapchainState(const VkSwapchainCreateInfoKHR* pCreateInfo,
                                                                     VkSwapchainKHR handle) {
-    return std::static_pointer_cast<vvl::Swapchain>(std::make_shared<bp_state::Swapchain>(*this, pCreateInfo, handle));
+    auto swapchain_state = StateTracker::CreateSwapchainState(pCreateInfo, handle);
+    swapchain_state->AttachSubState(LayerObjectTypeBestPractices, std::make_unique<bp_state::SwapchainSubState>());
+    return swapchain_state;
 }
\ No newline at end of file
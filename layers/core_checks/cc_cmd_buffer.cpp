@@ -788,6 +788,485 @@ constexpr uint32_t CoreChecks::ViewportScissorInheritanceTracker::kMaxViewports;
 constexpr uint32_t CoreChecks::ViewportScissorInheritanceTracker::kNotTrashed;
 constexpr uint32_t CoreChecks::ViewportScissorInheritanceTracker::kTrashedByPrimary;
 
+// Secondaries worth validating on one thread of the device pool, and the most threads used for one vkCmdExecuteCommands
+static constexpr uint32_t kMinSecondariesPerWorker = 32;
+static constexpr uint32_t kMaxExecuteCommandsWorkers = 8;
+
+bool CoreChecks::ValidateExecutedSecondary(const vvl::CommandBuffer &cb_state, const vvl::CommandBuffer &sub_cb_state,
+                                           const QueryObject *active_occlusion_query, const Location &cb_loc,
+                                           const Location &loc) const {
+    bool skip = false;
+    const VkCommandBuffer primary = cb_state.VkHandle();
+    const VkCommandBuffer secondary = sub_cb_state.VkHandle();
+
+    if (!sub_cb_state.IsSeconary()) {
+        const LogObjectList objlist(primary, secondary);
+        skip |= LogError("VUID-vkCmdExecuteCommands-pCommandBuffers-00088", objlist, cb_loc,
+                         "(%s) is not VK_COMMAND_BUFFER_LEVEL_SECONDARY.", FormatHandle(secondary).c_str());
+    } else {
+        if (!cb_state.activeRenderPass) {
+            if (sub_cb_state.beginInfo.flags & VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT) {
+                const LogObjectList objlist(primary, secondary);
+                skip |= LogError("VUID-vkCmdExecuteCommands-pCommandBuffers-00100", objlist, cb_loc,
+                                 "(%s) is executed outside a render pass "
+                                 "instance scope, but the Secondary Command Buffer does have the "
+                                 "VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT set in VkCommandBufferBeginInfo::flags when "
+                                 "the vkBeginCommandBuffer() was called.",
+                                 FormatHandle(secondary).c_str());
+            }
+        } else if (sub_cb_state.beginInfo.pInheritanceInfo != nullptr) {
+            const uint32_t inheritance_subpass = sub_cb_state.beginInfo.pInheritanceInfo->subpass;
+            const VkRenderPass inheritance_render_pass = sub_cb_state.beginInfo.pInheritanceInfo->renderPass;
+            if (!(sub_cb_state.beginInfo.flags & VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT)) {
+                const LogObjectList objlist(secondary, cb_state.activeRenderPass->Handle());
+                skip |= LogError("VUID-vkCmdExecuteCommands-pCommandBuffers-00096", objlist, cb_loc,
+                                 "(%s) is executed within a %s "
+                                 "instance scope, but the Secondary Command Buffer does not have the "
+                                 "VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT set in VkCommandBufferBeginInfo::flags when "
+                                 "the vkBeginCommandBuffer() was called.",
+                                 FormatHandle(secondary).c_str(), FormatHandle(cb_state.activeRenderPass->Handle()).c_str());
+            } else if (sub_cb_state.beginInfo.flags & VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT) {
+                if (!cb_state.activeRenderPass->UsesDynamicRendering()) {
+                    // Make sure render pass is compatible with parent command buffer pass if secondary command buffer has
+                    // "render pass continue" usage flag
+                    auto secondary_rp_state = Get<vvl::RenderPass>(inheritance_render_pass);
+                    if (secondary_rp_state && (cb_state.activeRenderPass->VkHandle() != secondary_rp_state->VkHandle())) {
+                        skip |= ValidateRenderPassCompatibility(cb_state.Handle(), *cb_state.activeRenderPass.get(),
+                                                                secondary_rp_state->Handle(), *secondary_rp_state.get(), cb_loc,
+                                                                "VUID-vkCmdExecuteCommands-pBeginInfo-06020");
+                    }
+                    //  If framebuffer for secondary CB is not NULL, then it must match active FB from primaryCB
+                    skip |= ValidateInheritanceInfoFramebuffer(primary, cb_state, secondary, sub_cb_state, loc);
+                }
+                // Inherit primary's activeFramebuffer, or null if using dynamic rendering,
+                // and while running validate functions
+                for (auto &function : sub_cb_state.cmd_execute_commands_functions) {
+                    skip |= function(sub_cb_state, &cb_state, cb_state.activeFramebuffer.get());
+                }
+            }
+
+            if ((sub_cb_state.beginInfo.flags & VK_COMMAND_BUFFER_USAGE_SIMULTANEOUS_USE_BIT) &&
+                !enabled_features.nestedCommandBufferSimultaneousUse) {
+                skip |= LogError("VUID-vkCmdExecuteCommands-nestedCommandBufferSimultaneousUse-09378", secondary, cb_loc,
+                                 "(%s) was recorded with VkCommandBufferBeginInfo::flag including "
+                                 "VK_COMMAND_BUFFER_USAGE_SIMULTANEOUS_USE_BIT, but the nestedCommandBufferSimultaneousUse feature "
+                                 "was not enabled.",
+                                 FormatHandle(secondary).c_str());
+            }
+
+            if (!cb_state.activeRenderPass->UsesDynamicRendering() && (cb_state.GetActiveSubpass() != inheritance_subpass)) {
+                const LogObjectList objlist(primary, secondary, cb_state.activeRenderPass->Handle());
+                skip |= LogError("VUID-vkCmdExecuteCommands-pCommandBuffers-06019", objlist, cb_loc,
+                                 "(%s) is executed within a %s "
+                                 "instance scope begun by vkCmdBeginRenderPass(), but "
+                                 "VkCommandBufferInheritanceInfo::subpass (%" PRIu32
+                                 ") does not "
+                                 "match the current subpass (%" PRIu32 ").",
+                                 FormatHandle(secondary).c_str(),
+                                 FormatHandle(cb_state.activeRenderPass->Handle()).c_str(), inheritance_subpass,
+                                 cb_state.GetActiveSubpass());
+            } else if (cb_state.activeRenderPass->UsesDynamicRendering()) {
+                if (inheritance_render_pass != VK_NULL_HANDLE) {
+                    const LogObjectList objlist(primary, secondary, cb_state.activeRenderPass->Handle());
+                    skip |= LogError("VUID-vkCmdExecuteCommands-pBeginInfo-06025", objlist, cb_loc,
+                                     "(%s) is executed within a dynamic renderpass instance scope begun "
+                                     "by vkCmdBeginRendering(), but "
+                                     "VkCommandBufferInheritanceInfo::pInheritanceInfo::renderPass is not VK_NULL_HANDLE.",
+                                     FormatHandle(secondary).c_str());
+                }
+
+                if (cb_state.activeRenderPass->use_dynamic_rendering && sub_cb_state.activeRenderPass &&
+                    sub_cb_state.activeRenderPass->use_dynamic_rendering_inherited) {
+                    const auto rendering_info = cb_state.activeRenderPass->dynamic_rendering_begin_rendering_info;
+                    const auto inheritance_rendering_info = sub_cb_state.activeRenderPass->inheritance_rendering_info;
+                    if ((inheritance_rendering_info.flags &
+                         ~(VK_RENDERING_CONTENTS_SECONDARY_COMMAND_BUFFERS_BIT_KHR | VK_RENDERING_CONTENTS_INLINE_BIT_EXT)) !=
+                        (rendering_info.flags &
+                         ~(VK_RENDERING_CONTENTS_SECONDARY_COMMAND_BUFFERS_BIT_KHR | VK_RENDERING_CONTENTS_INLINE_BIT_EXT))) {
+                        const LogObjectList objlist(primary, secondary, cb_state.activeRenderPass->Handle());
+                        skip |= LogError("VUID-vkCmdExecuteCommands-flags-06026", objlist, cb_loc,
+                                         "(%s) is executed within a dynamic renderpass instance scope begun "
+                                         "by vkCmdBeginRendering(), but VkCommandBufferInheritanceRenderingInfo::flags (%s) does "
+                                         "not match VkRenderingInfo::flags (%s) (excluding "
+                                         "VK_RENDERING_CONTENTS_SECONDARY_COMMAND_BUFFERS_BIT_KHR or "
+                                         "VK_RENDERING_CONTENTS_INLINE_BIT_EXT).",
+                                         FormatHandle(secondary).c_str(),
+                                         string_VkRenderingFlags(inheritance_rendering_info.flags).c_str(),
+                                         string_VkRenderingFlags(rendering_info.flags).c_str());
+                    }
+
+                    if (inheritance_rendering_info.colorAttachmentCount != rendering_info.colorAttachmentCount) {
+                        const LogObjectList objlist(primary, secondary, cb_state.activeRenderPass->Handle());
+                        skip |= LogError("VUID-vkCmdExecuteCommands-colorAttachmentCount-06027", objlist, cb_loc,
+                                         "(%s) is executed within a dynamic renderpass instance scope begun "
+                                         "by vkCmdBeginRendering(), but "
+                                         "VkCommandBufferInheritanceRenderingInfo::colorAttachmentCount (%" PRIu32
+                                         ") does "
+                                         "not match VkRenderingInfo::colorAttachmentCount (%" PRIu32 ").",
+                                         FormatHandle(secondary).c_str(),
+                                         inheritance_rendering_info.colorAttachmentCount, rendering_info.colorAttachmentCount);
+                    }
+
+                    for (uint32_t color_i = 0, count = std::min(inheritance_rendering_info.colorAttachmentCount,
+                                                                rendering_info.colorAttachmentCount);
+                         color_i < count; color_i++) {
+                        if (rendering_info.pColorAttachments[color_i].imageView == VK_NULL_HANDLE) {
+                            if (inheritance_rendering_info.pColorAttachmentFormats[color_i] != VK_FORMAT_UNDEFINED) {
+                                const LogObjectList objlist(primary, secondary, cb_state.activeRenderPass->Handle());
+                                skip |= LogError("VUID-vkCmdExecuteCommands-imageView-07606", objlist, cb_loc,
+                                                 "(%s) is executed within a dynamic render pass instance "
+                                                 "scope begun "
+                                                 "by vkCmdBeginRendering(), VkRenderingInfo::pColorAttachments[%" PRIu32
+                                                 "].imageView is VK_NULL_HANDLE but "
+                                                 "VkCommandBufferInheritanceRenderingInfo::pColorAttachmentFormats[%" PRIu32
+                                                 "] is %s.",
+                                                 FormatHandle(secondary).c_str(), color_i, color_i,
+                                                 string_VkFormat(inheritance_rendering_info.pColorAttachmentFormats[color_i]));
+                            }
+                        } else {
+                            auto image_view_state = Get<vvl::ImageView>(rendering_info.pColorAttachments[color_i].imageView);
+
+                            if (image_view_state && image_view_state->create_info.format !=
+                                                        inheritance_rendering_info.pColorAttachmentFormats[color_i]) {
+                                const LogObjectList objlist(primary, secondary, cb_state.activeRenderPass->Handle());
+                                skip |= LogError("VUID-vkCmdExecuteCommands-imageView-06028", objlist, cb_loc,
+                                                 "(%s) is executed within a dynamic render pass instance "
+                                                 "scope begun "
+                                                 "by vkCmdBeginRendering(), VkRenderingInfo::pColorAttachments[%" PRIu32
+                                                 "].imageView format is %s but "
+                                                 "VkCommandBufferInheritanceRenderingInfo::pColorAttachmentFormats[%" PRIu32
+                                                 "] is %s.",
+                                                 FormatHandle(secondary).c_str(), color_i,
+                                                 string_VkFormat(image_view_state->create_info.format), color_i,
+                                                 string_VkFormat(inheritance_rendering_info.pColorAttachmentFormats[color_i]));
+                            }
+                        }
+                    }
+
+                    if ((rendering_info.pDepthAttachment != nullptr) &&
+                        rendering_info.pDepthAttachment->imageView != VK_NULL_HANDLE) {
+                        auto image_view_state = Get<vvl::ImageView>(rendering_info.pDepthAttachment->imageView);
+
+                        if (image_view_state &&
+                            image_view_state->create_info.format != inheritance_rendering_info.depthAttachmentFormat) {
+                            const LogObjectList objlist(primary, secondary, cb_state.activeRenderPass->Handle());
+                            skip |= LogError("VUID-vkCmdExecuteCommands-pDepthAttachment-06029", objlist, cb_loc,
+                                             "(%s) is executed within a dynamic renderpass "
+                                             "instance scope begun "
+                                             "by vkCmdBeginRendering(), but "
+                                             "VkCommandBufferInheritanceRenderingInfo::depthAttachmentFormat does "
+                                             "not match the format of the imageView in VkRenderingInfo::pDepthAttachment.",
+                                             FormatHandle(secondary).c_str());
+                        }
+                    }
+
+                    if ((rendering_info.pStencilAttachment != nullptr) &&
+                        rendering_info.pStencilAttachment->imageView != VK_NULL_HANDLE) {
+                        auto image_view_state = Get<vvl::ImageView>(rendering_info.pStencilAttachment->imageView);
+
+                        if (image_view_state &&
+                            image_view_state->create_info.format != inheritance_rendering_info.stencilAttachmentFormat) {
+                            const LogObjectList objlist(primary, secondary, cb_state.activeRenderPass->Handle());
+                            skip |= LogError("VUID-vkCmdExecuteCommands-pStencilAttachment-06030", objlist, cb_loc,
+                                             "(%s) is executed within a dynamic renderpass "
+                                             "instance scope begun "
+                                             "by vkCmdBeginRendering(), but "
+                                             "VkCommandBufferInheritanceRenderingInfo::stencilAttachmentFormat does "
+                                             "not match the format of the imageView in VkRenderingInfo::pStencilAttachment.",
+                                             FormatHandle(secondary).c_str());
+                        }
+                    }
+
+                    if (rendering_info.pDepthAttachment == nullptr ||
+                        rendering_info.pDepthAttachment->imageView == VK_NULL_HANDLE) {
+                        VkFormat format = inheritance_rendering_info.depthAttachmentFormat;
+                        if (format != VK_FORMAT_UNDEFINED) {
+                            const LogObjectList objlist(primary, secondary, cb_state.activeRenderPass->Handle());
+                            skip |= LogError("VUID-vkCmdExecuteCommands-pDepthAttachment-06774", objlist, cb_loc,
+                                             "(%s) is executed within a dynamic renderpass "
+                                             "instance scope begun by vkCmdBeginRendering(), and "
+                                             "VkRenderingInfo::pDepthAttachment does not define an "
+                                             "image view but VkCommandBufferInheritanceRenderingInfo::depthAttachmentFormat "
+                                             "is %s instead of VK_FORMAT_UNDEFINED.",
+                                             FormatHandle(secondary).c_str(), string_VkFormat(format));
+                        }
+                    }
+
+                    if (rendering_info.pStencilAttachment == nullptr ||
+                        rendering_info.pStencilAttachment->imageView == VK_NULL_HANDLE) {
+                        VkFormat format = inheritance_rendering_info.stencilAttachmentFormat;
+                        if (format != VK_FORMAT_UNDEFINED) {
+                            const LogObjectList objlist(primary, secondary, cb_state.activeRenderPass->Handle());
+                            skip |= LogError("VUID-vkCmdExecuteCommands-pStencilAttachment-06775", objlist, cb_loc,
+                                             "(%s) is executed within a dynamic renderpass "
+                                             "instance scope begun by vkCmdBeginRendering(), and "
+                                             "VkRenderingInfo::pStencilAttachment does not define an "
+                                             "image view but VkCommandBufferInheritanceRenderingInfo::stencilAttachmentFormat "
+                                             "is %s instead of VK_FORMAT_UNDEFINED.",
+                                             FormatHandle(secondary).c_str(), string_VkFormat(format));
+                        }
+                    }
+
+                    if (rendering_info.viewMask != inheritance_rendering_info.viewMask) {
+                        const LogObjectList objlist(primary, secondary, cb_state.activeRenderPass->Handle());
+                        skip |= LogError("VUID-vkCmdExecuteCommands-viewMask-06031", objlist, cb_loc,
+                                         "(%s) is executed within a dynamic renderpass instance scope begun "
+                                         "by vkCmdBeginRendering(), but "
+                                         "VkCommandBufferInheritanceRenderingInfo::viewMask (%" PRIu32
+                                         ") does "
+                                         "not match VkRenderingInfo::viewMask (%" PRIu32 ").",
+                                         FormatHandle(secondary).c_str(), inheritance_rendering_info.viewMask,
+                                         rendering_info.viewMask);
+                    }
+
+                    // VkAttachmentSampleCountInfoAMD == VkAttachmentSampleCountInfoNV
+                    const auto amd_sample_count =
+                        vku::FindStructInPNextChain<VkAttachmentSampleCountInfoAMD>(inheritance_rendering_info.pNext);
+
+                    if (amd_sample_count) {
+                        for (uint32_t index = 0; index < rendering_info.colorAttachmentCount; index++) {
+                            if (rendering_info.pColorAttachments[index].imageView == VK_NULL_HANDLE) {
+                                continue;
+                            }
+                            auto image_view_state = Get<vvl::ImageView>(rendering_info.pColorAttachments[index].imageView);
+
+                            if (image_view_state &&
+                                image_view_state->samples != amd_sample_count->pColorAttachmentSamples[index]) {
+                                const LogObjectList objlist(primary, secondary, cb_state.activeRenderPass->Handle());
+                                skip |= LogError(
+                                    "VUID-vkCmdExecuteCommands-pNext-06032", objlist, cb_loc,
+                                    "(%s) is executed within a dynamic renderpass instance "
+                                    "scope begun "
+                                    "by vkCmdBeginRenderingKHR(), but "
+                                    "VkAttachmentSampleCountInfo(AMD/NV)::pColorAttachmentSamples at index (%" PRIu32
+                                    ") "
+                                    "does "
+                                    "not match the sample count of the imageView in VkRenderingInfoKHR::pColorAttachments.",
+                                    FormatHandle(secondary).c_str(), index);
+                            }
+                        }
+
+                        if ((rendering_info.pDepthAttachment != nullptr) &&
+                            rendering_info.pDepthAttachment->imageView != VK_NULL_HANDLE) {
+                            auto image_view_state = Get<vvl::ImageView>(rendering_info.pDepthAttachment->imageView);
+
+                            if (image_view_state &&
+                                image_view_state->samples != amd_sample_count->depthStencilAttachmentSamples) {
+                                const LogObjectList objlist(primary, secondary, cb_state.activeRenderPass->Handle());
+                                skip |= LogError(
+                                    "VUID-vkCmdExecuteCommands-pNext-06033", objlist, cb_loc,
+                                    "(%s) is executed within a dynamic renderpass instance "
+                                    "scope begun "
+                                    "by vkCmdBeginRenderingKHR(), but "
+                                    "VkAttachmentSampleCountInfo(AMD/NV)::depthStencilAttachmentSamples does "
+                                    "not match the sample count of the imageView in VkRenderingInfoKHR::pDepthAttachment.",
+                                    FormatHandle(secondary).c_str());
+                            }
+                        }
+
+                        if ((rendering_info.pStencilAttachment != nullptr) &&
+                            rendering_info.pStencilAttachment->imageView != VK_NULL_HANDLE) {
+                            auto image_view_state = Get<vvl::ImageView>(rendering_info.pStencilAttachment->imageView);
+
+                            if (image_view_state &&
+                                image_view_state->samples != amd_sample_count->depthStencilAttachmentSamples) {
+                                const LogObjectList objlist(primary, secondary, cb_state.activeRenderPass->Handle());
+                                skip |= LogError(
+                                    "VUID-vkCmdExecuteCommands-pNext-06034", objlist, cb_loc,
+                                    "(%s) is executed within a dynamic renderpass instance "
+                                    "scope begun "
+                                    "by vkCmdBeginRenderingKHR(), but "
+                                    "VkAttachmentSampleCountInfo(AMD/NV)::depthStencilAttachmentSamples does "
+                                    "not match the sample count of the imageView in VkRenderingInfoKHR::pStencilAttachment.",
+                                    FormatHandle(secondary).c_str());
+                            }
+                        }
+                    } else {
+                        for (uint32_t index = 0; index < rendering_info.colorAttachmentCount; index++) {
+                            if (rendering_info.pColorAttachments[index].imageView == VK_NULL_HANDLE) {
+                                continue;
+                            }
+                            auto image_view_state = Get<vvl::ImageView>(rendering_info.pColorAttachments[index].imageView);
+
+                            if (image_view_state &&
+                                image_view_state->samples != inheritance_rendering_info.rasterizationSamples) {
+                                const LogObjectList objlist(primary, secondary, cb_state.activeRenderPass->Handle());
+                                skip |= LogError(
+                                    "VUID-vkCmdExecuteCommands-pNext-06035", objlist, cb_loc,
+                                    "(%s) is executed within a dynamic renderpass instance "
+                                    "scope begun "
+                                    "by vkCmdBeginRenderingKHR(), but the sample count of the image view at index (%" PRIu32
+                                    ") of "
+                                    "VkRenderingInfoKHR::pColorAttachments does not match "
+                                    "VkCommandBufferInheritanceRenderingInfo::rasterizationSamples.",
+                                    FormatHandle(secondary).c_str(), index);
+                            }
+                        }
+
+                        if ((rendering_info.pDepthAttachment != nullptr) &&
+                            rendering_info.pDepthAttachment->imageView != VK_NULL_HANDLE) {
+                            auto image_view_state = Get<vvl::ImageView>(rendering_info.pDepthAttachment->imageView);
+
+                            if (image_view_state &&
+                                image_view_state->samples != inheritance_rendering_info.rasterizationSamples) {
+                                const LogObjectList objlist(primary, secondary, cb_state.activeRenderPass->Handle());
+                                skip |= LogError("VUID-vkCmdExecuteCommands-pNext-06036", objlist, cb_loc,
+                                                 "(%s) is executed within a dynamic renderpass "
+                                                 "instance scope begun "
+                                                 "by vkCmdBeginRenderingKHR(), but the sample count of the image view for "
+                                                 "VkRenderingInfoKHR::pDepthAttachment does not match "
+                                                 "VkCommandBufferInheritanceRenderingInfo::rasterizationSamples.",
+                                                 FormatHandle(secondary).c_str());
+                            }
+                        }
+
+                        if ((rendering_info.pStencilAttachment != nullptr) &&
+                            rendering_info.pStencilAttachment->imageView != VK_NULL_HANDLE) {
+                            auto image_view_state = Get<vvl::ImageView>(rendering_info.pStencilAttachment->imageView);
+
+                            if (image_view_state &&
+                                image_view_state->samples != inheritance_rendering_info.rasterizationSamples) {
+                                const LogObjectList objlist(primary, secondary, cb_state.activeRenderPass->Handle());
+                                skip |= LogError("VUID-vkCmdExecuteCommands-pNext-06037", objlist, cb_loc,
+                                                 "(%s) is executed within a dynamic renderpass "
+                                                 "instance scope begun "
+                                                 "by vkCmdBeginRenderingKHR(), but the sample count of the image view for "
+                                                 "VkRenderingInfoKHR::pStencilAttachment does not match "
+                                                 "VkCommandBufferInheritanceRenderingInfo::rasterizationSamples.",
+                                                 FormatHandle(secondary).c_str());
+                            }
+                        }
+                    }
+                }
+            }
+
+            // spec: "A maxCommandBufferNestingLevel of UINT32_MAX means there is no limit to the nesting level"
+            if (enabled_features.nestedCommandBuffer &&
+                phys_dev_ext_props.nested_command_buffer_props.maxCommandBufferNestingLevel != UINT32_MAX) {
+                if (sub_cb_state.nesting_level >= phys_dev_ext_props.nested_command_buffer_props.maxCommandBufferNestingLevel) {
+                    skip |= LogError("VUID-vkCmdExecuteCommands-nestedCommandBuffer-09376", secondary, cb_loc,
+                                     "(%s) has a nesting level of %" PRIu32
+                                     " which is not less then maxCommandBufferNestingLevel (%" PRIu32 ").",
+                                     FormatHandle(secondary).c_str(), sub_cb_state.nesting_level,
+                                     phys_dev_ext_props.nested_command_buffer_props.maxCommandBufferNestingLevel);
+                }
+            }
+        }
+    }
+
+    // TODO(mlentine): Move more logic into this method
+    skip |= ValidateSecondaryCommandBufferState(cb_state, sub_cb_state, cb_loc);
+    skip |= ValidateCommandBufferState(sub_cb_state, cb_loc, 0, "VUID-vkCmdExecuteCommands-pCommandBuffers-00089");
+    if (!(sub_cb_state.beginInfo.flags & VK_COMMAND_BUFFER_USAGE_SIMULTANEOUS_USE_BIT)) {
+        if (sub_cb_state.InUse()) {
+            const LogObjectList objlist(primary, secondary);
+            skip |= LogError("VUID-vkCmdExecuteCommands-pCommandBuffers-00091", objlist, cb_loc,
+                             "Cannot execute pending %s without VK_COMMAND_BUFFER_USAGE_SIMULTANEOUS_USE_BIT set.",
+                             FormatHandle(secondary).c_str());
+        }
+        // We use an const_cast, because one cannot query a container keyed on a non-const pointer using a const pointer
+        if (cb_state.linkedCommandBuffers.count(const_cast<vvl::CommandBuffer *>(&sub_cb_state))) {
+            const LogObjectList objlist(primary, secondary);
+            skip |= LogError("VUID-vkCmdExecuteCommands-pCommandBuffers-00092", objlist, cb_loc,
+                             "Cannot execute %s without VK_COMMAND_BUFFER_USAGE_SIMULTANEOUS_USE_BIT "
+                             "set if previously executed in %s",
+                             FormatHandle(secondary).c_str(), FormatHandle(primary).c_str());
+        }
+    }
+    if (!cb_state.activeQueries.empty() && !enabled_features.inheritedQueries) {
+        const LogObjectList objlist(primary, secondary);
+        skip |= LogError("VUID-vkCmdExecuteCommands-commandBuffer-00101", objlist, cb_loc,
+                         "cannot be submitted with a query in flight and "
+                         "inherited queries not supported on this device.");
+    }
+    // Validate initial layout uses vs. the primary cmd buffer state
+    // Novel Valid usage: "UNASSIGNED-vkCmdExecuteCommands-commandBuffer-00001"
+    // initial layout usage of secondary command buffers resources must match parent command buffer
+    for (const auto &sub_layout_map_entry : sub_cb_state.image_layout_map) {
+        const auto image = sub_layout_map_entry.first;
+
+        const auto cb_subres_map = cb_state.GetImageSubresourceLayoutMap(image);
+        // Const getter can be null in which case we have nothing to check against for this image...
+        if (!cb_subres_map) continue;
+
+        const auto &sub_layout_map = sub_layout_map_entry.second.map->GetLayoutMap();
+        const auto &cb_layout_map = cb_subres_map->GetLayoutMap();
+        for (sparse_container::parallel_iterator<const ImageSubresourceLayoutMap::LayoutMap> iter(sub_layout_map, cb_layout_map, 0);
+             !iter->range.empty(); ++iter) {
+            VkImageLayout cb_layout = kInvalidLayout, sub_layout = kInvalidLayout;
+            const char *layout_type;
+
+            if (!iter->pos_A->valid || !iter->pos_B->valid) continue;
+
+            // pos_A denotes the sub CB map in the parallel iterator
+            sub_layout = iter->pos_A->lower_bound->second.initial_layout;
+            if (VK_IMAGE_LAYOUT_UNDEFINED == sub_layout) continue;  // secondary doesn't care about current or initial
+
+            // pos_B denotes the main CB map in the parallel iterator
+            const auto &cb_layout_state = iter->pos_B->lower_bound->second;
+            if (cb_layout_state.current_layout != kInvalidLayout) {
+                layout_type = "current";
+                cb_layout = cb_layout_state.current_layout;
+            } else if (cb_layout_state.initial_layout != kInvalidLayout) {
+                layout_type = "initial";
+                cb_layout = cb_layout_state.initial_layout;
+            } else {
+                continue;
+            }
+            if (sub_layout != cb_layout) {
+                // We can report all the errors for the intersected range directly
+                for (auto index = iter->range.begin; index < iter->range.end; index++) {
+                    const LogObjectList objlist(primary, secondary);
+                    const auto image_state = Get<vvl::Image>(image);
+                    if (!image_state) continue;
+                    const auto subresource = image_state->subresource_encoder.Decode(index);
+                    // VU being worked on https://gitlab.khronos.org/vulkan/vulkan/-/issues/2456
+                    skip |= LogError("UNASSIGNED-vkCmdExecuteCommands-commandBuffer-00001", objlist, cb_loc,
+                                     "was executed using %s (subresource: aspectMask 0x%x array layer %" PRIu32
+                                     ", mip level %" PRIu32 ") which expects layout %s--instead, image %s layout is %s.",
+                                     FormatHandle(image).c_str(), subresource.aspectMask, subresource.arrayLayer,
+                                     subresource.mipLevel, string_VkImageLayout(sub_layout), layout_type,
+                                     string_VkImageLayout(cb_layout));
+                }
+            }
+        }
+    }
+
+    // All commands buffers involved must be protected or unprotected
+    if ((cb_state.unprotected == false) && (sub_cb_state.unprotected == true)) {
+        const LogObjectList objlist(primary, secondary);
+        skip |= LogError("VUID-vkCmdExecuteCommands-commandBuffer-01820", objlist, cb_loc,
+                         "(%s) is a unprotected while primary command buffer (%s) is protected.",
+                         FormatHandle(secondary).c_str(), FormatHandle(primary).c_str());
+    } else if ((cb_state.unprotected == true) && (sub_cb_state.unprotected == false)) {
+        const LogObjectList objlist(primary, secondary);
+        skip |= LogError("VUID-vkCmdExecuteCommands-commandBuffer-01821", objlist, cb_loc,
+                         "(%s) is a protected while primary command buffer (%s) is unprotected.",
+                         FormatHandle(secondary).c_str(), FormatHandle(primary).c_str());
+    }
+    if (active_occlusion_query) {
+        if (sub_cb_state.inheritanceInfo.occlusionQueryEnable != VK_TRUE) {
+            const LogObjectList objlist(primary, secondary);
+            skip |= LogError("VUID-vkCmdExecuteCommands-commandBuffer-00102", objlist, cb_loc,
+                             "(%s) was recorded with VkCommandBufferInheritanceInfo::occlusionQueryEnable set to VK_FALSE, but "
+                             "primary command buffer %s has an active occlusion query",
+                             FormatHandle(secondary).c_str(), FormatHandle(primary).c_str());
+        }
+        if ((sub_cb_state.inheritanceInfo.queryFlags & active_occlusion_query->control_flags) !=
+            active_occlusion_query->control_flags) {
+            const LogObjectList objlist(primary, secondary);
+            skip |= LogError("VUID-vkCmdExecuteCommands-commandBuffer-00103", objlist, cb_loc,
+                             "(%s) was recorded with VkCommandBufferInheritanceInfo::queryFlags %s, but primary command buffer "
+                             "%s has an active occlusion query with VkQueryControlFlags %s.",
+                             FormatHandle(secondary).c_str(),
+                             string_VkQueryControlFlags(sub_cb_state.inheritanceInfo.queryFlags).c_str(),
+                             FormatHandle(primary).c_str(),
+                             string_VkQueryControlFlags(active_occlusion_query->control_flags).c_str());
+        }
+    }
+    return skip;
+}
+
 bool CoreChecks::PreCallValidateCmdExecuteCommands(VkCommandBuffer commandBuffer, uint32_t commandBuffersCount,
                                                    const VkCommandBuffer *pCommandBuffers, const ErrorObject &error_obj) const {
     const auto &cb_state = *GetRead<vvl::CommandBuffer>(commandBuffer);
@@ -875,392 +1354,7 @@ bool CoreChecks::PreCallValidateCmdExecuteCommands(VkCommandBuffer commandBuffer
             skip |= viewport_scissor_inheritance.VisitSecondary(i, cb_loc, sub_cb_state);
         }
 
-        if (!sub_cb_state.IsSeconary()) {
-            const LogObjectList objlist(commandBuffer, pCommandBuffers[i]);
-            skip |= LogError("VUID-vkCmdExecuteCommands-pCommandBuffers-00088", objlist, cb_loc,
-                             "(%s) is not VK_COMMAND_BUFFER_LEVEL_SECONDARY.", FormatHandle(pCommandBuffers[i]).c_str());
-        } else {
-            if (!cb_state.activeRenderPass) {
-                if (sub_cb_state.beginInfo.flags & VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT) {
-                    const LogObjectList objlist(commandBuffer, pCommandBuffers[i]);
-                    skip |= LogError("VUID-vkCmdExecuteCommands-pCommandBuffers-00100", objlist, cb_loc,
-                                     "(%s) is executed outside a render pass "
-                                     "instance scope, but the Secondary Command Buffer does have the "
-                                     "VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT set in VkCommandBufferBeginInfo::flags when "
-                                     "the vkBeginCommandBuffer() was called.",
-                                     FormatHandle(pCommandBuffers[i]).c_str());
-                }
-            } else if (sub_cb_state.beginInfo.pInheritanceInfo != nullptr) {
-                const uint32_t inheritance_subpass = sub_cb_state.beginInfo.pInheritanceInfo->subpass;
-                const VkRenderPass inheritance_render_pass = sub_cb_state.beginInfo.pInheritanceInfo->renderPass;
-                if (!(sub_cb_state.beginInfo.flags & VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT)) {
-                    const LogObjectList objlist(pCommandBuffers[i], cb_state.activeRenderPass->Handle());
-                    skip |= LogError("VUID-vkCmdExecuteCommands-pCommandBuffers-00096", objlist, cb_loc,
-                                     "(%s) is executed within a %s "
-                                     "instance scope, but the Secondary Command Buffer does not have the "
-                                     "VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT set in VkCommandBufferBeginInfo::flags when "
-                                     "the vkBeginCommandBuffer() was called.",
-                                     FormatHandle(pCommandBuffers[i]).c_str(),
-                                     FormatHandle(cb_state.activeRenderPass->Handle()).c_str());
-                } else if (sub_cb_state.beginInfo.flags & VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT) {
-                    if (!cb_state.activeRenderPass->UsesDynamicRendering()) {
-                        // Make sure render pass is compatible with parent command buffer pass if secondary command buffer has
-                        // "render pass continue" usage flag
-                        auto secondary_rp_state = Get<vvl::RenderPass>(inheritance_render_pass);
-                        if (secondary_rp_state && (cb_state.activeRenderPass->VkHandle() != secondary_rp_state->VkHandle())) {
-                            skip |= ValidateRenderPassCompatibility(cb_state.Handle(), *cb_state.activeRenderPass.get(),
-                                                                    secondary_rp_state->Handle(), *secondary_rp_state.get(), cb_loc,
-                                                                    "VUID-vkCmdExecuteCommands-pBeginInfo-06020");
-                        }
-                        //  If framebuffer for secondary CB is not NULL, then it must match active FB from primaryCB
-                        skip |= ValidateInheritanceInfoFramebuffer(commandBuffer, cb_state, pCommandBuffers[i], sub_cb_state,
-                                                                   error_obj.location);
-                    }
-                    // Inherit primary's activeFramebuffer, or null if using dynamic rendering,
-                    // and while running validate functions
-                    for (auto &function : sub_cb_state.cmd_execute_commands_functions) {
-                        skip |= function(sub_cb_state, &cb_state, cb_state.activeFramebuffer.get());
-                    }
-                }
-
-                if ((sub_cb_state.beginInfo.flags & VK_COMMAND_BUFFER_USAGE_SIMULTANEOUS_USE_BIT) &&
-                    !enabled_features.nestedCommandBufferSimultaneousUse) {
-                    skip |=
-                        LogError("VUID-vkCmdExecuteCommands-nestedCommandBufferSimultaneousUse-09378", pCommandBuffers[i], cb_loc,
-                                 "(%s) was recorded with VkCommandBufferBeginInfo::flag including "
-                                 "VK_COMMAND_BUFFER_USAGE_SIMULTANEOUS_USE_BIT, but the nestedCommandBufferSimultaneousUse feature "
-                                 "was not enabled.",
-                                 FormatHandle(pCommandBuffers[i]).c_str());
-                }
-
-                if (!cb_state.activeRenderPass->UsesDynamicRendering() && (cb_state.GetActiveSubpass() != inheritance_subpass)) {
-                    const LogObjectList objlist(commandBuffer, pCommandBuffers[i], cb_state.activeRenderPass->Handle());
-                    skip |= LogError("VUID-vkCmdExecuteCommands-pCommandBuffers-06019", objlist, cb_loc,
-                                     "(%s) is executed within a %s "
-                                     "instance scope begun by vkCmdBeginRenderPass(), but "
-                                     "VkCommandBufferInheritanceInfo::subpass (%" PRIu32
-                                     ") does not "
-                                     "match the current subpass (%" PRIu32 ").",
-                                     FormatHandle(pCommandBuffers[i]).c_str(),
-                                     FormatHandle(cb_state.activeRenderPass->Handle()).c_str(), inheritance_subpass,
-                                     cb_state.GetActiveSubpass());
-                } else if (cb_state.activeRenderPass->UsesDynamicRendering()) {
-                    if (inheritance_render_pass != VK_NULL_HANDLE) {
-                        const LogObjectList objlist(commandBuffer, pCommandBuffers[i], cb_state.activeRenderPass->Handle());
-                        skip |= LogError("VUID-vkCmdExecuteCommands-pBeginInfo-06025", objlist, cb_loc,
-                                         "(%s) is executed within a dynamic renderpass instance scope begun "
-                                         "by vkCmdBeginRendering(), but "
-                                         "VkCommandBufferInheritanceInfo::pInheritanceInfo::renderPass is not VK_NULL_HANDLE.",
-                                         FormatHandle(pCommandBuffers[i]).c_str());
-                    }
-
-                    if (cb_state.activeRenderPass->use_dynamic_rendering && sub_cb_state.activeRenderPass &&
-                        sub_cb_state.activeRenderPass->use_dynamic_rendering_inherited) {
-                        const auto rendering_info = cb_state.activeRenderPass->dynamic_rendering_begin_rendering_info;
-                        const auto inheritance_rendering_info = sub_cb_state.activeRenderPass->inheritance_rendering_info;
-                        if ((inheritance_rendering_info.flags &
-                             ~(VK_RENDERING_CONTENTS_SECONDARY_COMMAND_BUFFERS_BIT_KHR | VK_RENDERING_CONTENTS_INLINE_BIT_EXT)) !=
-                            (rendering_info.flags &
-                             ~(VK_RENDERING_CONTENTS_SECONDARY_COMMAND_BUFFERS_BIT_KHR | VK_RENDERING_CONTENTS_INLINE_BIT_EXT))) {
-                            const LogObjectList objlist(commandBuffer, pCommandBuffers[i], cb_state.activeRenderPass->Handle());
-                            skip |=
-                                LogError("VUID-vkCmdExecuteCommands-flags-06026", objlist, cb_loc,
-                                         "(%s) is executed within a dynamic renderpass instance scope begun "
-                                         "by vkCmdBeginRendering(), but VkCommandBufferInheritanceRenderingInfo::flags (%s) does "
-                                         "not match VkRenderingInfo::flags (%s) (excluding "
-                                         "VK_RENDERING_CONTENTS_SECONDARY_COMMAND_BUFFERS_BIT_KHR or "
-                                         "VK_RENDERING_CONTENTS_INLINE_BIT_EXT).",
-                                         FormatHandle(pCommandBuffers[i]).c_str(),
-                                         string_VkRenderingFlags(inheritance_rendering_info.flags).c_str(),
-                                         string_VkRenderingFlags(rendering_info.flags).c_str());
-                        }
-
-                        if (inheritance_rendering_info.colorAttachmentCount != rendering_info.colorAttachmentCount) {
-                            const LogObjectList objlist(commandBuffer, pCommandBuffers[i], cb_state.activeRenderPass->Handle());
-                            skip |= LogError("VUID-vkCmdExecuteCommands-colorAttachmentCount-06027", objlist, cb_loc,
-                                             "(%s) is executed within a dynamic renderpass instance scope begun "
-                                             "by vkCmdBeginRendering(), but "
-                                             "VkCommandBufferInheritanceRenderingInfo::colorAttachmentCount (%" PRIu32
-                                             ") does "
-                                             "not match VkRenderingInfo::colorAttachmentCount (%" PRIu32 ").",
-                                             FormatHandle(pCommandBuffers[i]).c_str(),
-                                             inheritance_rendering_info.colorAttachmentCount, rendering_info.colorAttachmentCount);
-                        }
-
-                        for (uint32_t color_i = 0, count = std::min(inheritance_rendering_info.colorAttachmentCount,
-                                                                    rendering_info.colorAttachmentCount);
-                             color_i < count; color_i++) {
-                            if (rendering_info.pColorAttachments[color_i].imageView == VK_NULL_HANDLE) {
-                                if (inheritance_rendering_info.pColorAttachmentFormats[color_i] != VK_FORMAT_UNDEFINED) {
-                                    const LogObjectList objlist(commandBuffer, pCommandBuffers[i],
-                                                                cb_state.activeRenderPass->Handle());
-                                    skip |= LogError("VUID-vkCmdExecuteCommands-imageView-07606", objlist, cb_loc,
-                                                     "(%s) is executed within a dynamic render pass instance "
-                                                     "scope begun "
-                                                     "by vkCmdBeginRendering(), VkRenderingInfo::pColorAttachments[%" PRIu32
-                                                     "].imageView is VK_NULL_HANDLE but "
-                                                     "VkCommandBufferInheritanceRenderingInfo::pColorAttachmentFormats[%" PRIu32
-                                                     "] is %s.",
-                                                     FormatHandle(pCommandBuffers[i]).c_str(), color_i, color_i,
-                                                     string_VkFormat(inheritance_rendering_info.pColorAttachmentFormats[color_i]));
-                                }
-                            } else {
-                                auto image_view_state = Get<vvl::ImageView>(rendering_info.pColorAttachments[color_i].imageView);
-
-                                if (image_view_state && image_view_state->create_info.format !=
-                                                            inheritance_rendering_info.pColorAttachmentFormats[color_i]) {
-                                    const LogObjectList objlist(commandBuffer, pCommandBuffers[i],
-                                                                cb_state.activeRenderPass->Handle());
-                                    skip |= LogError("VUID-vkCmdExecuteCommands-imageView-06028", objlist, cb_loc,
-                                                     "(%s) is executed within a dynamic render pass instance "
-                                                     "scope begun "
-                                                     "by vkCmdBeginRendering(), VkRenderingInfo::pColorAttachments[%" PRIu32
-                                                     "].imageView format is %s but "
-                                                     "VkCommandBufferInheritanceRenderingInfo::pColorAttachmentFormats[%" PRIu32
-                                                     "] is %s.",
-                                                     FormatHandle(pCommandBuffers[i]).c_str(), color_i,
-                                                     string_VkFormat(image_view_state->create_info.format), color_i,
-                                                     string_VkFormat(inheritance_rendering_info.pColorAttachmentFormats[color_i]));
-                                }
-                            }
-                        }
-
-                        if ((rendering_info.pDepthAttachment != nullptr) &&
-                            rendering_info.pDepthAttachment->imageView != VK_NULL_HANDLE) {
-                            auto image_view_state = Get<vvl::ImageView>(rendering_info.pDepthAttachment->imageView);
-
-                            if (image_view_state &&
-                                image_view_state->create_info.format != inheritance_rendering_info.depthAttachmentFormat) {
-                                const LogObjectList objlist(commandBuffer, pCommandBuffers[i], cb_state.activeRenderPass->Handle());
-                                skip |= LogError("VUID-vkCmdExecuteCommands-pDepthAttachment-06029", objlist, cb_loc,
-                                                 "(%s) is executed within a dynamic renderpass "
-                                                 "instance scope begun "
-                                                 "by vkCmdBeginRendering(), but "
-                                                 "VkCommandBufferInheritanceRenderingInfo::depthAttachmentFormat does "
-                                                 "not match the format of the imageView in VkRenderingInfo::pDepthAttachment.",
-                                                 FormatHandle(pCommandBuffers[i]).c_str());
-                            }
-                        }
-
-                        if ((rendering_info.pStencilAttachment != nullptr) &&
-                            rendering_info.pStencilAttachment->imageView != VK_NULL_HANDLE) {
-                            auto image_view_state = Get<vvl::ImageView>(rendering_info.pStencilAttachment->imageView);
-
-                            if (image_view_state &&
-                                image_view_state->create_info.format != inheritance_rendering_info.stencilAttachmentFormat) {
-                                const LogObjectList objlist(commandBuffer, pCommandBuffers[i], cb_state.activeRenderPass->Handle());
-                                skip |= LogError("VUID-vkCmdExecuteCommands-pStencilAttachment-06030", objlist, cb_loc,
-                                                 "(%s) is executed within a dynamic renderpass "
-                                                 "instance scope begun "
-                                                 "by vkCmdBeginRendering(), but "
-                                                 "VkCommandBufferInheritanceRenderingInfo::stencilAttachmentFormat does "
-                                                 "not match the format of the imageView in VkRenderingInfo::pStencilAttachment.",
-                                                 FormatHandle(pCommandBuffers[i]).c_str());
-                            }
-                        }
-
-                        if (rendering_info.pDepthAttachment == nullptr ||
-                            rendering_info.pDepthAttachment->imageView == VK_NULL_HANDLE) {
-                            VkFormat format = inheritance_rendering_info.depthAttachmentFormat;
-                            if (format != VK_FORMAT_UNDEFINED) {
-                                const LogObjectList objlist(commandBuffer, pCommandBuffers[i], cb_state.activeRenderPass->Handle());
-                                skip |= LogError("VUID-vkCmdExecuteCommands-pDepthAttachment-06774", objlist, cb_loc,
-                                                 "(%s) is executed within a dynamic renderpass "
-                                                 "instance scope begun by vkCmdBeginRendering(), and "
-                                                 "VkRenderingInfo::pDepthAttachment does not define an "
-                                                 "image view but VkCommandBufferInheritanceRenderingInfo::depthAttachmentFormat "
-                                                 "is %s instead of VK_FORMAT_UNDEFINED.",
-                                                 FormatHandle(pCommandBuffers[i]).c_str(), string_VkFormat(format));
-                            }
-                        }
-
-                        if (rendering_info.pStencilAttachment == nullptr ||
-                            rendering_info.pStencilAttachment->imageView == VK_NULL_HANDLE) {
-                            VkFormat format = inheritance_rendering_info.stencilAttachmentFormat;
-                            if (format != VK_FORMAT_UNDEFINED) {
-                                const LogObjectList objlist(commandBuffer, pCommandBuffers[i], cb_state.activeRenderPass->Handle());
-                                skip |= LogError("VUID-vkCmdExecuteCommands-pStencilAttachment-06775", objlist, cb_loc,
-                                                 "(%s) is executed within a dynamic renderpass "
-                                                 "instance scope begun by vkCmdBeginRendering(), and "
-                                                 "VkRenderingInfo::pStencilAttachment does not define an "
-                                                 "image view but VkCommandBufferInheritanceRenderingInfo::stencilAttachmentFormat "
-                                                 "is %s instead of VK_FORMAT_UNDEFINED.",
-                                                 FormatHandle(pCommandBuffers[i]).c_str(), string_VkFormat(format));
-                            }
-                        }
-
-                        if (rendering_info.viewMask != inheritance_rendering_info.viewMask) {
-                            const LogObjectList objlist(commandBuffer, pCommandBuffers[i], cb_state.activeRenderPass->Handle());
-                            skip |= LogError("VUID-vkCmdExecuteCommands-viewMask-06031", objlist, cb_loc,
-                                             "(%s) is executed within a dynamic renderpass instance scope begun "
-                                             "by vkCmdBeginRendering(), but "
-                                             "VkCommandBufferInheritanceRenderingInfo::viewMask (%" PRIu32
-                                             ") does "
-                                             "not match VkRenderingInfo::viewMask (%" PRIu32 ").",
-                                             FormatHandle(pCommandBuffers[i]).c_str(), inheritance_rendering_info.viewMask,
-                                             rendering_info.viewMask);
-                        }
-
-                        // VkAttachmentSampleCountInfoAMD == VkAttachmentSampleCountInfoNV
-                        const auto amd_sample_count =
-                            vku::FindStructInPNextChain<VkAttachmentSampleCountInfoAMD>(inheritance_rendering_info.pNext);
-
-                        if (amd_sample_count) {
-                            for (uint32_t index = 0; index < rendering_info.colorAttachmentCount; index++) {
-                                if (rendering_info.pColorAttachments[index].imageView == VK_NULL_HANDLE) {
-                                    continue;
-                                }
-                                auto image_view_state = Get<vvl::ImageView>(rendering_info.pColorAttachments[index].imageView);
-
-                                if (image_view_state &&
-                                    image_view_state->samples != amd_sample_count->pColorAttachmentSamples[index]) {
-                                    const LogObjectList objlist(commandBuffer, pCommandBuffers[i],
-                                                                cb_state.activeRenderPass->Handle());
-                                    skip |= LogError(
-                                        "VUID-vkCmdExecuteCommands-pNext-06032", objlist, cb_loc,
-                                        "(%s) is executed within a dynamic renderpass instance "
-                                        "scope begun "
-                                        "by vkCmdBeginRenderingKHR(), but "
-                                        "VkAttachmentSampleCountInfo(AMD/NV)::pColorAttachmentSamples at index (%" PRIu32
-                                        ") "
-                                        "does "
-                                        "not match the sample count of the imageView in VkRenderingInfoKHR::pColorAttachments.",
-                                        FormatHandle(pCommandBuffers[i]).c_str(), index);
-                                }
-                            }
-
-                            if ((rendering_info.pDepthAttachment != nullptr) &&
-                                rendering_info.pDepthAttachment->imageView != VK_NULL_HANDLE) {
-                                auto image_view_state = Get<vvl::ImageView>(rendering_info.pDepthAttachment->imageView);
-
-                                if (image_view_state &&
-                                    image_view_state->samples != amd_sample_count->depthStencilAttachmentSamples) {
-                                    const LogObjectList objlist(commandBuffer, pCommandBuffers[i],
-                                                                cb_state.activeRenderPass->Handle());
-                                    skip |= LogError(
-                                        "VUID-vkCmdExecuteCommands-pNext-06033", objlist, cb_loc,
-                                        "(%s) is executed within a dynamic renderpass instance "
-                                        "scope begun "
-                                        "by vkCmdBeginRenderingKHR(), but "
-                                        "VkAttachmentSampleCountInfo(AMD/NV)::depthStencilAttachmentSamples does "
-                                        "not match the sample count of the imageView in VkRenderingInfoKHR::pDepthAttachment.",
-                                        FormatHandle(pCommandBuffers[i]).c_str());
-                                }
-                            }
-
-                            if ((rendering_info.pStencilAttachment != nullptr) &&
-                                rendering_info.pStencilAttachment->imageView != VK_NULL_HANDLE) {
-                                auto image_view_state = Get<vvl::ImageView>(rendering_info.pStencilAttachment->imageView);
-
-                                if (image_view_state &&
-                                    image_view_state->samples != amd_sample_count->depthStencilAttachmentSamples) {
-                                    const LogObjectList objlist(commandBuffer, pCommandBuffers[i],
-                                                                cb_state.activeRenderPass->Handle());
-                                    skip |= LogError(
-                                        "VUID-vkCmdExecuteCommands-pNext-06034", objlist, cb_loc,
-                                        "(%s) is executed within a dynamic renderpass instance "
-                                        "scope begun "
-                                        "by vkCmdBeginRenderingKHR(), but "
-                                        "VkAttachmentSampleCountInfo(AMD/NV)::depthStencilAttachmentSamples does "
-                                        "not match the sample count of the imageView in VkRenderingInfoKHR::pStencilAttachment.",
-                                        FormatHandle(pCommandBuffers[i]).c_str());
-                                }
-                            }
-                        } else {
-                            for (uint32_t index = 0; index < rendering_info.colorAttachmentCount; index++) {
-                                if (rendering_info.pColorAttachments[index].imageView == VK_NULL_HANDLE) {
-                                    continue;
-                                }
-                                auto image_view_state = Get<vvl::ImageView>(rendering_info.pColorAttachments[index].imageView);
-
-                                if (image_view_state &&
-                                    image_view_state->samples != inheritance_rendering_info.rasterizationSamples) {
-                                    const LogObjectList objlist(commandBuffer, pCommandBuffers[i],
-                                                                cb_state.activeRenderPass->Handle());
-                                    skip |= LogError(
-                                        "VUID-vkCmdExecuteCommands-pNext-06035", objlist, cb_loc,
-                                        "(%s) is executed within a dynamic renderpass instance "
-                                        "scope begun "
-                                        "by vkCmdBeginRenderingKHR(), but the sample count of the image view at index (%" PRIu32
-                                        ") of "
-                                        "VkRenderingInfoKHR::pColorAttachments does not match "
-                                        "VkCommandBufferInheritanceRenderingInfo::rasterizationSamples.",
-                                        FormatHandle(pCommandBuffers[i]).c_str(), index);
-                                }
-                            }
-
-                            if ((rendering_info.pDepthAttachment != nullptr) &&
-                                rendering_info.pDepthAttachment->imageView != VK_NULL_HANDLE) {
-                                auto image_view_state = Get<vvl::ImageView>(rendering_info.pDepthAttachment->imageView);
-
-                                if (image_view_state &&
-                                    image_view_state->samples != inheritance_rendering_info.rasterizationSamples) {
-                                    const LogObjectList objlist(commandBuffer, pCommandBuffers[i],
-                                                                cb_state.activeRenderPass->Handle());
-                                    skip |= LogError("VUID-vkCmdExecuteCommands-pNext-06036", objlist, cb_loc,
-                                                     "(%s) is executed within a dynamic renderpass "
-                                                     "instance scope begun "
-                                                     "by vkCmdBeginRenderingKHR(), but the sample count of the image view for "
-                                                     "VkRenderingInfoKHR::pDepthAttachment does not match "
-                                                     "VkCommandBufferInheritanceRenderingInfo::rasterizationSamples.",
-                                                     FormatHandle(pCommandBuffers[i]).c_str());
-                                }
-                            }
-
-                            if ((rendering_info.pStencilAttachment != nullptr) &&
-                                rendering_info.pStencilAttachment->imageView != VK_NULL_HANDLE) {
-                                auto image_view_state = Get<vvl::ImageView>(rendering_info.pStencilAttachment->imageView);
-
-                                if (image_view_state &&
-                                    image_view_state->samples != inheritance_rendering_info.rasterizationSamples) {
-                                    const LogObjectList objlist(commandBuffer, pCommandBuffers[i],
-                                                                cb_state.activeRenderPass->Handle());
-                                    skip |= LogError("VUID-vkCmdExecuteCommands-pNext-06037", objlist, cb_loc,
-                                                     "(%s) is executed within a dynamic renderpass "
-                                                     "instance scope begun "
-                                                     "by vkCmdBeginRenderingKHR(), but the sample count of the image view for "
-                                                     "VkRenderingInfoKHR::pStencilAttachment does not match "
-                                                     "VkCommandBufferInheritanceRenderingInfo::rasterizationSamples.",
-                                                     FormatHandle(pCommandBuffers[i]).c_str());
-                                }
-                            }
-                        }
-                    }
-                }
-
-                // spec: "A maxCommandBufferNestingLevel of UINT32_MAX means there is no limit to the nesting level"
-                if (enabled_features.nestedCommandBuffer &&
-                    phys_dev_ext_props.nested_command_buffer_props.maxCommandBufferNestingLevel != UINT32_MAX) {
-                    if (sub_cb_state.nesting_level >= phys_dev_ext_props.nested_command_buffer_props.maxCommandBufferNestingLevel) {
-                        skip |= LogError("VUID-vkCmdExecuteCommands-nestedCommandBuffer-09376", pCommandBuffers[i], cb_loc,
-                                         "(%s) has a nesting level of %" PRIu32
-                                         " which is not less then maxCommandBufferNestingLevel (%" PRIu32 ").",
-                                         FormatHandle(pCommandBuffers[i]).c_str(), sub_cb_state.nesting_level,
-                                         phys_dev_ext_props.nested_command_buffer_props.maxCommandBufferNestingLevel);
-                    }
-                }
-            }
-        }
-
-        // TODO(mlentine): Move more logic into this method
-        skip |= ValidateSecondaryCommandBufferState(cb_state, sub_cb_state, cb_loc);
-        skip |= ValidateCommandBufferState(sub_cb_state, cb_loc, 0, "VUID-vkCmdExecuteCommands-pCommandBuffers-00089");
         if (!(sub_cb_state.beginInfo.flags & VK_COMMAND_BUFFER_USAGE_SIMULTANEOUS_USE_BIT)) {
-            if (sub_cb_state.InUse()) {
-                const LogObjectList objlist(commandBuffer, pCommandBuffers[i]);
-                skip |= LogError("VUID-vkCmdExecuteCommands-pCommandBuffers-00091", objlist, cb_loc,
-                                 "Cannot execute pending %s without VK_COMMAND_BUFFER_USAGE_SIMULTANEOUS_USE_BIT set.",
-                                 FormatHandle(pCommandBuffers[i]).c_str());
-            }
-            // We use an const_cast, because one cannot query a container keyed on a non-const pointer using a const pointer
-            if (cb_state.linkedCommandBuffers.count(const_cast<vvl::CommandBuffer *>(&sub_cb_state))) {
-                const LogObjectList objlist(commandBuffer, pCommandBuffers[i]);
-                skip |= LogError("VUID-vkCmdExecuteCommands-pCommandBuffers-00092", objlist, cb_loc,
-                                 "Cannot execute %s without VK_COMMAND_BUFFER_USAGE_SIMULTANEOUS_USE_BIT "
-                                 "set if previously executed in %s",
-                                 FormatHandle(pCommandBuffers[i]).c_str(), FormatHandle(commandBuffer).c_str());
-            }
-
             const auto insert_pair = linked_command_buffers.insert(&sub_cb_state);
             if (!insert_pair.second) {
                 const LogObjectList objlist(commandBuffer, pCommandBuffers[i]);
@@ -1270,97 +1364,33 @@ bool CoreChecks::PreCallValidateCmdExecuteCommands(VkCommandBuffer commandBuffer
                                  FormatHandle(commandBuffer).c_str());
             }
         }
-        if (!cb_state.activeQueries.empty() && !enabled_features.inheritedQueries) {
-            const LogObjectList objlist(commandBuffer, pCommandBuffers[i]);
-            skip |= LogError("VUID-vkCmdExecuteCommands-commandBuffer-00101", objlist, cb_loc,
-                             "cannot be submitted with a query in flight and "
-                             "inherited queries not supported on this device.");
-        }
-        // Validate initial layout uses vs. the primary cmd buffer state
-        // Novel Valid usage: "UNASSIGNED-vkCmdExecuteCommands-commandBuffer-00001"
-        // initial layout usage of secondary command buffers resources must match parent command buffer
-        for (const auto &sub_layout_map_entry : sub_cb_state.image_layout_map) {
-            const auto image = sub_layout_map_entry.first;
-
-            const auto cb_subres_map = cb_state.GetImageSubresourceLayoutMap(image);
-            // Const getter can be null in which case we have nothing to check against for this image...
-            if (!cb_subres_map) continue;
-
-            const auto &sub_layout_map = sub_layout_map_entry.second.map->GetLayoutMap();
-            const auto &cb_layout_map = cb_subres_map->GetLayoutMap();
-            for (sparse_container::parallel_iterator<const ImageSubresourceLayoutMap::LayoutMap> iter(sub_layout_map, cb_layout_map,
-                                                                                                      0);
-                 !iter->range.empty(); ++iter) {
-                VkImageLayout cb_layout = kInvalidLayout, sub_layout = kInvalidLayout;
-                const char *layout_type;
-
-                if (!iter->pos_A->valid || !iter->pos_B->valid) continue;
-
-                // pos_A denotes the sub CB map in the parallel iterator
-                sub_layout = iter->pos_A->lower_bound->second.initial_layout;
-                if (VK_IMAGE_LAYOUT_UNDEFINED == sub_layout) continue;  // secondary doesn't care about current or initial
-
-                // pos_B denotes the main CB map in the parallel iterator
-                const auto &cb_layout_state = iter->pos_B->lower_bound->second;
-                if (cb_layout_state.current_layout != kInvalidLayout) {
-                    layout_type = "current";
-                    cb_layout = cb_layout_state.current_layout;
-                } else if (cb_layout_state.initial_layout != kInvalidLayout) {
-                    layout_type = "initial";
-                    cb_layout = cb_layout_state.initial_layout;
-                } else {
-                    continue;
-                }
-                if (sub_layout != cb_layout) {
-                    // We can report all the errors for the intersected range directly
-                    for (auto index = iter->range.begin; index < iter->range.end; index++) {
-                        const LogObjectList objlist(commandBuffer, pCommandBuffers[i]);
-                        const auto image_state = Get<vvl::Image>(image);
-                        if (!image_state) continue;
-                        const auto subresource = image_state->subresource_encoder.Decode(index);
-                        // VU being worked on https://gitlab.khronos.org/vulkan/vulkan/-/issues/2456
-                        skip |= LogError("UNASSIGNED-vkCmdExecuteCommands-commandBuffer-00001", objlist, cb_loc,
-                                         "was executed using %s (subresource: aspectMask 0x%x array layer %" PRIu32
-                                         ", mip level %" PRIu32 ") which expects layout %s--instead, image %s layout is %s.",
-                                         FormatHandle(image).c_str(), subresource.aspectMask, subresource.arrayLayer,
-                                         subresource.mipLevel, string_VkImageLayout(sub_layout), layout_type,
-                                         string_VkImageLayout(cb_layout));
-                    }
-                }
-            }
-        }
+    }
 
-        // All commands buffers involved must be protected or unprotected
-        if ((cb_state.unprotected == false) && (sub_cb_state.unprotected == true)) {
-            const LogObjectList objlist(commandBuffer, pCommandBuffers[i]);
-            skip |= LogError("VUID-vkCmdExecuteCommands-commandBuffer-01820", objlist, cb_loc,
-                             "(%s) is a unprotected while primary command buffer (%s) is protected.",
-                             FormatHandle(pCommandBuffers[i]).c_str(), FormatHandle(commandBuffer).c_str());
-        } else if ((cb_state.unprotected == true) && (sub_cb_state.unprotected == false)) {
-            const LogObjectList objlist(commandBuffer, pCommandBuffers[i]);
-            skip |= LogError("VUID-vkCmdExecuteCommands-commandBuffer-01821", objlist, cb_loc,
-                             "(%s) is a protected while primary command buffer (%s) is unprotected.",
-                             FormatHandle(pCommandBuffers[i]).c_str(), FormatHandle(commandBuffer).c_str());
+    // The other checks of a secondary only read it and the primary, so they are independent of each other. Renderers recording
+    // secondaries in parallel execute hundreds of them at once: those are validated on the device thread pool, each secondary
+    // logging to its own buffer. The buffers are reported in pCommandBuffers order, on this thread.
+    const uint32_t worker_count =
+        vvl::GetParallelWorkerCount(commandBuffersCount, kMinSecondariesPerWorker, kMaxExecuteCommandsWorkers);
+    if (!thread_pool || worker_count <= 1) {
+        for (uint32_t i = 0; i < commandBuffersCount; i++) {
+            const auto &sub_cb_state = *GetRead<vvl::CommandBuffer>(pCommandBuffers[i]);
+            const Location cb_loc = error_obj.location.dot(Field::pCommandBuffers, i);
+            skip |= ValidateExecutedSecondary(cb_state, sub_cb_state, active_occlusion_query, cb_loc, error_obj.location);
         }
-        if (active_occlusion_query) {
-            if (sub_cb_state.inheritanceInfo.occlusionQueryEnable != VK_TRUE) {
-                const LogObjectList objlist(commandBuffer, pCommandBuffers[i]);
-                skip |= LogError("VUID-vkCmdExecuteCommands-commandBuffer-00102", objlist, cb_loc,
-                                 "(%s) was recorded with VkCommandBufferInheritanceInfo::occlusionQueryEnable set to VK_FALSE, but "
-                                 "primary command buffer %s has an active occlusion query",
-                                 FormatHandle(pCommandBuffers[i]).c_str(), FormatHandle(commandBuffer).c_str());
-            }
-            if ((sub_cb_state.inheritanceInfo.queryFlags & active_occlusion_query->control_flags) !=
-                active_occlusion_query->control_flags) {
-                const LogObjectList objlist(commandBuffer, pCommandBuffers[i]);
-                skip |= LogError("VUID-vkCmdExecuteCommands-commandBuffer-00103", objlist, cb_loc,
-                                 "(%s) was recorded with VkCommandBufferInheritanceInfo::queryFlags %s, but primary command buffer "
-                                 "%s has an active occlusion query with VkQueryControlFlags %s.",
-                                 FormatHandle(pCommandBuffers[i]).c_str(),
-                                 string_VkQueryControlFlags(sub_cb_state.inheritanceInfo.queryFlags).c_str(),
-                                 FormatHandle(commandBuffer).c_str(),
-                                 string_VkQueryControlFlags(active_occlusion_query->control_flags).c_str());
-            }
+    } else {
+        std::vector<MessageBuffer> messages(commandBuffersCount);
+        // Not std::vector<bool>, each worker writes its own elements
+        std::vector<uint8_t> secondary_skip(commandBuffersCount, 0);
+        vvl::ParallelFor(thread_pool, commandBuffersCount, worker_count, [&](uint32_t i) {
+            ScopedMessageBuffer scoped_buffer(*debug_report, messages[i]);
+            const auto &sub_cb_state = *GetRead<vvl::CommandBuffer>(pCommandBuffers[i]);
+            const Location cb_loc = error_obj.location.dot(Field::pCommandBuffers, i);
+            secondary_skip[i] =
+                ValidateExecutedSecondary(cb_state, sub_cb_state, active_occlusion_query, cb_loc, error_obj.location) ? 1 : 0;
+        });
+        for (uint32_t i = 0; i < commandBuffersCount; i++) {
+            skip |= secondary_skip[i] != 0;
+            skip |= debug_report->LogBufferedMessages(messages[i]);
         }
     }
 
@@ -306,8 +306,7 @@ bool CoreChecks::ValidateGraphicsDynamicStateValue(const LastBound& last_bound_s
     const LogObjectList objlist(cb_state.Handle(), pipeline.Handle());
 
     // vkCmdSetDiscardRectangleEXT needs to be set on each rectangle
-    const auto* discard_rectangle_state =
-        vku::FindStructInPNextChain<VkPipelineDiscardRectangleStateCreateInfoEXT>(pipeline.GraphicsCreateInfo().pNext);
+    const auto* discard_rectangle_state = pipeline.GetCreateInfoPNext<VkPipelineDiscardRectangleStateCreateInfoEXT>();
     if (discard_rectangle_state && pipeline.IsDynamic(CB_DYNAMIC_STATE_DISCARD_RECTANGLE_EXT)) {
         for (uint32_t i = 0; i < discard_rectangle_state->discardRectangleCount; i++) {
             if (!cb_state.dynamic_state_value.discard_rectangles.test(i)) {
@@ -1022,8 +1021,7 @@ bool CoreChecks::ValidateDrawRenderingAttachmentLocation(const vvl::CommandBuffe
     // Default from spec
     uint32_t pipeline_color_count = 0;
     const uint32_t* pipeline_color_locations = nullptr;
-    if (const auto* pipeline_location_info =
-            vku::FindStructInPNextChain<VkRenderingAttachmentLocationInfoKHR>(pipeline_state.GraphicsCreateInfo().pNext)) {
+    if (const auto* pipeline_location_info = pipeline_state.GetCreateInfoPNext<VkRenderingAttachmentLocationInfoKHR>()) {
         pipeline_color_count = pipeline_location_info->colorAttachmentCount;
         pipeline_color_locations = pipeline_location_info->pColorAttachmentLocations;
     } else if (const auto* pipeline_rendering_create_info = pipeline_state.GetPipelineRenderingCreateInfo()) {
@@ -1068,8 +1066,7 @@ bool CoreChecks::ValidateDrawRenderingInputAttachmentIndex(const vvl::CommandBuf
     const uint32_t* pipeline_color_indexes = nullptr;
     const uint32_t* pipeline_depth_index = nullptr;
     const uint32_t* pipeline_stencil_index = nullptr;
-    if (const auto* pipeline_index_info =
-            vku::FindStructInPNextChain<VkRenderingInputAttachmentIndexInfoKHR>(pipeline_state.GraphicsCreateInfo().pNext)) {
+    if (const auto* pipeline_index_info = pipeline_state.GetCreateInfoPNext<VkRenderingInputAttachmentIndexInfoKHR>()) {
         pipeline_color_count = pipeline_index_info->colorAttachmentCount;
         pipeline_color_indexes = pipeline_index_info->pColorAttachmentInputIndices;
         pipeline_depth_index = pipeline_index_info->pDepthInputAttachmentIndex;
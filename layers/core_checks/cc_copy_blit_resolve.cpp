@@ -17,8 +17,12 @@
  * limitations under the License.
  */
 
+#include <algorithm>
+#include <optional>
 #include <string>
 #include <sstream>
+#include <tuple>
+#include <utility>
 #include <vector>
 
 #include "core_validation.h"
@@ -147,6 +151,125 @@ static bool RegionIntersectsBlit(const RegionType *region0, const RegionType *re
     return result;
 }
 
+// Interval covered by a copy region along one axis. Intervals only intersect intervals of the same group (the mip level for
+// images, a single group for buffer memory).
+template <typename T>
+struct RegionInterval {
+    uint32_t group;
+    T begin;
+    T end;
+};
+
+using RegionPairs = std::vector<std::pair<uint32_t, uint32_t>>;
+
+// Sort-and-sweep returning every (source region, destination region) pair whose intervals intersect, sorted by source then
+// destination region, which is the order the nested loops over regions used to visit them in.
+// Intersection follows sparse_container::range::intersects(): an empty interval intersects the intervals containing its begin.
+// Runs in O(n log n + pairs), returns false if more than max_pairs pairs are found.
+template <typename T>
+static bool GetIntersectingRegions(const std::vector<RegionInterval<T>> &src, const std::vector<RegionInterval<T>> &dst,
+                                   size_t max_pairs, RegionPairs &pairs) {
+    struct Event {
+        const RegionInterval<T> *interval;
+        uint32_t region;
+        bool is_src;
+        bool Empty() const { return interval->end <= interval->begin; }
+    };
+    std::vector<Event> events;
+    events.reserve(src.size() + dst.size());
+    for (uint32_t i = 0; i < src.size(); ++i) {
+        events.push_back({&src[i], i, true});
+    }
+    for (uint32_t i = 0; i < dst.size(); ++i) {
+        events.push_back({&dst[i], i, false});
+    }
+    // Empty intervals go after the non empty ones starting at the same place so they are tested against them
+    std::sort(events.begin(), events.end(), [](const Event &a, const Event &b) {
+        const bool a_empty = a.Empty();
+        const bool b_empty = b.Empty();
+        return std::tie(a.interval->group, a.interval->begin, a_empty) < std::tie(b.interval->group, b.interval->begin, b_empty);
+    });
+
+    pairs.clear();
+    // Non empty intervals which began before the current one, [0] for destination and [1] for source intervals
+    std::vector<Event> active[2];
+    const Event *previous = nullptr;
+    for (const Event &event : events) {
+        if (previous && previous->interval->group != event.interval->group) {
+            active[0].clear();
+            active[1].clear();
+        }
+        previous = &event;
+
+        std::vector<Event> &opposite = active[event.is_src ? 0 : 1];
+        for (size_t k = 0; k < opposite.size();) {
+            if (opposite[k].interval->end <= event.interval->begin) {
+                // Ended before the current interval, so before all the following ones of the group
+                opposite[k] = opposite.back();
+                opposite.pop_back();
+                continue;
+            }
+            if (pairs.size() == max_pairs) {
+                return false;
+            }
+            pairs.emplace_back(event.is_src ? event.region : opposite[k].region, event.is_src ? opposite[k].region : event.region);
+            ++k;
+        }
+        if (!event.Empty()) {
+            active[event.is_src ? 1 : 0].push_back(event);
+        }
+    }
+    std::sort(pairs.begin(), pairs.end());
+    return true;
+}
+
+// Sorted (source region, destination region) pairs of a vkCmdCopyImage within a single image which may intersect.
+// Every pair for which GetRegionIntersection() finds an intersection is returned, so callers only have to test those.
+// Regions are swept along the first axis which separates them well, if none does nothing is returned and every pair has to
+// be tested.
+template <typename RegionType>
+static std::optional<RegionPairs> GetImageCopyOverlapCandidates(uint32_t regionCount, const RegionType *pRegions,
+                                                                VkImageType type) {
+    std::vector<RegionInterval<int64_t>> src(regionCount);
+    std::vector<RegionInterval<int64_t>> dst(regionCount);
+    RegionPairs pairs;
+    const size_t max_pairs = 4 * static_cast<size_t>(regionCount);
+    // get_interval(subresource, offset, extent) returns the interval of one side of a region along the axis
+    const auto try_axis = [&](auto &&get_interval) {
+        for (uint32_t i = 0; i < regionCount; ++i) {
+            src[i] = get_interval(pRegions[i].srcSubresource, pRegions[i].srcOffset, pRegions[i].extent);
+            dst[i] = get_interval(pRegions[i].dstSubresource, pRegions[i].dstOffset, pRegions[i].extent);
+        }
+        return GetIntersectingRegions(src, dst, max_pairs, pairs);
+    };
+
+    if (try_axis([](const VkImageSubresourceLayers &subresource, const VkOffset3D &, const VkExtent3D &) {
+            return RegionInterval<int64_t>{subresource.mipLevel, subresource.baseArrayLayer,
+                                           static_cast<int64_t>(subresource.baseArrayLayer) + subresource.layerCount};
+        })) {
+        return pairs;
+    }
+    if ((type == VK_IMAGE_TYPE_1D || type == VK_IMAGE_TYPE_2D || type == VK_IMAGE_TYPE_3D) &&
+        try_axis([](const VkImageSubresourceLayers &subresource, const VkOffset3D &offset, const VkExtent3D &extent) {
+            return RegionInterval<int64_t>{subresource.mipLevel, offset.x, static_cast<int64_t>(offset.x) + extent.width};
+        })) {
+        return pairs;
+    }
+    if ((type == VK_IMAGE_TYPE_2D || type == VK_IMAGE_TYPE_3D) &&
+        try_axis([](const VkImageSubresourceLayers &subresource, const VkOffset3D &offset, const VkExtent3D &extent) {
+            return RegionInterval<int64_t>{subresource.mipLevel, offset.y, static_cast<int64_t>(offset.y) + extent.height};
+        })) {
+        return pairs;
+    }
+    if (type == VK_IMAGE_TYPE_3D &&
+        try_axis([](const VkImageSubresourceLayers &subresource, const VkOffset3D &offset, const VkExtent3D &extent) {
+            return RegionInterval<int64_t>{subresource.mipLevel, offset.z, static_cast<int64_t>(offset.z) + extent.depth};
+        })) {
+        return pairs;
+    }
+    return std::nullopt;
+}
+
 // Test if the extent argument has all dimensions set to 0.
 static inline bool IsExtentAllZeroes(const VkExtent3D &extent) {
     return ((extent.width == 0) && (extent.height == 0) && (extent.depth == 0));
@@ -691,6 +814,30 @@ bool CoreChecks::ValidateCmdCopyBufferBounds(VkCommandBuffer cb, const vvl::Buff
     VkDeviceSize dst_buffer_size = dst_buffer_state.create_info.size;
     const bool are_buffers_sparse = src_buffer_state.sparse || dst_buffer_state.sparse;
 
+    // Non sparse buffers are bound to a single memory range, so the regions can be compared as memory ranges once sorted
+    // instead of comparing every source region to every destination region. If the regions overlap too much to bound the
+    // number of pairs, every pair is compared instead.
+    RegionPairs overlapping_regions;
+    bool compare_all_regions = false;
+    const auto *src_binding = src_buffer_state.Binding();
+    const auto *dst_binding = dst_buffer_state.Binding();
+    if (!are_buffers_sparse && src_binding && dst_binding && src_binding->memory_state == dst_binding->memory_state) {
+        std::vector<RegionInterval<VkDeviceSize>> src_ranges(regionCount);
+        std::vector<RegionInterval<VkDeviceSize>> dst_ranges(regionCount);
+        for (uint32_t i = 0; i < regionCount; i++) {
+            const VkDeviceSize src_begin = src_binding->memory_offset + pRegions[i].srcOffset;
+            const VkDeviceSize dst_begin = dst_binding->memory_offset + pRegions[i].dstOffset;
+            src_ranges[i] = {0, src_begin, src_begin + pRegions[i].size};
+            dst_ranges[i] = {0, dst_begin, dst_begin + pRegions[i].size};
+        }
+        const size_t max_pairs = 4 * static_cast<size_t>(regionCount);
+        if (!GetIntersectingRegions(src_ranges, dst_ranges, max_pairs, overlapping_regions)) {
+            overlapping_regions.clear();
+            compare_all_regions = true;
+        }
+    }
+    auto overlap_it = overlapping_regions.cbegin();
+
     const LogObjectList src_objlist(cb, dst_buffer_state.Handle());
     const LogObjectList dst_objlist(cb, dst_buffer_state.Handle());
     for (uint32_t i = 0; i < regionCount; i++) {
@@ -732,7 +879,7 @@ bool CoreChecks::ValidateCmdCopyBufferBounds(VkCommandBuffer cb, const vvl::Buff
         }
 
         // The union of the source regions, and the union of the destination regions, must not overlap in memory
-        if (!skip && !are_buffers_sparse) {
+        if (!skip && compare_all_regions) {
             auto src_region = sparse_container::range<VkDeviceSize>{region.srcOffset, region.srcOffset + region.size};
             for (uint32_t j = 0; j < regionCount; j++) {
                 auto dst_region =
@@ -743,6 +890,14 @@ bool CoreChecks::ValidateCmdCopyBufferBounds(VkCommandBuffer cb, const vvl::Buff
                     skip |= LogError(vuid, objlist, region_loc, "Detected overlap between source and dest regions in memory.");
                 }
             }
+        } else if (!skip && !are_buffers_sparse) {
+            for (; overlap_it != overlapping_regions.cend() && overlap_it->first < i; ++overlap_it) {
+            }
+            for (; overlap_it != overlapping_regions.cend() && overlap_it->first == i; ++overlap_it) {
+                const LogObjectList objlist(cb, src_buffer_state.Handle(), dst_buffer_state.Handle());
+                vuid = is_2 ? "VUID-VkCopyBufferInfo2-pRegions-00117" : "VUID-vkCmdCopyBuffer-pRegions-00117";
+                skip |= LogError(vuid, objlist, region_loc, "Detected overlap between source and dest regions in memory.");
+            }
         }
     }
 
@@ -1415,6 +1570,14 @@ bool CoreChecks::ValidateCmdCopyImage(VkCommandBuffer commandBuffer, VkImage src
     bool has_stencil_aspect = false;
     bool has_non_stencil_aspect = false;
     const bool same_image = (src_image_state == dst_image_state);
+    std::optional<RegionPairs> overlap_candidates;
+    if (src_image_state->VkHandle() == dst_image_state->VkHandle()) {
+        overlap_candidates = GetImageCopyOverlapCandidates(regionCount, pRegions, src_image_type);
+    }
+    RegionPairs::const_iterator overlap_it;
+    if (overlap_candidates) {
+        overlap_it = overlap_candidates->cbegin();
+    }
     for (uint32_t i = 0; i < regionCount; i++) {
         const Location region_loc = loc.dot(Field::pRegions, i);
         const Location src_subresource_loc = region_loc.dot(Field::srcSubresource);
@@ -1583,7 +1746,7 @@ bool CoreChecks::ValidateCmdCopyImage(VkCommandBuffer commandBuffer, VkImage src
         // In the general case, the mapping between an image and its underlying memory is undefined,
         // so checking for memory overlaps is not possible.
         if (src_image_state->VkHandle() == dst_image_state->VkHandle()) {
-            for (uint32_t j = 0; j < regionCount; j++) {
+            const auto check_overlap = [&](uint32_t j) {
                 if (auto intersection =
                         GetRegionIntersection(region, pRegions[j], src_image_type, vkuFormatIsMultiplane(src_format));
                     intersection.has_instersection) {
@@ -1593,6 +1756,15 @@ bool CoreChecks::ValidateCmdCopyImage(VkCommandBuffer commandBuffer, VkImage src
                                      "] copy destination. Overlap info, with respect to image (%s): %s.",
                                      i, j, FormatHandle(srcImage).c_str(), intersection.String().c_str());
                 }
+            };
+            if (overlap_candidates) {
+                for (; overlap_it != overlap_candidates->cend() && overlap_it->first == i; ++overlap_it) {
+                    check_overlap(overlap_it->second);
+                }
+            } else {
+                for (uint32_t j = 0; j < regionCount; j++) {
+                    check_overlap(j);
+                }
             }
         }
 
@@ -1373,10 +1373,15 @@ bool CoreChecks::ValidateUpdateDescriptorSets(uint32_t descriptorWriteCount, con
                                               const Location &loc) const {
     bool skip = false;
     // Validate Write updates
+    // Consecutive writes usually target the same set, only look it up again when dstSet changes
+    std::shared_ptr<const vvl::DescriptorSet> set_node;
     for (uint32_t i = 0; i < descriptorWriteCount; i++) {
         const Location write_loc = loc.dot(Field::pDescriptorWrites, i);
         auto dst_set = pDescriptorWrites[i].dstSet;
-        if (const auto set_node = Get<vvl::DescriptorSet>(dst_set)) {
+        if (!set_node || set_node->VkHandle() != dst_set) {
+            set_node = Get<vvl::DescriptorSet>(dst_set);
+        }
+        if (set_node) {
             skip |= ValidateWriteUpdate(*set_node, pDescriptorWrites[i], write_loc, false);
         }
 
@@ -451,6 +451,8 @@ void CoreChecks::PostCreateDevice(const VkDeviceCreateInfo *pCreateInfo, const L
 
     AdjustValidatorOptions(device_extensions, enabled_features, spirv_val_options, &spirv_val_option_hash);
 
+    defer_spirv_validation_ = enabled[shader_validation_async] && !disabled[shader_validation] && thread_pool;
+
     // Allocate shader validation cache
     if (!disabled[shader_validation_caching] && !disabled[shader_validation] && !core_validation_cache) {
         auto tmp_path = GetTempFilePath();
@@ -483,6 +485,9 @@ void CoreChecks::PreCallRecordDestroyDevice(VkDevice device, const VkAllocationC
                                             const RecordObject &record_obj) {
     if (!device) return;
 
+    // Before the validation cache is written, the background spirv-val could still be adding to it
+    ReportDeferredSpirvValidations();
+
     StateTracker::PreCallRecordDestroyDevice(device, pAllocator, record_obj);
 
     if (core_validation_cache) {
@@ -2081,11 +2081,13 @@ void CoreChecks::PostCallRecordBindImageMemory2KHR(VkDevice device, uint32_t bin
     PostCallRecordBindImageMemory2(device, bindInfoCount, pBindInfos, record_obj);
 }
 
-bool CoreChecks::ValidateSparseMemoryBind(const VkSparseMemoryBind &bind, const VkMemoryRequirements &requirements,
-                                          VkDeviceSize resource_size, VkExternalMemoryHandleTypeFlags external_handle_types,
+// mem_state is the state of bind.memory, resolved by the caller so batches binding many pages of one allocation look it up once
+bool CoreChecks::ValidateSparseMemoryBind(const VkSparseMemoryBind &bind, const vvl::DeviceMemory *mem_state,
+                                          const VkMemoryRequirements &requirements, VkDeviceSize resource_size,
+                                          VkExternalMemoryHandleTypeFlags external_handle_types,
                                           const VulkanTypedHandle &resource_handle, const Location &loc) const {
     bool skip = false;
-    if (auto mem_state = Get<vvl::DeviceMemory>(bind.memory)) {
+    if (mem_state) {
         if (!((uint32_t(1) << mem_state->allocate_info.memoryTypeIndex) & requirements.memoryTypeBits)) {
             const LogObjectList objlist(bind.memory, resource_handle);
             skip |= LogError("VUID-VkSparseMemoryBind-memory-01096", objlist, loc.dot(Field::memory),
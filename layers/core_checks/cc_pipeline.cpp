@@ -42,6 +42,33 @@ bool CoreChecks::IsBeforeCtsVersion(uint32_t major, uint32_t minor, uint32_t sub
     return phys_dev_props_core12.conformanceVersion.subminor < subminor;
 }
 
+// The pipelines of a vkCreate*Pipelines batch are independent of each other, and applications warming up their caches create
+// hundreds of them in one call. Large batches are validated on the device thread pool, each pipeline logging to its own buffer.
+// The buffers are reported in pCreateInfos order, so the messages are the same as when validating the pipelines one by one.
+bool CoreChecks::ValidatePipelineBatch(uint32_t count, const std::function<bool(uint32_t pipe_index)> &validate_pipeline) const {
+    const uint32_t worker_count = GetPipelineBatchWorkerCount(count);
+    bool skip = false;
+    if (!thread_pool || worker_count <= 1) {
+        for (uint32_t i = 0; i < count; i++) {
+            skip |= validate_pipeline(i);
+        }
+        return skip;
+    }
+
+    std::vector<MessageBuffer> messages(count);
+    // Not std::vector<bool>, each worker writes its own elements
+    std::vector<uint8_t> pipeline_skip(count, 0);
+    vvl::ParallelFor(thread_pool, count, worker_count, [&](uint32_t i) {
+        ScopedMessageBuffer scoped_buffer(*debug_report, messages[i]);
+        pipeline_skip[i] = validate_pipeline(i) ? 1 : 0;
+    });
+    for (uint32_t i = 0; i < count; i++) {
+        skip |= pipeline_skip[i] != 0;
+        skip |= debug_report->LogBufferedMessages(messages[i]);
+    }
+    return skip;
+}
+
 bool CoreChecks::ValidatePipelineCacheControlFlags(VkPipelineCreateFlags2KHR flags, const Location &loc, const char *vuid) const {
     bool skip = false;
     if (enabled_features.pipelineCreationCacheControl == VK_FALSE) {
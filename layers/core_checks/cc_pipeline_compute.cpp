@@ -32,28 +32,30 @@ bool CoreChecks::PreCallValidateCreateComputePipelines(VkDevice device, VkPipeli
                                                                     pPipelines, error_obj, pipeline_states, chassis_state);
 
     skip |= ValidateDeviceQueueSupport(error_obj.location);
-    for (uint32_t i = 0; i < count; i++) {
+    skip |= ValidatePipelineBatch(count, [&](uint32_t i) {
+        bool pipeline_skip = false;
         const vvl::Pipeline *pipeline = pipeline_states[i].get();
         if (!pipeline) {
-            continue;
+            return pipeline_skip;
         }
         const Location create_info_loc = error_obj.location.dot(Field::pCreateInfos, i);
         const Location stage_info = create_info_loc.dot(Field::stage);
         const auto &stage_state = pipeline->stage_states[0];
-        skip |= ValidateShaderStage(stage_state, pipeline, stage_info);
+        pipeline_skip |= ValidateShaderStage(stage_state, pipeline, stage_info);
         if (stage_state.pipeline_create_info) {
-            skip |= ValidatePipelineShaderStage(*pipeline, *stage_state.pipeline_create_info, stage_info);
+            pipeline_skip |= ValidatePipelineShaderStage(*pipeline, *stage_state.pipeline_create_info, stage_info);
         }
 
-        skip |= ValidatePipelineCacheControlFlags(pipeline->create_flags, create_info_loc.dot(Field::flags),
-                                                  "VUID-VkComputePipelineCreateInfo-pipelineCreationCacheControl-02875");
-        skip |= ValidatePipelineIndirectBindableFlags(pipeline->create_flags, create_info_loc.dot(Field::flags),
-                                                      "VUID-VkComputePipelineCreateInfo-flags-09007");
+        pipeline_skip |= ValidatePipelineCacheControlFlags(pipeline->create_flags, create_info_loc.dot(Field::flags),
+                                                           "VUID-VkComputePipelineCreateInfo-pipelineCreationCacheControl-02875");
+        pipeline_skip |= ValidatePipelineIndirectBindableFlags(pipeline->create_flags, create_info_loc.dot(Field::flags),
+                                                               "VUID-VkComputePipelineCreateInfo-flags-09007");
 
         if (const auto *pipeline_robustness_info =
                 vku::FindStructInPNextChain<VkPipelineRobustnessCreateInfoEXT>(pCreateInfos[i].pNext)) {
-            skip |= ValidatePipelineRobustnessCreateInfo(*pipeline, *pipeline_robustness_info, create_info_loc);
+            pipeline_skip |= ValidatePipelineRobustnessCreateInfo(*pipeline, *pipeline_robustness_info, create_info_loc);
         }
-    }
+        return pipeline_skip;
+    });
     return skip;
 }
@@ -43,11 +43,13 @@ bool CoreChecks::PreCallValidateCreateGraphicsPipelines(VkDevice device, VkPipel
                                                                      pPipelines, error_obj, pipeline_states, chassis_state);
 
     skip |= ValidateDeviceQueueSupport(error_obj.location);
-    for (uint32_t i = 0; i < count; i++) {
+    skip |= ValidatePipelineBatch(count, [&](uint32_t i) {
+        bool pipeline_skip = false;
         const Location create_info_loc = error_obj.location.dot(Field::pCreateInfos, i);
-        skip |= ValidateGraphicsPipeline(*pipeline_states[i].get(), create_info_loc);
-        skip |= ValidateGraphicsPipelineDerivatives(pipeline_states, i, create_info_loc);
-    }
+        pipeline_skip |= ValidateGraphicsPipeline(*pipeline_states[i].get(), create_info_loc);
+        pipeline_skip |= ValidateGraphicsPipelineDerivatives(pipeline_states, i, create_info_loc);
+        return pipeline_skip;
+    });
     return skip;
 }
 
@@ -126,18 +128,16 @@ bool CoreChecks::ValidateGraphicsPipeline(const vvl::Pipeline &pipeline, const L
                                               "VUID-VkGraphicsPipelineCreateInfo-pipelineCreationCacheControl-02878");
     skip |= ValidatePipelineProtectedAccessFlags(pipeline.create_flags, create_info_loc.dot(Field::flags));
 
-    const auto &pipeline_ci = pipeline.GraphicsCreateInfo();
-    if (const auto *discard_rectangle_state =
-            vku::FindStructInPNextChain<VkPipelineDiscardRectangleStateCreateInfoEXT>(pipeline_ci.pNext)) {
+    if (const auto *discard_rectangle_state = pipeline.GetCreateInfoPNext<VkPipelineDiscardRectangleStateCreateInfoEXT>()) {
         skip |= ValidatePipelineDiscardRectangleStateCreateInfo(pipeline, *discard_rectangle_state, create_info_loc);
     }
 
     // VkAttachmentSampleCountInfoAMD == VkAttachmentSampleCountInfoNV
-    if (const auto attachment_sample_count_info = vku::FindStructInPNextChain<VkAttachmentSampleCountInfoAMD>(pipeline_ci.pNext)) {
+    if (const auto attachment_sample_count_info = pipeline.GetCreateInfoPNext<VkAttachmentSampleCountInfoAMD>()) {
         skip |= ValidatePipelineAttachmentSampleCountInfo(pipeline, *attachment_sample_count_info, create_info_loc);
     }
 
-    if (const auto *pipeline_robustness_info = vku::FindStructInPNextChain<VkPipelineRobustnessCreateInfoEXT>(pipeline_ci.pNext)) {
+    if (const auto *pipeline_robustness_info = pipeline.GetCreateInfoPNext<VkPipelineRobustnessCreateInfoEXT>()) {
         skip |= ValidatePipelineRobustnessCreateInfo(pipeline, *pipeline_robustness_info, create_info_loc);
     }
     return skip;
@@ -254,7 +254,7 @@ bool CoreChecks::ValidatePipelineLibraryCreateInfo(const vvl::Pipeline &pipeline
     bool uses_descriptor_buffer = false;
     bool lib_all_has_capture_internal = false;
 
-    const auto gpl_info = vku::FindStructInPNextChain<VkGraphicsPipelineLibraryCreateInfoEXT>(pipeline.GraphicsCreateInfo().pNext);
+    const auto gpl_info = pipeline.GetCreateInfoPNext<VkGraphicsPipelineLibraryCreateInfoEXT>();
 
     for (uint32_t i = 0; i < library_create_info.libraryCount; ++i) {
         const auto lib = Get<vvl::Pipeline>(library_create_info.pLibraries[i]);
@@ -394,8 +394,7 @@ bool CoreChecks::ValidatePipelineLibraryCreateInfo(const vvl::Pipeline &pipeline
                 for (uint32_t i = 0; i < library_create_info.libraryCount; ++i) {
                     const auto lib = Get<vvl::Pipeline>(library_create_info.pLibraries[i]);
                     if (!lib) continue;
-                    const auto lib_gpl_info =
-                        vku::FindStructInPNextChain<VkGraphicsPipelineLibraryCreateInfoEXT>(lib->GraphicsCreateInfo().pNext);
+                    const auto lib_gpl_info = lib->GetCreateInfoPNext<VkGraphicsPipelineLibraryCreateInfoEXT>();
                     if (!lib_gpl_info) {
                         continue;
                     }
@@ -478,8 +477,7 @@ bool CoreChecks::ValidateGraphicsPipelineRenderPass(const vvl::Pipeline &pipelin
                              create_info_loc.dot(Field::renderPass), "is NULL, but the dynamicRendering feature was not enabled");
         }
     } else if (!pipeline.RenderPassState()) {
-        const auto gpl_info =
-            vku::FindStructInPNextChain<VkGraphicsPipelineLibraryCreateInfoEXT>(pipeline.GraphicsCreateInfo().pNext);
+        const auto gpl_info = pipeline.GetCreateInfoPNext<VkGraphicsPipelineLibraryCreateInfoEXT>();
         const bool has_flags =
             gpl_info && (gpl_info->flags & (VK_GRAPHICS_PIPELINE_LIBRARY_PRE_RASTERIZATION_SHADERS_BIT_EXT |
                                             VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_SHADER_BIT_EXT |
@@ -646,29 +644,26 @@ bool CoreChecks::ValidateGraphicsPipelineLibrary(const vvl::Pipeline &pipeline,
     GPLValidInfo frag_shader_info;
     GPLValidInfo frag_output_info;
 
-    const auto &pipeline_ci = pipeline.GraphicsCreateInfo();
-    const auto gpl_info = vku::FindStructInPNextChain<VkGraphicsPipelineLibraryCreateInfoEXT>(pipeline_ci.pNext);
+    const auto gpl_info = pipeline.GetCreateInfoPNext<VkGraphicsPipelineLibraryCreateInfoEXT>();
     if (gpl_info) {
         if (gpl_info->flags & VK_GRAPHICS_PIPELINE_LIBRARY_PRE_RASTERIZATION_SHADERS_BIT_EXT) {
             pre_raster_info.init = GPLInitType::gpl_flags;
             pre_raster_info.flags =
                 (pipeline.PreRasterPipelineLayoutState()) ? pipeline.PreRasterPipelineLayoutState()->CreateFlags() : 0;
             pre_raster_info.layout = pipeline.PreRasterPipelineLayoutState().get();
-            pre_raster_info.shading_rate_state =
-                vku::FindStructInPNextChain<VkPipelineFragmentShadingRateStateCreateInfoKHR>(pipeline_ci.pNext);
+            pre_raster_info.shading_rate_state = pipeline.GetCreateInfoPNext<VkPipelineFragmentShadingRateStateCreateInfoKHR>();
         }
         if (gpl_info->flags & VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_SHADER_BIT_EXT) {
             frag_shader_info.init = GPLInitType::gpl_flags;
             frag_shader_info.flags =
                 (pipeline.FragmentShaderPipelineLayoutState()) ? pipeline.FragmentShaderPipelineLayoutState()->CreateFlags() : 0;
             frag_shader_info.layout = pipeline.FragmentShaderPipelineLayoutState().get();
-            frag_shader_info.ms_state = pipeline.fragment_shader_state->ms_state.get()->ptr();
-            frag_shader_info.shading_rate_state =
-                vku::FindStructInPNextChain<VkPipelineFragmentShadingRateStateCreateInfoKHR>(pipeline_ci.pNext);
+            frag_shader_info.ms_state = pipeline.fragment_shader_state->ms_state->ptr();
+            frag_shader_info.shading_rate_state = pipeline.GetCreateInfoPNext<VkPipelineFragmentShadingRateStateCreateInfoKHR>();
         }
         if (gpl_info->flags & VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_OUTPUT_INTERFACE_BIT_EXT) {
             frag_output_info.init = GPLInitType::gpl_flags;
-            frag_output_info.ms_state = pipeline.fragment_output_state->ms_state.get()->ptr();
+            frag_output_info.ms_state = pipeline.fragment_output_state->ms_state->ptr();
         }
     }
 
@@ -679,7 +674,6 @@ bool CoreChecks::ValidateGraphicsPipelineLibrary(const vvl::Pipeline &pipeline,
             const auto lib = Get<vvl::Pipeline>(pipeline.library_create_info->pLibraries[i]);
             if (!lib) continue;
 
-            const auto &lib_ci = lib->GraphicsCreateInfo();
             if (lib->graphics_lib_type & VK_GRAPHICS_PIPELINE_LIBRARY_PRE_RASTERIZATION_SHADERS_BIT_EXT) {
                 pre_raster_info.init = GPLInitType::link_libraries;
                 const auto layout_state = lib->PreRasterPipelineLayoutState();
@@ -687,8 +681,7 @@ bool CoreChecks::ValidateGraphicsPipelineLibrary(const vvl::Pipeline &pipeline,
                     pre_raster_info.flags = layout_state->CreateFlags();
                     pre_raster_info.layout = layout_state.get();
                 }
-                pre_raster_info.shading_rate_state =
-                    vku::FindStructInPNextChain<VkPipelineFragmentShadingRateStateCreateInfoKHR>(lib_ci.pNext);
+                pre_raster_info.shading_rate_state = lib->GetCreateInfoPNext<VkPipelineFragmentShadingRateStateCreateInfoKHR>();
             }
             if (lib->graphics_lib_type & VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_SHADER_BIT_EXT) {
                 frag_shader_info.init = GPLInitType::link_libraries;
@@ -697,13 +690,12 @@ bool CoreChecks::ValidateGraphicsPipelineLibrary(const vvl::Pipeline &pipeline,
                     frag_shader_info.flags = layout_state->CreateFlags();
                     frag_shader_info.layout = layout_state.get();
                 }
-                frag_shader_info.ms_state = lib->fragment_shader_state->ms_state.get()->ptr();
-                frag_shader_info.shading_rate_state =
-                    vku::FindStructInPNextChain<VkPipelineFragmentShadingRateStateCreateInfoKHR>(lib_ci.pNext);
+                frag_shader_info.ms_state = lib->fragment_shader_state->ms_state->ptr();
+                frag_shader_info.shading_rate_state = lib->GetCreateInfoPNext<VkPipelineFragmentShadingRateStateCreateInfoKHR>();
             }
             if (lib->graphics_lib_type & VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_OUTPUT_INTERFACE_BIT_EXT) {
                 frag_output_info.init = GPLInitType::link_libraries;
-                frag_output_info.ms_state = lib->fragment_output_state->ms_state.get()->ptr();
+                frag_output_info.ms_state = lib->fragment_output_state->ms_state->ptr();
             }
         }
     }
@@ -1189,9 +1181,7 @@ bool CoreChecks::ValidateGraphicsPipelineExternalFormatResolve(const vvl::Pipeli
     const auto &rp_state = pipeline.RenderPassState();
     const auto *multisample_state = pipeline.MultisampleState();
     const auto *color_blend_state = pipeline.ColorBlendState();
-    const auto &pipeline_ci = pipeline.GraphicsCreateInfo();
-    const auto fragment_shading_rate =
-        vku::FindStructInPNextChain<VkPipelineFragmentShadingRateStateCreateInfoKHR>(pipeline_ci.pNext);
+    const auto fragment_shading_rate = pipeline.GetCreateInfoPNext<VkPipelineFragmentShadingRateStateCreateInfoKHR>();
 
     if (rp_state && !rp_state->UsesDynamicRendering()) {
         if (!subpass_desc || subpass_desc->colorAttachmentCount == 0 || !subpass_desc->pResolveAttachments) {
@@ -1688,8 +1678,7 @@ bool CoreChecks::ValidateGraphicsPipelineColorBlendState(const vvl::Pipeline &pi
     }
 
     // VkAttachmentSampleCountInfoAMD == VkAttachmentSampleCountInfoNV
-    const auto &pipeline_ci = pipeline.GraphicsCreateInfo();
-    const auto *attachment_sample_count_info = vku::FindStructInPNextChain<VkAttachmentSampleCountInfoAMD>(pipeline_ci.pNext);
+    const auto *attachment_sample_count_info = pipeline.GetCreateInfoPNext<VkAttachmentSampleCountInfoAMD>();
     const auto *rendering_struct = pipeline.rendering_create_info;
     if (null_rp && rendering_struct && attachment_sample_count_info &&
         (attachment_sample_count_info->colorAttachmentCount != rendering_struct->colorAttachmentCount)) {
@@ -2790,9 +2779,7 @@ bool CoreChecks::ValidateGraphicsPipelineDynamicState(const vvl::Pipeline &pipel
 bool CoreChecks::ValidateGraphicsPipelineFragmentShadingRateState(const vvl::Pipeline &pipeline,
                                                                   const Location &create_info_loc) const {
     bool skip = false;
-    const auto &pipeline_ci = pipeline.GraphicsCreateInfo();
-    const auto *fragment_shading_rate_state =
-        vku::FindStructInPNextChain<VkPipelineFragmentShadingRateStateCreateInfoKHR>(pipeline_ci.pNext);
+    const auto *fragment_shading_rate_state = pipeline.GetCreateInfoPNext<VkPipelineFragmentShadingRateStateCreateInfoKHR>();
     if (!fragment_shading_rate_state || pipeline.IsDynamic(CB_DYNAMIC_STATE_FRAGMENT_SHADING_RATE_KHR)) {
         return skip;
     }
@@ -2956,8 +2943,7 @@ bool CoreChecks::ValidateGraphicsPipelineDynamicRendering(const vvl::Pipeline &p
             }
         }
         if (pipeline.fragment_shader_state && pipeline.fragment_output_state) {
-            const auto input_attachment_index =
-                vku::FindStructInPNextChain<VkRenderingInputAttachmentIndexInfoKHR>(pipeline_ci.pNext);
+            const auto input_attachment_index = pipeline.GetCreateInfoPNext<VkRenderingInputAttachmentIndexInfoKHR>();
             if (input_attachment_index) {
                 skip |= ValidateRenderingInputAttachmentIndicesKHR(
                     *input_attachment_index, device, create_info_loc.pNext(Struct::VkRenderingInputAttachmentIndexInfoKHR));
@@ -2971,7 +2957,7 @@ bool CoreChecks::ValidateGraphicsPipelineDynamicRendering(const vvl::Pipeline &p
                 }
             }
 
-            const auto attachment_location = vku::FindStructInPNextChain<VkRenderingAttachmentLocationInfoKHR>(pipeline_ci.pNext);
+            const auto attachment_location = pipeline.GetCreateInfoPNext<VkRenderingAttachmentLocationInfoKHR>();
             if (attachment_location) {
                 skip |= ValidateRenderingAttachmentLocationsKHR(
                     *attachment_location, device, create_info_loc.pNext(Struct::VkRenderingAttachmentLocationInfoKHR));
@@ -3091,9 +3077,7 @@ bool CoreChecks::ValidateGraphicsPipelineBindPoint(const vvl::CommandBuffer &cb_
         skip |= LogError("VUID-vkCmdBindPipeline-commandBuffer-04808", objlist, loc,
                          "Graphics pipeline incompatible with viewport/scissor inheritance.");
     }
-    const auto &pipeline_ci = pipeline.GraphicsCreateInfo();
-    const auto *discard_rectangle_state =
-        vku::FindStructInPNextChain<VkPipelineDiscardRectangleStateCreateInfoEXT>(pipeline_ci.pNext);
+    const auto *discard_rectangle_state = pipeline.GetCreateInfoPNext<VkPipelineDiscardRectangleStateCreateInfoEXT>();
     if ((discard_rectangle_state && discard_rectangle_state->discardRectangleCount != 0) ||
         (pipeline.IsDynamic(CB_DYNAMIC_STATE_DISCARD_RECTANGLE_ENABLE_EXT))) {
         if (!pipeline.IsDynamic(CB_DYNAMIC_STATE_DISCARD_RECTANGLE_EXT)) {
@@ -3702,8 +3686,7 @@ bool CoreChecks::ValidateDrawPipelineDynamicRenderpassSampleCount(const LastBoun
     const vvl::CommandBuffer &cb_state = last_bound_state.cb_state;
 
     // VkAttachmentSampleCountInfoAMD == VkAttachmentSampleCountInfoNV
-    if (auto p_attachment_sample_count_info =
-            vku::FindStructInPNextChain<VkAttachmentSampleCountInfoAMD>(pipeline.GraphicsCreateInfo().pNext)) {
+    if (auto p_attachment_sample_count_info = pipeline.GetCreateInfoPNext<VkAttachmentSampleCountInfoAMD>()) {
         for (uint32_t i = 0; i < rendering_info.colorAttachmentCount; ++i) {
             if (rendering_info.pColorAttachments[i].imageView == VK_NULL_HANDLE) {
                 continue;
@@ -30,12 +30,7 @@
 
 static QueryState GetLocalQueryState(const QueryMap *localQueryToStateMap, VkQueryPool queryPool, uint32_t queryIndex,
                                      uint32_t perfPass) {
-    QueryObject query = QueryObject(queryPool, queryIndex, perfPass);
-
-    auto iter = localQueryToStateMap->find(query);
-    if (iter != localQueryToStateMap->end()) return iter->second;
-
-    return QUERYSTATE_UNKNOWN;
+    return localQueryToStateMap->Get(queryPool, queryIndex, perfPass);
 }
 
 bool CoreChecks::PreCallValidateDestroyQueryPool(VkDevice device, VkQueryPool queryPool, const VkAllocationCallbacks *pAllocator,
@@ -109,20 +104,28 @@ bool CoreChecks::ValidateQueryPoolWasReset(const vvl::QueryPool &query_pool_stat
                                            const Location &loc, QueryMap *localQueryToStateMap, uint32_t perfPass) const {
     bool skip = false;
 
-    for (uint32_t i = firstQuery; i < firstQuery + queryCount; ++i) {
-        if (localQueryToStateMap &&
-            GetLocalQueryState(localQueryToStateMap, query_pool_state.VkHandle(), i, perfPass) != QUERYSTATE_UNKNOWN) {
-            continue;
+    // Returns false once a query which was never reset is reported
+    const auto check_query = [&](uint32_t i, QueryState local_state) {
+        if (local_state != QUERYSTATE_UNKNOWN || query_pool_state.GetQueryState(i, 0u) != QUERYSTATE_UNKNOWN) {
+            return true;
         }
-        if (query_pool_state.GetQueryState(i, 0u) == QUERYSTATE_UNKNOWN) {
-            const char *vuid = loc.function == Func::vkGetQueryPoolResults ? "VUID-vkGetQueryPoolResults-None-09401"
-                                                                           : "VUID-vkCmdCopyQueryPoolResults-None-09402";
-            skip |= LogError(vuid, query_pool_state.Handle(), loc.dot(Field::queryPool),
-                             "%s and query %" PRIu32
-                             ": query not reset. After query pool creation, each query must be reset before it is used. Queries "
-                             "must also be reset between uses.",
-                             FormatHandle(query_pool_state.Handle()).c_str(), i);
-            break;
+        const char *vuid = loc.function == Func::vkGetQueryPoolResults ? "VUID-vkGetQueryPoolResults-None-09401"
+                                                                       : "VUID-vkCmdCopyQueryPoolResults-None-09402";
+        skip |= LogError(vuid, query_pool_state.Handle(), loc.dot(Field::queryPool),
+                         "%s and query %" PRIu32
+                         ": query not reset. After query pool creation, each query must be reset before it is used. Queries "
+                         "must also be reset between uses.",
+                         FormatHandle(query_pool_state.Handle()).c_str(), i);
+        return false;
+    };
+
+    if (localQueryToStateMap) {
+        localQueryToStateMap->ForEachInRange(query_pool_state.VkHandle(), firstQuery, queryCount, perfPass, check_query);
+    } else {
+        for (uint32_t i = firstQuery; i < firstQuery + queryCount; ++i) {
+            if (!check_query(i, QUERYSTATE_UNKNOWN)) {
+                break;
+            }
         }
     }
     return skip;
@@ -1062,16 +1065,15 @@ void CoreChecks::PreCallRecordCmdResetQueryPool(VkCommandBuffer commandBuffer, V
             if (!do_validate) return false;
             const auto &state_data = cb_state_arg.dev_data;
             bool skip = false;
-            for (uint32_t i = 0; i < queryCount; i++) {
-                QueryState state = GetLocalQueryState(localQueryToStateMap, queryPool, firstQuery + i, perfPass);
+            localQueryToStateMap->ForEachInRange(queryPool, firstQuery, queryCount, perfPass, [&](uint32_t slot, QueryState state) {
                 if (state == QUERYSTATE_ENDED) {
                     const LogObjectList objlist(cb_state_arg.Handle(), queryPool);
                     skip |= state_data.LogError("VUID-vkCmdResetQueryPool-firstQuery-02862", objlist, record_obj.location,
-                                                "Query index %" PRIu32 " was begun and reset in the same command buffer.",
-                                                firstQuery + i);
-                    break;
+                                                "Query index %" PRIu32 " was begun and reset in the same command buffer.", slot);
+                    return false;
                 }
-            }
+                return true;
+            });
             return skip;
         });
     }
@@ -1202,17 +1204,16 @@ void CoreChecks::PreCallRecordCmdCopyQueryPoolResults(VkCommandBuffer commandBuf
         if (!do_validate) return false;
         const auto &state_data = cb_state_arg.dev_data;
         bool skip = false;
-        for (uint32_t i = 0; i < queryCount; i++) {
-            QueryState state = GetLocalQueryState(localQueryToStateMap, queryPool, firstQuery + i, perfPass);
+        localQueryToStateMap->ForEachInRange(queryPool, firstQuery, queryCount, perfPass, [&](uint32_t slot, QueryState state) {
             QueryResultType result_type = GetQueryResultType(state, flags);
             if (result_type != QUERYRESULT_SOME_DATA && result_type != QUERYRESULT_UNKNOWN) {
                 const LogObjectList objlist(cb_state_arg.Handle(), queryPool);
                 skip |= state_data.LogError("VUID-vkCmdCopyQueryPoolResults-None-08752", objlist, record_obj.location,
                                             "Requesting a copy from query to buffer on %s query %" PRIu32 ": %s",
-                                            state_data.FormatHandle(queryPool).c_str(), firstQuery + i,
-                                            string_QueryResultType(result_type));
+                                            state_data.FormatHandle(queryPool).c_str(), slot, string_QueryResultType(result_type));
             }
-        }
+            return true;
+        });
 
         // NOTE: dev_data == this, but the compiler "Visual Studio 16" complains Get is ambiguous if dev_data isn't used
         auto query_pool_state = cb_state_arg.dev_data.Get<vvl::QueryPool>(queryPool);
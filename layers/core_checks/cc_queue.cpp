@@ -652,6 +652,14 @@ bool CoreChecks::PreCallValidateQueueBindSparse(VkQueue queue, uint32_t bindInfo
                          string_VkQueueFlags(queue_flags).c_str());
     }
 
+    // Large batches usually bind pages of only a few allocations, look each one up once
+    vvl::unordered_map<VkDeviceMemory, std::shared_ptr<const vvl::DeviceMemory>> mem_states;
+    auto get_mem_state = [this, &mem_states](VkDeviceMemory memory) {
+        auto [it, inserted] = mem_states.emplace(memory, nullptr);
+        if (inserted) it->second = Get<vvl::DeviceMemory>(memory);
+        return it->second.get();
+    };
+
     SemaphoreSubmitState sem_submit_state(*this, queue, queue_flags);
     for (uint32_t bind_idx = 0; bind_idx < bindInfoCount; ++bind_idx) {
         const Location bind_info_loc = error_obj.location.dot(Struct::VkBindSparseInfo, Field::pBindInfo, bind_idx);
@@ -669,9 +677,10 @@ bool CoreChecks::PreCallValidateQueueBindSparse(VkQueue queue, uint32_t bindInfo
                         const VkSparseMemoryBind &memory_bind = buffer_bind.pBinds[buffer_bind_idx];
                         const Location buffer_loc = bind_info_loc.dot(Field::pBufferBinds, buffer_idx);
                         const Location bind_loc = buffer_loc.dot(Field::pBinds, buffer_bind_idx);
-                        skip |=
-                            ValidateSparseMemoryBind(memory_bind, buffer_state->requirements, buffer_state->requirements.size,
-                                                     buffer_state->external_memory_handle_types, buffer_state->Handle(), bind_loc);
+                        skip |= ValidateSparseMemoryBind(memory_bind, get_mem_state(memory_bind.memory), buffer_state->requirements,
+                                                         buffer_state->requirements.size,
+                                                         buffer_state->external_memory_handle_types, buffer_state->Handle(),
+                                                         bind_loc);
                     }
                 }
             }
@@ -690,9 +699,10 @@ bool CoreChecks::PreCallValidateQueueBindSparse(VkQueue queue, uint32_t bindInfo
                         const Location bind_loc = image_loc.dot(Field::pBinds, image_opaque_bind_idx);
                         // Assuming that no multiplanar disjointed images are possible with sparse memory binding. Needs
                         // confirmation
-                        skip |=
-                            ValidateSparseMemoryBind(memory_bind, image_state->requirements[0], image_state->requirements[0].size,
-                                                     image_state->external_memory_handle_types, image_state->Handle(), bind_loc);
+                        skip |= ValidateSparseMemoryBind(memory_bind, get_mem_state(memory_bind.memory),
+                                                         image_state->requirements[0], image_state->requirements[0].size,
+                                                         image_state->external_memory_handle_types, image_state->Handle(),
+                                                         bind_loc);
                     }
                 }
             }
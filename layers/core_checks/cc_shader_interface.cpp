@@ -449,7 +449,7 @@ bool CoreChecks::ValidateShaderStageInputOutputLimits(const spirv::Module &modul
 
 bool CoreChecks::ValidateInterfaceBetweenStages(const spirv::Module &producer, const spirv::EntryPoint &producer_entrypoint,
                                                 const spirv::Module &consumer, const spirv::EntryPoint &consumer_entrypoint,
-                                                const Location &create_info_loc) const {
+                                                const Location &create_info_loc, bool &reported) const {
     bool skip = false;
 
     if (producer_entrypoint.has_passthrough) {
@@ -508,6 +508,7 @@ bool CoreChecks::ValidateInterfaceBetweenStages(const spirv::Module &producer, c
                 if ((component_info.output_type != component_info.input_type) ||
                     (component_info.output_width != component_info.input_width)) {
                     const LogObjectList objlist(producer.handle(), consumer.handle());
+                    reported = true;
                     skip |= LogError("VUID-RuntimeSpirv-OpEntryPoint-07754", objlist, create_info_loc,
                                      "(SPIR-V Interface) Type mismatch on Location %" PRIu32 " Component %" PRIu32
                                      ", between\n\n%s stage:\n%s%s\n\n%s stage:\n%s%s\n\n",
@@ -544,6 +545,7 @@ bool CoreChecks::ValidateInterfaceBetweenStages(const spirv::Module &producer, c
                     const uint32_t input_vec_size = input_var->base_type.Word(3);
                     if (output_vec_size > input_vec_size) {
                         const LogObjectList objlist(producer.handle(), consumer.handle());
+                        reported = true;
                         skip |= LogError("VUID-RuntimeSpirv-maintenance4-06817", objlist, create_info_loc,
                                          "(SPIR-V Interface) starting at Location %" PRIu32 " Component %" PRIu32
                                          " the Output (%s) has a Vec%" PRIu32 " while Input (%s) as a Vec%" PRIu32
@@ -561,6 +563,7 @@ bool CoreChecks::ValidateInterfaceBetweenStages(const spirv::Module &producer, c
                 // Don't give any warning if maintenance4 with vectors
                 if (!enabled_features.maintenance4 && (output_var->base_type.Opcode() != spv::OpTypeVector)) {
                     const LogObjectList objlist(producer.handle(), consumer.handle());
+                    reported = true;
                     skip |= LogPerformanceWarning("WARNING-Shader-OutputNotConsumed", objlist, create_info_loc,
                                                   "(SPIR-V Interface) %s declared to output location %" PRIu32 " Component %" PRIu32
                                                   " but is not an Input declared by %s.",
@@ -575,6 +578,7 @@ bool CoreChecks::ValidateInterfaceBetweenStages(const spirv::Module &producer, c
                     break;  // When going inbetween Tessellation or Geometry, array size can be different
                 }
                 const LogObjectList objlist(producer.handle(), consumer.handle());
+                reported = true;
                 skip |= LogError("VUID-RuntimeSpirv-OpEntryPoint-08743", objlist, create_info_loc,
                                  "(SPIR-V Interface) %s declared input at Location %" PRIu32 " Component %" PRIu32
                                  " %sbut it is not an Output declared in %s",
@@ -636,12 +640,43 @@ bool CoreChecks::ValidateInterfaceBetweenStages(const spirv::Module &producer, c
         }
         msg << "}\n";
         const LogObjectList objlist(producer.handle(), consumer.handle());
+        reported = true;
         skip |= LogError("VUID-RuntimeSpirv-OpVariable-08746", objlist, create_info_loc,
                          "(SPIR-V Interface) Mistmatch in BuiltIn blocks:\n %s", msg.str().c_str());
     }
     return skip;
 }
 
+bool CoreChecks::ValidateInterfaceBetweenStages(const spirv::Module &producer,
+                                                const std::shared_ptr<const spirv::EntryPoint> &producer_entrypoint,
+                                                const spirv::Module &consumer,
+                                                const std::shared_ptr<const spirv::EntryPoint> &consumer_entrypoint,
+                                                const Location &create_info_loc) const {
+    const StageInterfaceKey key = {producer_entrypoint.get(), consumer_entrypoint.get()};
+    {
+        ReadLockGuard guard(matched_stage_interfaces_lock_);
+        if (const auto itr = matched_stage_interfaces_.find(key); itr != matched_stage_interfaces_.cend()) {
+            if (itr->second.producer.lock() == producer_entrypoint && itr->second.consumer.lock() == consumer_entrypoint) {
+                return false;
+            }
+        }
+    }
+
+    bool reported = false;
+    const bool skip =
+        ValidateInterfaceBetweenStages(producer, *producer_entrypoint, consumer, *consumer_entrypoint, create_info_loc, reported);
+    if (!skip && !reported) {
+        // Entries of destroyed shaders are never hit again, drop everything once in a while instead of tracking them
+        constexpr size_t kMaxMatchedStageInterfaces = 16 * 1024;
+        WriteLockGuard guard(matched_stage_interfaces_lock_);
+        if (matched_stage_interfaces_.size() >= kMaxMatchedStageInterfaces) {
+            matched_stage_interfaces_.clear();
+        }
+        matched_stage_interfaces_.insert_or_assign(key, StageInterfaceEntryPoints{producer_entrypoint, consumer_entrypoint});
+    }
+    return skip;
+}
+
 bool CoreChecks::ValidateFsOutputsAgainstRenderPass(const spirv::Module &module_state, const spirv::EntryPoint &entrypoint,
                                                     const vvl::Pipeline &pipeline, uint32_t subpass_index,
                                                     const Location &create_info_loc) const {
@@ -875,8 +910,8 @@ bool CoreChecks::ValidateGraphicsPipelineShaderState(const vvl::Pipeline &pipeli
             break;
         }
         if (consumer_spirv && producer_spirv && consumer.entrypoint && producer.entrypoint) {
-            skip |= ValidateInterfaceBetweenStages(*producer_spirv.get(), *producer.entrypoint, *consumer_spirv.get(),
-                                                   *consumer.entrypoint, create_info_loc);
+            skip |= ValidateInterfaceBetweenStages(*producer_spirv.get(), producer.entrypoint, *consumer_spirv.get(),
+                                                   consumer.entrypoint, create_info_loc);
         }
     }
 
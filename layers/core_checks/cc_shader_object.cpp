@@ -303,8 +303,11 @@ bool CoreChecks::PreCallValidateCreateShadersEXT(VkDevice device, uint32_t creat
         }
         const Location create_info_loc = error_obj.location.dot(Field::pCreateInfos, i);
 
-        spv_const_binary_t binary{static_cast<const uint32_t*>(create_info.pCode), create_info.codeSize / sizeof(uint32_t)};
-        skip |= RunSpirvValidation(binary, create_info_loc, cache);
+        // With check_shaders_async, spirv-val runs in the background once the shader is created, see PostCallRecordCreateShadersEXT
+        if (!defer_spirv_validation_) {
+            spv_const_binary_t binary{static_cast<const uint32_t*>(create_info.pCode), create_info.codeSize / sizeof(uint32_t)};
+            skip |= RunSpirvValidation(binary, create_info_loc, cache);
+        }
 
         const auto spirv = std::make_shared<spirv::Module>(create_info.codeSize, static_cast<const uint32_t*>(create_info.pCode));
         vku::safe_VkShaderCreateInfoEXT safe_create_info = vku::safe_VkShaderCreateInfoEXT(&pCreateInfos[i]);
@@ -385,6 +388,30 @@ bool CoreChecks::PreCallValidateCreateShadersEXT(VkDevice device, uint32_t creat
     return skip;
 }
 
+void CoreChecks::PostCallRecordCreateShadersEXT(VkDevice device, uint32_t createInfoCount,
+                                                const VkShaderCreateInfoEXT* pCreateInfos, const VkAllocationCallbacks* pAllocator,
+                                                VkShaderEXT* pShaders, const RecordObject& record_obj,
+                                                chassis::ShaderObject& chassis_state) {
+    StateTracker::PostCallRecordCreateShadersEXT(device, createInfoCount, pCreateInfos, pAllocator, pShaders, record_obj,
+                                                 chassis_state);
+    if (VK_SUCCESS != record_obj.result || !defer_spirv_validation_) {
+        return;
+    }
+    for (uint32_t i = 0; i < createInfoCount; ++i) {
+        if (pCreateInfos[i].codeType == VK_SHADER_CODE_TYPE_SPIRV_EXT && pShaders[i] != VK_NULL_HANDLE) {
+            DeferSpirvValidation(VulkanTypedHandle(pShaders[i], kVulkanObjectTypeShaderEXT),
+                                 static_cast<const uint32_t*>(pCreateInfos[i].pCode), pCreateInfos[i].codeSize,
+                                 record_obj.location.dot(Field::pCreateInfos, i));
+        }
+    }
+}
+
+void CoreChecks::PreCallRecordDestroyShaderEXT(VkDevice device, VkShaderEXT shader, const VkAllocationCallbacks* pAllocator,
+                                               const RecordObject& record_obj) {
+    ReportDeferredSpirvValidation(VulkanTypedHandle(shader, kVulkanObjectTypeShaderEXT));
+    StateTracker::PreCallRecordDestroyShaderEXT(device, shader, pAllocator, record_obj);
+}
+
 bool CoreChecks::PreCallValidateDestroyShaderEXT(VkDevice device, VkShaderEXT shader, const VkAllocationCallbacks* pAllocator,
                                                  const ErrorObject& error_obj) const {
     bool skip = false;
@@ -421,6 +448,10 @@ bool CoreChecks::PreCallValidateCmdBindShadersEXT(VkCommandBuffer commandBuffer,
         const Location stage_loc = error_obj.location.dot(Field::pStages, i);
         const VkShaderStageFlagBits& stage = pStages[i];
         VkShaderEXT shader = pShaders ? pShaders[i] : VK_NULL_HANDLE;
+        const auto shader_state = shader != VK_NULL_HANDLE ? Get<vvl::ShaderObject>(shader) : nullptr;
+        if (shader_state) {
+            skip |= ReportDeferredSpirvValidation(shader_state->Handle(), shader_state->deferred_spirv_val_reported);
+        }
 
         for (uint32_t j = i; j < stageCount; ++j) {
             if (i != j && stage == pStages[j]) {
@@ -505,14 +536,10 @@ bool CoreChecks::PreCallValidateCmdBindShadersEXT(VkCommandBuffer commandBuffer,
             skip |= LogError("VUID-vkCmdBindShadersEXT-pStages-08468", commandBuffer, stage_loc, "is %s.",
                              string_VkShaderStageFlagBits(stage));
         }
-        if (shader != VK_NULL_HANDLE) {
-            const auto shader_state = Get<vvl::ShaderObject>(shader);
-            if (shader_state && shader_state->create_info.stage != stage) {
-                skip |=
-                    LogError("VUID-vkCmdBindShadersEXT-pShaders-08469", commandBuffer, stage_loc,
+        if (shader_state && shader_state->create_info.stage != stage) {
+            skip |= LogError("VUID-vkCmdBindShadersEXT-pShaders-08469", commandBuffer, stage_loc,
                              "is %s, but pShaders[%" PRIu32 "] was created with shader stage %s.",
                              string_VkShaderStageFlagBits(stage), i, string_VkShaderStageFlagBits(shader_state->create_info.stage));
-            }
         }
     }
 
@@ -17,8 +17,10 @@
  * limitations under the License.
  */
 
+#include <algorithm>
 #include <cassert>
 #include <cinttypes>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -2127,6 +2129,11 @@ bool CoreChecks::ValidateShaderStage(const ShaderStageState &stage_state, const
     bool skip = false;
     const VkShaderStageFlagBits stage = stage_state.GetStage();
 
+    if (stage_state.module_state) {
+        skip |= ReportDeferredSpirvValidation(stage_state.module_state->Handle(),
+                                              stage_state.module_state->deferred_spirv_val_reported);
+    }
+
     // First validate all things that don't require valid SPIR-V
     // this is found when using VK_EXT_shader_module_identifier
     skip |= ValidateShaderSubgroupSizeControl(stage, stage_state, loc);
@@ -2509,6 +2516,90 @@ bool CoreChecks::RunSpirvValidation(spv_const_binary_t &binary, const Location &
     return skip;
 }
 
+// Only shaders checked against the device's own validation cache are deferred, a VkValidationCacheEXT of the application could
+// be destroyed before the background thread is done with it.
+bool CoreChecks::CanDeferSpirvValidation(const VkShaderModuleCreateInfo &create_info) const {
+    return defer_spirv_validation_ && create_info.pCode && create_info.pCode[0] == spv::MagicNumber &&
+           SafeModulo(create_info.codeSize, 4) == 0 &&
+           !vku::FindStructInPNextChain<VkShaderModuleValidationCacheCreateInfoEXT>(create_info.pNext);
+}
+
+void CoreChecks::DeferSpirvValidation(const VulkanTypedHandle &handle, const uint32_t *code, size_t code_size,
+                                      const Location &create_info_loc) {
+    std::shared_ptr<DeferredSpirvValidation> deferred;
+    {
+        std::lock_guard<std::mutex> guard(deferred_spirv_validations_lock_);
+        deferred = std::make_shared<DeferredSpirvValidation>(code, code_size, create_info_loc, deferred_spirv_validation_count_++);
+        deferred_spirv_validations_[handle] = deferred;
+    }
+    // The task keeps its own reference, the shader can be used (and its entry removed) before the task runs. If the pool can not
+    // run it, spirv-val runs at the first use of the shader.
+    thread_pool->Submit([this, deferred]() { RunDeferredSpirvValidation(*deferred); });
+}
+
+void CoreChecks::RunDeferredSpirvValidation(DeferredSpirvValidation &deferred) const {
+    std::call_once(deferred.run_once, [this, &deferred]() {
+        ScopedMessageBuffer message_buffer(*debug_report, deferred.messages);
+        spv_const_binary_t binary{deferred.words.data(), deferred.words.size()};
+        RunSpirvValidation(binary, deferred.create_info_loc.Get(), CastFromHandle<ValidationCache *>(core_validation_cache));
+        std::vector<uint32_t>().swap(deferred.words);
+    });
+}
+
+// Waits for the spirv-val of the shader, or runs it on this thread if it did not start yet, and logs its messages.
+// This only happens once per shader, later uses find nothing to report.
+bool CoreChecks::ReportDeferredSpirvValidation(const VulkanTypedHandle &handle) const {
+    if (!defer_spirv_validation_) {
+        return false;
+    }
+    std::shared_ptr<DeferredSpirvValidation> deferred;
+    {
+        std::lock_guard<std::mutex> guard(deferred_spirv_validations_lock_);
+        auto it = deferred_spirv_validations_.find(handle);
+        if (it == deferred_spirv_validations_.end()) {
+            return false;
+        }
+        deferred = std::move(it->second);
+        deferred_spirv_validations_.erase(it);
+    }
+    RunDeferredSpirvValidation(*deferred);
+    return debug_report->LogBufferedMessages(deferred->messages);
+}
+
+// For the state object of a shader in use: once its messages were reported, this only reads the flag instead of taking
+// deferred_spirv_validations_lock_.
+bool CoreChecks::ReportDeferredSpirvValidation(const VulkanTypedHandle &handle, std::atomic<bool> &reported) const {
+    if (!defer_spirv_validation_ || reported.load()) {
+        return false;
+    }
+    const bool skip = ReportDeferredSpirvValidation(handle);
+    reported.store(true);
+    return skip;
+}
+
+// The shaders that were never used are reported when the device is destroyed, in the order they were created
+void CoreChecks::ReportDeferredSpirvValidations() {
+    if (!defer_spirv_validation_) {
+        return;
+    }
+    std::vector<std::shared_ptr<DeferredSpirvValidation>> remaining;
+    {
+        std::lock_guard<std::mutex> guard(deferred_spirv_validations_lock_);
+        remaining.reserve(deferred_spirv_validations_.size());
+        for (auto &entry : deferred_spirv_validations_) {
+            remaining.emplace_back(std::move(entry.second));
+        }
+        deferred_spirv_validations_.clear();
+    }
+    std::sort(remaining.begin(), remaining.end(), [](const auto &a, const auto &b) { return a->id < b->id; });
+    for (auto &deferred : remaining) {
+        RunDeferredSpirvValidation(*deferred);
+        debug_report->LogBufferedMessages(deferred->messages);
+    }
+    // Every deferred spirv-val is done now, the tasks still queued on the pool find nothing left to run and do not touch the
+    // validation cache
+}
+
 bool CoreChecks::ValidateShaderModuleCreateInfo(const VkShaderModuleCreateInfo &create_info,
                                                 const Location &create_info_loc) const {
     bool skip = false;
@@ -2527,6 +2618,8 @@ bool CoreChecks::ValidateShaderModuleCreateInfo(const VkShaderModuleCreateInfo &
     } else if (SafeModulo(create_info.codeSize, 4) != 0) {
         skip |= LogError("VUID-VkShaderModuleCreateInfo-codeSize-08735", device, create_info_loc.dot(Field::codeSize),
                          "(%zu) must be a multiple of 4.", create_info.codeSize);
+    } else if (create_info_loc.function == Func::vkCreateShaderModule && CanDeferSpirvValidation(create_info)) {
+        // spirv-val runs in the background once the module is created, see PostCallRecordCreateShaderModule
     } else {
         // if pCode is garbage, don't pass along to spirv-val
 
@@ -2551,6 +2644,23 @@ bool CoreChecks::PreCallValidateCreateShaderModule(VkDevice device, const VkShad
     return ValidateShaderModuleCreateInfo(*pCreateInfo, error_obj.location.dot(Field::pCreateInfo));
 }
 
+void CoreChecks::PostCallRecordCreateShaderModule(VkDevice device, const VkShaderModuleCreateInfo *pCreateInfo,
+                                                  const VkAllocationCallbacks *pAllocator, VkShaderModule *pShaderModule,
+                                                  const RecordObject &record_obj, chassis::CreateShaderModule &chassis_state) {
+    StateTracker::PostCallRecordCreateShaderModule(device, pCreateInfo, pAllocator, pShaderModule, record_obj, chassis_state);
+    if (VK_SUCCESS != record_obj.result || !CanDeferSpirvValidation(*pCreateInfo)) {
+        return;
+    }
+    DeferSpirvValidation(VulkanTypedHandle(*pShaderModule, kVulkanObjectTypeShaderModule), pCreateInfo->pCode,
+                         pCreateInfo->codeSize, record_obj.location.dot(Field::pCreateInfo));
+}
+
+void CoreChecks::PreCallRecordDestroyShaderModule(VkDevice device, VkShaderModule shaderModule,
+                                                  const VkAllocationCallbacks *pAllocator, const RecordObject &record_obj) {
+    ReportDeferredSpirvValidation(VulkanTypedHandle(shaderModule, kVulkanObjectTypeShaderModule));
+    StateTracker::PreCallRecordDestroyShaderModule(device, shaderModule, pAllocator, record_obj);
+}
+
 bool CoreChecks::PreCallValidateGetShaderModuleIdentifierEXT(VkDevice device, VkShaderModule shaderModule,
                                                              VkShaderModuleIdentifierEXT *pIdentifier,
                                                              const ErrorObject &error_obj) const {
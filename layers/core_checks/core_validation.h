@@ -25,6 +25,7 @@
 #include "error_message/error_location.h"
 #include "error_message/record_object.h"
 #include "containers/qfo_transfer.h"
+#include "utils/hash_util.h"
 #include <spirv-tools/libspirv.hpp>
 
 typedef vvl::unordered_map<const vvl::Image*, std::optional<GlobalImageLayoutRangeMap>> GlobalImageLayoutMap;
@@ -35,6 +36,7 @@ struct DrawDispatchVuid;
 
 namespace spirv {
 struct StatelessData;
+struct EntryPoint;
 }  // namespace spirv
 
 struct SubpassLayout;
@@ -64,6 +66,50 @@ class CoreChecks : public ValidationStateTracker {
     spvtools::ValidatorOptions spirv_val_options;
     uint32_t spirv_val_option_hash;
 
+    // Matching the interface between two stages only depends on the two entry points (and on device features, which never
+    // change), so pipelines created from the same shaders, or linked from the same libraries, only need to match it once.
+    // Only interfaces that matched without any message are remembered.
+    struct StageInterfaceKey {
+        const spirv::EntryPoint* producer;
+        const spirv::EntryPoint* consumer;
+
+        bool operator==(const StageInterfaceKey& other) const {
+            return producer == other.producer && consumer == other.consumer;
+        }
+        struct Hash {
+            size_t operator()(const StageInterfaceKey& key) const {
+                hash_util::HashCombiner hc;
+                hc << key.producer << key.consumer;
+                return hc.Value();
+            }
+        };
+    };
+    // The entry points are tracked so a new entry point allocated at the address of a destroyed one is not a hit
+    struct StageInterfaceEntryPoints {
+        std::weak_ptr<const spirv::EntryPoint> producer;
+        std::weak_ptr<const spirv::EntryPoint> consumer;
+    };
+    mutable vvl::unordered_map<StageInterfaceKey, StageInterfaceEntryPoints, StageInterfaceKey::Hash> matched_stage_interfaces_;
+    mutable std::shared_mutex matched_stage_interfaces_lock_;
+
+    // With check_shaders_async, spirv-val of the shaders created by vkCreateShaderModule and vkCreateShadersEXT runs on the
+    // device thread pool once they are created, and its messages are reported at the first use of the shader (pipeline creation,
+    // vkCmdBindShadersEXT or destroy). A first use that comes before a pool thread got to the shader runs spirv-val itself.
+    struct DeferredSpirvValidation {
+        DeferredSpirvValidation(const uint32_t* code, size_t code_size, const Location& create_info_loc, uint64_t id)
+            : words(code, code + code_size / sizeof(uint32_t)), create_info_loc(create_info_loc), id(id) {}
+
+        std::vector<uint32_t> words;
+        vvl::LocationCapture create_info_loc;
+        uint64_t id;  // creation order, to report what is left at device destruction deterministically
+        std::once_flag run_once;
+        MessageBuffer messages;
+    };
+    bool defer_spirv_validation_ = false;
+    mutable vvl::unordered_map<VulkanTypedHandle, std::shared_ptr<DeferredSpirvValidation>> deferred_spirv_validations_;
+    mutable std::mutex deferred_spirv_validations_lock_;
+    uint64_t deferred_spirv_validation_count_ = 0;
+
     CoreChecks() { container_type = LayerObjectTypeCoreValidation; }
 
     ReadLockGuard ReadLock() const override;
@@ -149,6 +195,7 @@ class CoreChecks : public ValidationStateTracker {
                                            const Location& loc) const;
 
     bool ValidatePipelineVertexDivisors(const vvl::Pipeline& pipeline, const Location& create_info_loc) const;
+    bool ValidatePipelineBatch(uint32_t count, const std::function<bool(uint32_t pipe_index)>& validate_pipeline) const;
     bool ValidatePipelineCacheControlFlags(VkPipelineCreateFlags2KHR flags, const Location& loc, const char* vuid) const;
     bool ValidatePipelineIndirectBindableFlags(VkPipelineCreateFlags2KHR flags, const Location& loc, const char* vuid) const;
     bool ValidatePipelineProtectedAccessFlags(VkPipelineCreateFlags2KHR flags, const Location& loc) const;
@@ -228,6 +275,9 @@ class CoreChecks : public ValidationStateTracker {
                                 const ErrorObject& error_obj) const;
     bool ValidateMappedMemoryRangeDeviceLimits(uint32_t mem_range_count, const VkMappedMemoryRange* mem_ranges,
                                                const ErrorObject& error_obj) const;
+    // Checks of vkCmdExecuteCommands that only read the primary and one secondary, safe to run concurrently
+    bool ValidateExecutedSecondary(const vvl::CommandBuffer& cb_state, const vvl::CommandBuffer& sub_cb_state,
+                                   const QueryObject* active_occlusion_query, const Location& cb_loc, const Location& loc) const;
     bool ValidateSecondaryCommandBufferState(const vvl::CommandBuffer& cb_state, const vvl::CommandBuffer& sub_cb_state,
                                              const Location& cb_loc) const;
     bool ValidateInheritanceInfoFramebuffer(VkCommandBuffer primaryBuffer, const vvl::CommandBuffer& cb_state,
@@ -656,6 +706,23 @@ class CoreChecks : public ValidationStateTracker {
                                        const VkAllocationCallbacks* pAllocator, VkShaderEXT* pShaders,
                                        const RecordObject& record_obj, chassis::ShaderObject& chassis_state) override;
     bool RunSpirvValidation(spv_const_binary_t& binary, const Location& loc, ValidationCache* cache) const;
+    bool CanDeferSpirvValidation(const VkShaderModuleCreateInfo& create_info) const;
+    void DeferSpirvValidation(const VulkanTypedHandle& handle, const uint32_t* code, size_t code_size,
+                              const Location& create_info_loc);
+    void RunDeferredSpirvValidation(DeferredSpirvValidation& deferred) const;
+    bool ReportDeferredSpirvValidation(const VulkanTypedHandle& handle) const;
+    bool ReportDeferredSpirvValidation(const VulkanTypedHandle& handle, std::atomic<bool>& reported) const;
+    void ReportDeferredSpirvValidations();
+    void PostCallRecordCreateShaderModule(VkDevice device, const VkShaderModuleCreateInfo* pCreateInfo,
+                                          const VkAllocationCallbacks* pAllocator, VkShaderModule* pShaderModule,
+                                          const RecordObject& record_obj, chassis::CreateShaderModule& chassis_state) override;
+    void PostCallRecordCreateShadersEXT(VkDevice device, uint32_t createInfoCount, const VkShaderCreateInfoEXT* pCreateInfos,
+                                        const VkAllocationCallbacks* pAllocator, VkShaderEXT* pShaders,
+                                        const RecordObject& record_obj, chassis::ShaderObject& chassis_state) override;
+    void PreCallRecordDestroyShaderModule(VkDevice device, VkShaderModule shaderModule, const VkAllocationCallbacks* pAllocator,
+                                          const RecordObject& record_obj) override;
+    void PreCallRecordDestroyShaderEXT(VkDevice device, VkShaderEXT shader, const VkAllocationCallbacks* pAllocator,
+                                       const RecordObject& record_obj) override;
     bool ValidateSpirvStateless(const spirv::Module& module_state, const spirv::StatelessData& stateless_data,
                                 const Location& loc) const;
     bool ValidateShaderModuleCreateInfo(const VkShaderModuleCreateInfo& create_info, const Location& create_info_loc) const;
@@ -718,6 +785,11 @@ class CoreChecks : public ValidationStateTracker {
     bool ValidateSpecializations(const vku::safe_VkSpecializationInfo* spec, const Location& loc) const;
     bool ValidateInterfaceBetweenStages(const spirv::Module& producer, const spirv::EntryPoint& producer_entrypoint,
                                         const spirv::Module& consumer, const spirv::EntryPoint& consumer_entrypoint,
+                                        const Location& create_info_loc, bool& reported) const;
+    bool ValidateInterfaceBetweenStages(const spirv::Module& producer,
+                                        const std::shared_ptr<const spirv::EntryPoint>& producer_entrypoint,
+                                        const spirv::Module& consumer,
+                                        const std::shared_ptr<const spirv::EntryPoint>& consumer_entrypoint,
                                         const Location& create_info_loc) const;
     bool ValidateFsOutputsAgainstRenderPass(const spirv::Module& module_state, const spirv::EntryPoint& entrypoint,
                                             const vvl::Pipeline& pipeline, uint32_t subpass_index,
@@ -1807,9 +1879,10 @@ class CoreChecks : public ValidationStateTracker {
     bool PreCallValidateSetEvent(VkDevice device, VkEvent event, const ErrorObject& error_obj) const override;
     bool PreCallValidateResetEvent(VkDevice device, VkEvent event, const ErrorObject& error_obj) const override;
     bool PreCallValidateGetEventStatus(VkDevice device, VkEvent event, const ErrorObject& error_obj) const override;
-    bool ValidateSparseMemoryBind(const VkSparseMemoryBind& bind, const VkMemoryRequirements& requirements,
-                                  VkDeviceSize resource_size, VkExternalMemoryHandleTypeFlags external_handle_types,
-                                  const VulkanTypedHandle& resource_handle, const Location& loc) const;
+    bool ValidateSparseMemoryBind(const VkSparseMemoryBind& bind, const vvl::DeviceMemory* mem_state,
+                                  const VkMemoryRequirements& requirements, VkDeviceSize resource_size,
+                                  VkExternalMemoryHandleTypeFlags external_handle_types, const VulkanTypedHandle& resource_handle,
+                                  const Location& loc) const;
     bool ValidateImageSubresourceSparseImageMemoryBind(vvl::Image const& image_state, VkImageSubresource const& subresource,
                                                        const Location& bind_loc, const Location& subresource_loc) const;
     bool ValidateSparseImageMemoryBind(vvl::Image const* image_state, VkSparseImageMemoryBind const& bind, const Location& bind_loc,
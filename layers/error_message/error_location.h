@@ -28,6 +28,9 @@
 
 // Holds the 'Location' of where the code is inside a function/struct/etc
 // see docs/error_object.md for more details
+//
+// A Location is only a link of enum IDs pointing to its parent, it is built on every validated call,
+// so it must stay trivial to construct. Strings are only created when an error is actually logged.
 struct Location {
     static const uint32_t kNoIndex = vvl::kU32Max;
 
@@ -36,16 +39,16 @@ struct Location {
 
     const vvl::Struct structure;
     const vvl::Field field;
-    const uint32_t index;  // optional index if checking an array.
     const bool isPNext;    // will print the struct is from a 'pNext` chain
+    const uint32_t index;  // optional index if checking an array.
     const Location* prev;
 
     Location(vvl::Func func, vvl::Struct s, vvl::Field f = vvl::Field::Empty, uint32_t i = kNoIndex)
-        : function(func), structure(s), field(f), index(i), isPNext(false), prev(nullptr) {}
+        : function(func), structure(s), field(f), isPNext(false), index(i), prev(nullptr) {}
     Location(vvl::Func func, vvl::Field f = vvl::Field::Empty, uint32_t i = kNoIndex)
-        : function(func), structure(vvl::Struct::Empty), field(f), index(i), isPNext(false), prev(nullptr) {}
+        : function(func), structure(vvl::Struct::Empty), field(f), isPNext(false), index(i), prev(nullptr) {}
     Location(const Location& prev_loc, vvl::Struct s, vvl::Field f, uint32_t i, bool p)
-        : function(prev_loc.function), structure(s), field(f), index(i), isPNext(p), prev(&prev_loc) {}
+        : function(prev_loc.function), structure(s), field(f), isPNext(p), index(i), prev(&prev_loc) {}
 
     void AppendFields(std::ostream &out) const;
     std::string Fields() const;
@@ -76,6 +79,8 @@ struct Location {
     const char* StringStruct() const { return vvl::String(structure); }
     const char* StringField() const { return vvl::String(field); }
 };
+// 16-bit enum IDs and the pNext flag fit before the index, a Location is 24 bytes on 64-bit platforms
+static_assert(sizeof(Location) <= 24, "Location is built on every validated call, keep it small");
 
 // Contains the base information needed for errors to be logged out
 // Created for each function as a starting point to build off of
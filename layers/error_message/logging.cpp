@@ -16,8 +16,10 @@
  */
 #include "logging.h"
 
+#include <algorithm>
 #include <csignal>
 #include <cstring>
+#include <iterator>
 #ifdef VK_USE_PLATFORM_WIN32_KHR
 #include <debugapi.h>
 #endif
@@ -90,23 +92,87 @@ void DebugReport::RemoveDebugUtilsCallback(uint64_t callback) {
     SetDebugUtilsSeverityFlags(callbacks);
 }
 
-// Returns TRUE if the number of times this message has been logged is over the set limit
-bool DebugReport::UpdateLogMsgCounts(int32_t vuid_hash) const {
-    auto vuid_count_it = duplicate_message_count_map.find(vuid_hash);
-    if (vuid_count_it == duplicate_message_count_map.end()) {
-        duplicate_message_count_map.emplace(vuid_hash, 1);
+DuplicateMessageCounts::Counter *DuplicateMessageCounts::Find(uint32_t message_id) {
+    // 0 marks an empty slot
+    if (message_id == 0) {
+        return nullptr;
+    }
+    for (uint32_t probe = 0; probe < kMaxProbes; ++probe) {
+        Counter &counter = counters_[(message_id + probe) & (kSize - 1)];
+        const uint32_t slot_id = counter.message_id.load(std::memory_order_acquire);
+        if (slot_id == message_id) {
+            return &counter;
+        }
+        if (slot_id == 0) {
+            return nullptr;
+        }
+    }
+    return nullptr;
+}
+
+DuplicateMessageCounts::Counter *DuplicateMessageCounts::FindOrInsert(uint32_t message_id) {
+    if (message_id == 0) {
+        return nullptr;
+    }
+    for (uint32_t probe = 0; probe < kMaxProbes; ++probe) {
+        Counter &counter = counters_[(message_id + probe) & (kSize - 1)];
+        const uint32_t slot_id = counter.message_id.load(std::memory_order_relaxed);
+        if (slot_id == message_id) {
+            return &counter;
+        }
+        if (slot_id == 0) {
+            // Only one thread inserts at a time, publish the ID once the counter is ready
+            counter.count.store(0, std::memory_order_relaxed);
+            counter.message_id.store(message_id, std::memory_order_release);
+            return &counter;
+        }
+    }
+    return nullptr;
+}
+
+// Lock free check done before formatting the message, true if message_id already reached duplicate_message_limit
+bool DebugReport::IsSuppressedDuplicate(uint32_t message_id) const {
+    if (duplicate_message_limit == 0) {
         return false;
-    } else {
-        if (vuid_count_it->second >= duplicate_message_limit) {
+    }
+    DuplicateMessageCounts::Counter *counter = duplicate_message_counts.Find(message_id);
+    if (!counter || counter->count.load(std::memory_order_relaxed) < duplicate_message_limit) {
+        return false;
+    }
+    counter->suppressed.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+// Returns TRUE if the number of times this message has been logged is over the set limit
+// NOTE: the lock (debug_output_mutex) is held by the caller (LogMsg)
+bool DebugReport::UpdateLogMsgCounts(uint32_t message_id, std::string_view vuid_text) const {
+    if (DuplicateMessageCounts::Counter *counter = duplicate_message_counts.FindOrInsert(message_id)) {
+        const uint32_t count = counter->count.load(std::memory_order_relaxed);
+        if (count >= duplicate_message_limit) {
+            counter->suppressed.fetch_add(1, std::memory_order_relaxed);
             return true;
-        } else {
-            vuid_count_it->second++;
-            return false;
         }
+        if (count + 1 == duplicate_message_limit) {
+            suppressed_message_vuids.emplace(message_id, vuid_text);
+        }
+        counter->count.store(count + 1, std::memory_order_relaxed);
+        return false;
+    }
+
+    // The table is full around message_id
+    uint32_t &count = duplicate_message_count_map[message_id];
+    if (count >= duplicate_message_limit) {
+        overflow_suppressed_message_counts[message_id]++;
+        return true;
+    }
+    if (++count == duplicate_message_limit) {
+        suppressed_message_vuids.emplace(message_id, vuid_text);
     }
+    return false;
 }
 
-bool DebugReport::DebugLogMsg(VkFlags msg_flags, const LogObjectList &objects, const char *message, const char *text_vuid) const {
+bool DebugReport::DebugLogMsg(VkFlags msg_flags, const LogObjectList &objects, const char *message, const char *text_vuid,
+                              uint32_t message_id_number) const {
     bool bail = false;
     std::vector<VkDebugUtilsLabelEXT> queue_labels;
     std::vector<VkDebugUtilsLabelEXT> cmd_buf_labels;
@@ -167,8 +233,6 @@ bool DebugReport::DebugLogMsg(VkFlags msg_flags, const LogObjectList &objects, c
         object_name_infos.push_back(object_name_info);
     }
 
-    const uint32_t message_id_number = text_vuid ? hash_util::VuidHash(text_vuid) : 0U;
-
     VkDebugUtilsMessengerCallbackDataEXT callback_data = vku::InitStructHelper();
     callback_data.flags = 0;
     callback_data.pMessageIdName = text_vuid;
@@ -527,23 +591,58 @@ VKAPI_ATTR void DeactivateInstanceDebugCallbacks(DebugReport *debug_report) {
 
 // helper for VUID based filtering. This needs to be separate so it can be called before incurring
 // the cost of sprintf()-ing the err_msg needed by LogMsgLocked().
-bool DebugReport::LogMsgEnabled(std::string_view vuid_text, VkDebugUtilsMessageSeverityFlagsEXT severity,
+bool DebugReport::LogMsgEnabled(uint32_t message_id, std::string_view vuid_text, VkDebugUtilsMessageSeverityFlagsEXT severity,
                                 VkDebugUtilsMessageTypeFlagsEXT type) {
-    if (!(active_severities & severity) || !(active_types & type)) {
+    if (!LogMsgTypeEnabled(message_id, severity, type)) {
         return false;
     }
-    // If message is in filter list, bail out very early
-    const uint32_t message_id = hash_util::VuidHash(vuid_text);
-    if (filter_message_ids.find(message_id) != filter_message_ids.end()) {
+    if ((duplicate_message_limit > 0) && UpdateLogMsgCounts(message_id, vuid_text)) {
+        // Count for this particular message is over the limit, ignore it
         return false;
     }
-    if ((duplicate_message_limit > 0) && UpdateLogMsgCounts(static_cast<int32_t>(message_id))) {
-        // Count for this particular message is over the limit, ignore it
+    return true;
+}
+
+// Same as LogMsgEnabled, without counting the message against duplicate_message_limit
+bool DebugReport::LogMsgTypeEnabled(uint32_t message_id, VkDebugUtilsMessageSeverityFlagsEXT severity,
+                                    VkDebugUtilsMessageTypeFlagsEXT type) const {
+    if (!(active_severities & severity) || !(active_types & type)) {
+        return false;
+    }
+    // If message is in filter list, bail out very early
+    if (!filter_message_ids.empty() && filter_message_ids.find(message_id) != filter_message_ids.end()) {
         return false;
     }
     return true;
 }
 
+// Set by ScopedMessageBuffer, messages logged to buffered_debug_report by this thread go to message_buffer
+static thread_local const DebugReport *buffered_debug_report = nullptr;
+static thread_local MessageBuffer *message_buffer = nullptr;
+
+ScopedMessageBuffer::ScopedMessageBuffer(const DebugReport &debug_report, MessageBuffer &buffer)
+    : prev_debug_report_(buffered_debug_report), prev_buffer_(message_buffer) {
+    buffered_debug_report = &debug_report;
+    message_buffer = &buffer;
+}
+
+ScopedMessageBuffer::~ScopedMessageBuffer() {
+    buffered_debug_report = prev_debug_report_;
+    message_buffer = prev_buffer_;
+}
+
+// vuid_spec_text is generated sorted by VUID, so a binary search can be used
+static const vuid_spec_text_pair *FindVuidSpecText(std::string_view vuid_text) {
+    const auto vuid_spec_text_end = std::end(vuid_spec_text);
+    const auto it = std::lower_bound(
+        std::begin(vuid_spec_text), vuid_spec_text_end, vuid_text,
+        [](const vuid_spec_text_pair &entry, std::string_view vuid) { return std::string_view(entry.vuid) < vuid; });
+    if (it == vuid_spec_text_end || std::string_view(it->vuid) != vuid_text) {
+        return nullptr;
+    }
+    return it;
+}
+
 bool DebugReport::LogMsg(VkFlags msg_flags, const LogObjectList &objects, const Location *loc, std::string_view vuid_text,
                          const char *format, va_list argptr) {
     assert(*(vuid_text.data() + vuid_text.size()) == '\0');
@@ -552,9 +651,24 @@ bool DebugReport::LogMsg(VkFlags msg_flags, const LogObjectList &objects, const
     VkDebugUtilsMessageTypeFlagsEXT type;
 
     DebugReportFlagsToAnnotFlags(msg_flags, &severity, &type);
+    // Hash once, outside of the lock, the same ID is used for filtering and reported to the callbacks
+    const uint32_t message_id = hash_util::VuidHash(vuid_text);
+    // Messages over the duplicate limit are the common case once an application repeats an error every frame, drop them
+    // without taking the lock
+    if (IsSuppressedDuplicate(message_id)) {
+        return false;
+    }
+    MessageBuffer *const buffer = (buffered_debug_report == this) ? message_buffer : nullptr;
     std::unique_lock<std::mutex> lock(debug_output_mutex);
-    // Avoid logging cost if msg is to be ignored
-    if (!LogMsgEnabled(vuid_text, severity, type)) {
+    if (buffer) {
+        // Duplicates are counted when the buffer is reported, so the limit keeps the messages a serial run would keep
+        if (!LogMsgTypeEnabled(message_id, severity, type)) {
+            return false;
+        }
+        // Nothing shared is touched until the message is reported, other threads can log while this one formats
+        lock.unlock();
+    } else if (!LogMsgEnabled(message_id, vuid_text, severity, type)) {
+        // Avoid logging cost if msg is to be ignored
         return false;
     }
 
@@ -597,18 +711,9 @@ bool DebugReport::LogMsg(VkFlags msg_flags, const LogObjectList &objects, const
 
     // Append the spec error text to the error message, unless it contains a word treated as special
     if ((vuid_text.find("VUID-") != std::string::npos)) {
-        // Linear search makes no assumptions about the layout of the string table. This is not fast, but it does not need to be at
-        // this point in the error reporting path
-        uint32_t num_vuids = sizeof(vuid_spec_text) / sizeof(vuid_spec_text_pair);
-        const char *spec_text = nullptr;
-        std::string spec_type;
-        for (uint32_t i = 0; i < num_vuids; i++) {
-            if (0 == strncmp(vuid_text.data(), vuid_spec_text[i].vuid, vuid_text.size())) {
-                spec_text = vuid_spec_text[i].spec_text;
-                spec_type = vuid_spec_text[i].url_id;
-                break;
-            }
-        }
+        const vuid_spec_text_pair *vuid_spec_entry = FindVuidSpecText(vuid_text);
+        const char *spec_text = vuid_spec_entry ? vuid_spec_entry->spec_text : nullptr;
+        const std::string_view spec_type = vuid_spec_entry ? vuid_spec_entry->url_id : std::string_view();
 
         // Construct and append the specification text and link to the appropriate version of the spec
         if (nullptr != spec_text) {
@@ -633,7 +738,7 @@ bool DebugReport::LogMsg(VkFlags msg_flags, const LogObjectList &objects, const
 
             str_plus_spec_text.append(" The Vulkan spec states: ");
             str_plus_spec_text.append(spec_text);
-            if (0 == spec_type.compare("default")) {
+            if (spec_type == "default") {
                 str_plus_spec_text.append(" (https://github.com/KhronosGroup/Vulkan-Docs/search?q=)");
             } else {
                 str_plus_spec_text.append(" (");
@@ -643,7 +748,7 @@ bool DebugReport::LogMsg(VkFlags msg_flags, const LogObjectList &objects, const
                 std::string patch_version = std::to_string(VK_VERSION_PATCH(VK_HEADER_VERSION_COMPLETE));
                 std::string header_version = major_version + "." + minor_version + "." + patch_version;
                 std::string annotated_spec_type = major_version + "." + minor_version + "-extensions";
-                Replace(str_plus_spec_text, kKtToken, spec_type);
+                Replace(str_plus_spec_text, kKtToken, std::string(spec_type));
                 Replace(str_plus_spec_text, kAtToken, annotated_spec_type);
                 Replace(str_plus_spec_text, kVeToken, header_version);
                 str_plus_spec_text.append("#");  // CMake hates hashes
@@ -653,7 +758,74 @@ bool DebugReport::LogMsg(VkFlags msg_flags, const LogObjectList &objects, const
         }
     }
 
-    return DebugLogMsg(msg_flags, objects, str_plus_spec_text.c_str(), vuid_text.data());
+    if (buffer) {
+        buffer->push_back({msg_flags, objects, std::string(vuid_text), message_id, std::move(str_plus_spec_text)});
+        return false;
+    }
+    return DebugLogMsg(msg_flags, objects, str_plus_spec_text.c_str(), vuid_text.data(), message_id);
+}
+
+bool DebugReport::LogBufferedMessages(const MessageBuffer &messages) {
+    if (messages.empty()) {
+        return false;
+    }
+    // Reported from a thread which is itself buffering, keep the messages in that buffer's order
+    if (buffered_debug_report == this && message_buffer) {
+        message_buffer->insert(message_buffer->end(), messages.begin(), messages.end());
+        return false;
+    }
+    bool bail = false;
+    std::unique_lock<std::mutex> lock(debug_output_mutex);
+    for (const BufferedMessage &message : messages) {
+        if ((duplicate_message_limit > 0) && UpdateLogMsgCounts(message.message_id, message.vuid)) {
+            continue;
+        }
+        bail |= DebugLogMsg(message.msg_flags, message.objects, message.message.c_str(), message.vuid.c_str(), message.message_id);
+    }
+    return bail;
+}
+
+void DebugReport::LogSuppressedMessageSummary() {
+    if (duplicate_message_limit == 0) {
+        return;
+    }
+    std::unique_lock<std::mutex> lock(debug_output_mutex);
+    std::ostringstream summary;
+    uint64_t total_suppressed = 0;
+    const auto add_to_summary = [&](uint32_t message_id, uint32_t suppressed) {
+        total_suppressed += suppressed;
+        const auto vuid_it = suppressed_message_vuids.find(message_id);
+        summary << "\n    ";
+        if (vuid_it != suppressed_message_vuids.end()) {
+            summary << vuid_it->second;
+        } else {
+            summary << "MessageID = 0x" << std::hex << message_id << std::dec;
+        }
+        summary << ": " << suppressed;
+    };
+    duplicate_message_counts.ForEach([&](DuplicateMessageCounts::Counter &counter) {
+        const uint32_t suppressed = counter.suppressed.exchange(0, std::memory_order_relaxed);
+        if (suppressed != 0) {
+            add_to_summary(counter.message_id.load(std::memory_order_relaxed), suppressed);
+        }
+    });
+    // Messages which did not fit in the table are counted under the lock, sort them as the map is unordered
+    std::vector<std::pair<uint32_t, uint32_t>> overflow_suppressed(overflow_suppressed_message_counts.begin(),
+                                                                   overflow_suppressed_message_counts.end());
+    overflow_suppressed_message_counts.clear();
+    std::sort(overflow_suppressed.begin(), overflow_suppressed.end());
+    for (const auto &[message_id, suppressed] : overflow_suppressed) {
+        add_to_summary(message_id, suppressed);
+    }
+    if (total_suppressed == 0) {
+        return;
+    }
+
+    constexpr const char *kVuid = "UNASSIGNED-DuplicateMessageLimit-Summary";
+    std::ostringstream message;
+    message << total_suppressed << " messages were not reported because they reached duplicate_message_limit ("
+            << duplicate_message_limit << "):" << summary.str();
+    DebugLogMsg(kInformationBit, LogObjectList(), message.str().c_str(), kVuid, hash_util::VuidHash(kVuid));
 }
 
 VKAPI_ATTR VkBool32 VKAPI_CALL MessengerBreakCallback([[maybe_unused]] VkDebugUtilsMessageSeverityFlagBitsEXT message_severity,
@@ -18,6 +18,7 @@
 #pragma once
 
 #include <array>
+#include <atomic>
 #include <cstdarg>
 #include <mutex>
 #include <sstream>
@@ -184,6 +185,49 @@ struct MessageFormatSettings {
     std::string application_name;
 };
 
+// Fixed size table of per message ID counters used to enforce duplicate_message_limit.
+// Lookups are lock free so messages over the limit are dropped without taking debug_output_mutex,
+// insertions are done while holding it. Message IDs that do not fit fall back to a map.
+class DuplicateMessageCounts {
+  public:
+    static constexpr uint32_t kSize = 4096;
+    static constexpr uint32_t kMaxProbes = 16;
+
+    struct Counter {
+        std::atomic<uint32_t> message_id{0};
+        std::atomic<uint32_t> count{0};
+        // Messages dropped since the last summary
+        std::atomic<uint32_t> suppressed{0};
+    };
+
+    // Returns null if message_id is not in the table (and could not be inserted)
+    Counter *Find(uint32_t message_id);
+    // Caller must hold debug_output_mutex
+    Counter *FindOrInsert(uint32_t message_id);
+
+    template <typename Fn>
+    void ForEach(Fn &&fn) {
+        for (auto &counter : counters_) {
+            if (counter.message_id.load(std::memory_order_acquire) != 0) {
+                fn(counter);
+            }
+        }
+    }
+
+  private:
+    std::array<Counter, kSize> counters_;
+};
+
+// A message logged while a MessageBuffer is installed on the thread, kept until the buffer is reported
+struct BufferedMessage {
+    VkFlags msg_flags;
+    LogObjectList objects;
+    std::string vuid;
+    uint32_t message_id;
+    std::string message;
+};
+using MessageBuffer = std::vector<BufferedMessage>;
+
 class DebugReport {
   public:
     std::vector<VkLayerDbgFunctionState> debug_callback_list;
@@ -221,6 +265,11 @@ class DebugReport {
 
     bool LogMsg(VkFlags msg_flags, const LogObjectList &objects, const Location *loc, std::string_view vuid_text,
                 const char *format, va_list argptr);
+    // Report how many times each message over duplicate_message_limit was dropped since the last summary
+    void LogSuppressedMessageSummary();
+    // Send the messages of a buffer to the callbacks, in the order they were logged. Returns true if a callback asked to bail.
+    // If this thread has a ScopedMessageBuffer, the messages are appended to its buffer instead.
+    bool LogBufferedMessages(const MessageBuffer &messages);
 
     void BeginQueueDebugUtilsLabel(VkQueue queue, const VkDebugUtilsLabelEXT *label_info);
     void EndQueueDebugUtilsLabel(VkQueue queue);
@@ -233,14 +282,24 @@ class DebugReport {
     void EraseCmdDebugUtilsLabel(VkCommandBuffer command_buffer);
 
   private:
-    bool UpdateLogMsgCounts(int32_t vuid_hash) const;
-    bool DebugLogMsg(VkFlags msg_flags, const LogObjectList &objects, const char *message, const char *text_vuid) const;
-    bool LogMsgEnabled(std::string_view vuid_text, VkDebugUtilsMessageSeverityFlagsEXT severity,
+    bool IsSuppressedDuplicate(uint32_t message_id) const;
+    bool UpdateLogMsgCounts(uint32_t message_id, std::string_view vuid_text) const;
+    bool DebugLogMsg(VkFlags msg_flags, const LogObjectList &objects, const char *message, const char *text_vuid,
+                     uint32_t message_id_number) const;
+    bool LogMsgEnabled(uint32_t message_id, std::string_view vuid_text, VkDebugUtilsMessageSeverityFlagsEXT severity,
                        VkDebugUtilsMessageTypeFlagsEXT type);
+    bool LogMsgTypeEnabled(uint32_t message_id, VkDebugUtilsMessageSeverityFlagsEXT severity,
+                           VkDebugUtilsMessageTypeFlagsEXT type) const;
 
     VkDebugUtilsMessageSeverityFlagsEXT active_severities{0};
     VkDebugUtilsMessageTypeFlagsEXT active_types{0};
+    mutable DuplicateMessageCounts duplicate_message_counts;
+    // Counts of the message IDs which did not fit in duplicate_message_counts
     mutable vvl::unordered_map<uint32_t, uint32_t> duplicate_message_count_map{};
+    // Messages of duplicate_message_count_map dropped since the last summary
+    mutable vvl::unordered_map<uint32_t, uint32_t> overflow_suppressed_message_counts{};
+    // VUID of the messages which reached duplicate_message_limit, used by the summary
+    mutable vvl::unordered_map<uint32_t, std::string> suppressed_message_vuids{};
 
     vvl::unordered_map<VkQueue, std::unique_ptr<LoggingLabelState>> debug_utils_queue_labels;
     vvl::unordered_map<VkCommandBuffer, std::unique_ptr<LoggingLabelState>> debug_utils_cmd_buffer_labels;
@@ -248,6 +307,21 @@ class DebugReport {
     vvl::unordered_map<uint64_t, std::string> debug_utils_object_name_map;
 };
 
+// While in scope, messages logged to debug_report by this thread are appended to the buffer instead of being sent to the
+// callbacks, and LogMsg returns false for them. Lets work split across threads report its messages in a deterministic order
+// with DebugReport::LogBufferedMessages. The duplicate message limit is applied when the buffer is reported.
+class ScopedMessageBuffer {
+  public:
+    ScopedMessageBuffer(const DebugReport &debug_report, MessageBuffer &buffer);
+    ~ScopedMessageBuffer();
+    ScopedMessageBuffer(const ScopedMessageBuffer &) = delete;
+    ScopedMessageBuffer &operator=(const ScopedMessageBuffer &) = delete;
+
+  private:
+    const DebugReport *prev_debug_report_;
+    MessageBuffer *prev_buffer_;
+};
+
 template DebugReport *GetLayerDataPtr<DebugReport>(void *data_key, std::unordered_map<void *, DebugReport *> &data_map);
 
 VKAPI_ATTR VkResult LayerCreateMessengerCallback(DebugReport *debug_report, bool default_callback,
@@ -58,4 +58,11 @@ bool Validator::AllocateErrorLogsBuffer(gpu::DeviceMemoryBlock &error_logs_mem,
     return true;
 }
 
+VkDeviceSize Validator::GetBdaRangesBufferByteSize() const {
+    return (1                                    // 1 QWORD for the number of address ranges
+            + 2 * gpuav_settings.max_bda_in_use  // 2 QWORDS per address range
+            ) *
+           8;
+}
+
 }  // namespace gpuav
@@ -20,6 +20,7 @@
 #include "gpu/error_message/gpuav_error_message.h"
 #include "gpu/descriptor_validation/gpuav_descriptor_set.h"
 #include "gpu/resources/gpu_resources.h"
+#include "gpu/resources/gpuav_command_buffer_resources.h"
 #include "gpu/instrumentation/gpu_shader_instrumentor.h"
 
 #include <unordered_map>
@@ -70,6 +71,7 @@ class Validator : public gpu::GpuShaderInstrumentor {
                           std::vector<uint32_t>& out_instrumented_spirv) final;
     // Allocate memory for the output block that the gpu will use to return any error information
     [[nodiscard]] bool AllocateErrorLogsBuffer(gpu::DeviceMemoryBlock& error_logs_mem, const Location& loc);
+    VkDeviceSize GetBdaRangesBufferByteSize() const;
 
     // gpuav_error_message.cpp
     // ---------------------
@@ -359,6 +361,8 @@ class Validator : public gpu::GpuShaderInstrumentor {
   public:
     std::optional<DescriptorHeap> desc_heap_{};  // optional only to defer construction
     gpu::SharedResourcesManager shared_resources_manager;
+    gpu::ErrorRecordStagingPool error_record_staging_pool;
+    CommandBufferResourcesPool cmd_buffer_resources_pool{*this};
     bool bda_validation_possible = false;
 
   private:
@@ -25,6 +25,9 @@ namespace cst {
 // Number of indices held in the buffer used to index commands and validation resources
 inline constexpr uint32_t indices_count = 16384;
 
+// Size of the buffer storing an error count per validated command
+inline constexpr uint32_t cmd_errors_counts_buffer_byte_size = 8192 * sizeof(uint32_t);
+
 // Stream Output Buffer Offsets
 //
 // The following values provide offsets into the output buffer struct
@@ -172,6 +172,8 @@ void Validator::PreCallRecordDestroyDevice(VkDevice device, const VkAllocationCa
     desc_heap_.reset();
 
     shared_resources_manager.Clear();
+    // Command buffers still alive will destroy their resources when the state tracker destroys them
+    cmd_buffer_resources_pool.Destroy();
 
     if (gpuav_settings.cache_instrumented_shaders && !instrumented_shaders_cache_.IsEmpty()) {
         std::ofstream file_stream(instrumented_shader_cache_path_, std::ofstream::out | std::ofstream::binary);
@@ -490,8 +490,8 @@ void DescriptorSet::PerformPushDescriptorsUpdate(uint32_t write_count, const VkW
     current_version_++;
 }
 
-void DescriptorSet::PerformWriteUpdate(const VkWriteDescriptorSet &write_desc) {
-    vvl::DescriptorSet::PerformWriteUpdate(write_desc);
+void DescriptorSet::PerformWriteUpdates(uint32_t write_count, const VkWriteDescriptorSet *write_descs) {
+    vvl::DescriptorSet::PerformWriteUpdates(write_count, write_descs);
     current_version_++;
 }
 
@@ -46,7 +46,7 @@ class DescriptorSet : public vvl::DescriptorSet {
         std::map<uint32_t, std::vector<uint32_t>> UsedDescriptors(const DescriptorSet &set, uint32_t shader_set) const;
     };
     void PerformPushDescriptorsUpdate(uint32_t write_count, const VkWriteDescriptorSet *write_descs) override;
-    void PerformWriteUpdate(const VkWriteDescriptorSet &) override;
+    void PerformWriteUpdates(uint32_t write_count, const VkWriteDescriptorSet *write_descs) override;
     void PerformCopyUpdate(const VkCopyDescriptorSet &, const vvl::DescriptorSet &) override;
 
     VkDeviceAddress GetLayoutState();
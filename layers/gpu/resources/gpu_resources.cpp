@@ -164,4 +164,22 @@ void GpuResourcesManager::DestroyResources() {
     mem_blocks_.clear();
 }
 
+std::vector<uint32_t> ErrorRecordStagingPool::Acquire() {
+    std::lock_guard<std::mutex> guard(lock_);
+    if (free_buffers_.empty()) {
+        return {};
+    }
+    std::vector<uint32_t> staging_buffer = std::move(free_buffers_.back());
+    free_buffers_.pop_back();
+    return staging_buffer;
+}
+
+void ErrorRecordStagingPool::Release(std::vector<uint32_t> &&staging_buffer) {
+    staging_buffer.clear();
+    std::lock_guard<std::mutex> guard(lock_);
+    if (free_buffers_.size() < kMaxPooledBuffers) {
+        free_buffers_.emplace_back(std::move(staging_buffer));
+    }
+}
+
 }  // namespace gpu
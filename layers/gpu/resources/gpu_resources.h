@@ -22,6 +22,7 @@
 #include "generated/error_location_helper.h"
 #include "vma/vma.h"
 
+#include <mutex>
 #include <optional>
 #include <unordered_map>
 #include <utility>
@@ -83,6 +84,22 @@ class GpuResourcesManager {
     std::vector<gpu::DeviceMemoryBlock> mem_blocks_;
 };
 
+// Recycles the host side copies of GPU written error records.
+// Error records are copied out of the mapped output buffer as soon as a submission retires,
+// so the device memory can be cleared and unmapped before the (potentially slow) decoding starts.
+// Decoding several command buffers per retirement would otherwise allocate a new host buffer each time.
+class ErrorRecordStagingPool {
+  public:
+    std::vector<uint32_t> Acquire();
+    void Release(std::vector<uint32_t> &&staging_buffer);
+
+  private:
+    // Keep a few buffers around, one per queue retiring in parallel is the common case
+    static constexpr size_t kMaxPooledBuffers = 8;
+    std::vector<std::vector<uint32_t>> free_buffers_;
+    std::mutex lock_;
+};
+
 class SharedResourcesManager {
   public:
     template <typename T>
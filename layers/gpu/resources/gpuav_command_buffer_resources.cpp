@@ -0,0 +1,291 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gpu/resources/gpuav_command_buffer_resources.h"
+
+#include "gpu/core/gpuav.h"
+#include "gpu/core/gpuav_constants.h"
+#include "gpu/shaders/gpu_shaders_constants.h"
+#include "generated/layer_chassis_dispatch.h"
+
+#include <array>
+#include <cstring>
+
+namespace gpuav {
+
+bool CommandBufferResourcesPool::Acquire(CommandBufferResources &out_resources, const Location &loc) {
+    assert(out_resources.IsNull());
+    {
+        auto guard = Lock();
+        // The device is being destroyed, layouts must not be created again
+        if (destroyed_) {
+            return false;
+        }
+        if (!CreateDescriptorSetLayouts(loc)) {
+            return false;
+        }
+        if (!free_resources_.empty()) {
+            out_resources = free_resources_.back();
+            free_resources_.pop_back();
+            return true;
+        }
+    }
+
+    // Creating new resources does not touch the pool, no need to hold the lock
+    if (!CreateResources(out_resources, loc)) {
+        DestroyResources(out_resources);
+        return false;
+    }
+    return true;
+}
+
+void CommandBufferResourcesPool::Release(CommandBufferResources &resources, bool reusable) {
+    if (resources.IsNull()) {
+        return;
+    }
+
+    {
+        auto guard = Lock();
+        if (reusable && !destroyed_ && !gpuav_.aborted_) {
+            free_resources_.emplace_back(resources);
+            resources = {};
+            return;
+        }
+    }
+
+    DestroyResources(resources);
+}
+
+void CommandBufferResourcesPool::ReleaseRetired(CommandBufferResources &resources) {
+    if (resources.IsNull()) {
+        return;
+    }
+
+    bool cleared = false;
+    uint32_t *error_output_buffer_ptr = nullptr;
+    VkResult result = vmaMapMemory(gpuav_.vma_allocator_, resources.error_output_buffer.allocation,
+                                   reinterpret_cast<void **>(&error_output_buffer_ptr));
+    if (result == VK_SUCCESS) {
+        // Clear the written size and any error messages. Note that this preserves the first word, which contains flags.
+        std::memset(&error_output_buffer_ptr[cst::stream_output_size_offset], 0,
+                    gpuav_.output_buffer_byte_size_ - cst::stream_output_size_offset * sizeof(uint32_t));
+        vmaUnmapMemory(gpuav_.vma_allocator_, resources.error_output_buffer.allocation);
+
+        uint32_t *cmd_errors_counts_buffer_ptr = nullptr;
+        result = vmaMapMemory(gpuav_.vma_allocator_, resources.cmd_errors_counts_buffer.allocation,
+                              reinterpret_cast<void **>(&cmd_errors_counts_buffer_ptr));
+        if (result == VK_SUCCESS) {
+            std::memset(cmd_errors_counts_buffer_ptr, 0, static_cast<size_t>(cst::cmd_errors_counts_buffer_byte_size));
+            vmaUnmapMemory(gpuav_.vma_allocator_, resources.cmd_errors_counts_buffer.allocation);
+            cleared = true;
+        }
+    }
+
+    // Resources which could not be cleared are destroyed
+    Release(resources, cleared);
+}
+
+void CommandBufferResourcesPool::Destroy() {
+    auto guard = Lock();
+    for (auto &resources : free_resources_) {
+        DestroyResources(resources);
+    }
+    free_resources_.clear();
+
+    if (instrumentation_desc_set_layout_ != VK_NULL_HANDLE) {
+        DispatchDestroyDescriptorSetLayout(gpuav_.device, instrumentation_desc_set_layout_, nullptr);
+        instrumentation_desc_set_layout_ = VK_NULL_HANDLE;
+    }
+
+    if (validation_cmd_desc_set_layout_ != VK_NULL_HANDLE) {
+        DispatchDestroyDescriptorSetLayout(gpuav_.device, validation_cmd_desc_set_layout_, nullptr);
+        validation_cmd_desc_set_layout_ = VK_NULL_HANDLE;
+    }
+
+    destroyed_ = true;
+}
+
+// Lock must be held
+bool CommandBufferResourcesPool::CreateDescriptorSetLayouts(const Location &loc) {
+    VkResult result = VK_SUCCESS;
+
+    // Instrumentation descriptor set layout
+    if (instrumentation_desc_set_layout_ == VK_NULL_HANDLE) {
+        assert(!gpuav_.instrumentation_bindings_.empty());
+        VkDescriptorSetLayoutCreateInfo instrumentation_desc_set_layout_ci = vku::InitStructHelper();
+        instrumentation_desc_set_layout_ci.bindingCount = static_cast<uint32_t>(gpuav_.instrumentation_bindings_.size());
+        instrumentation_desc_set_layout_ci.pBindings = gpuav_.instrumentation_bindings_.data();
+        result = DispatchCreateDescriptorSetLayout(gpuav_.device, &instrumentation_desc_set_layout_ci, nullptr,
+                                                   &instrumentation_desc_set_layout_);
+        if (result != VK_SUCCESS) {
+            gpuav_.InternalError(gpuav_.device, loc, "Unable to create instrumentation descriptor set layout. Aborting GPU-AV.");
+            return false;
+        }
+    }
+
+    // Validation commands common descriptor set layout
+    if (validation_cmd_desc_set_layout_ == VK_NULL_HANDLE) {
+        const std::array<VkDescriptorSetLayoutBinding, 4> validation_cmd_bindings = {{
+            // Error output buffer
+            {glsl::kBindingDiagErrorBuffer, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_ALL, nullptr},
+            // Buffer holding action command index in command buffer
+            {glsl::kBindingDiagActionIndex, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC, 1, VK_SHADER_STAGE_ALL, nullptr},
+            // Buffer holding a resource index from the per command buffer command resources list
+            {glsl::kBindingDiagCmdResourceIndex, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC, 1, VK_SHADER_STAGE_ALL, nullptr},
+            // Commands errors counts buffer
+            {glsl::kBindingDiagCmdErrorsCount, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_ALL, nullptr},
+        }};
+
+        VkDescriptorSetLayoutCreateInfo validation_cmd_desc_set_layout_ci = vku::InitStructHelper();
+        validation_cmd_desc_set_layout_ci.bindingCount = static_cast<uint32_t>(validation_cmd_bindings.size());
+        validation_cmd_desc_set_layout_ci.pBindings = validation_cmd_bindings.data();
+        result = DispatchCreateDescriptorSetLayout(gpuav_.device, &validation_cmd_desc_set_layout_ci, nullptr,
+                                                   &validation_cmd_desc_set_layout_);
+        if (result != VK_SUCCESS) {
+            gpuav_.InternalError(gpuav_.device, loc,
+                                 "Unable to create descriptor set layout used for validation commands. Aborting GPU-AV.");
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool CommandBufferResourcesPool::CreateResources(CommandBufferResources &out_resources, const Location &loc) {
+    VkResult result = VK_SUCCESS;
+
+    // Error output buffer
+    if (!gpuav_.AllocateErrorLogsBuffer(out_resources.error_output_buffer, loc)) {
+        return false;
+    }
+
+    // Commands errors counts buffer
+    {
+        VkBufferCreateInfo buffer_info = vku::InitStructHelper();
+        buffer_info.size = cst::cmd_errors_counts_buffer_byte_size;
+        buffer_info.usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
+        VmaAllocationCreateInfo alloc_info = {};
+        alloc_info.requiredFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+        alloc_info.pool = gpuav_.output_buffer_pool_;
+        result = vmaCreateBuffer(gpuav_.vma_allocator_, &buffer_info, &alloc_info, &out_resources.cmd_errors_counts_buffer.buffer,
+                                 &out_resources.cmd_errors_counts_buffer.allocation, nullptr);
+        if (result != VK_SUCCESS) {
+            gpuav_.InternalError(gpuav_.device, loc,
+                                 "Unable to allocate device memory for commands errors counts buffer. Aborting GPU-AV.", true);
+            return false;
+        }
+
+        uint32_t *cmd_errors_counts_buffer_ptr = nullptr;
+        result = vmaMapMemory(gpuav_.vma_allocator_, out_resources.cmd_errors_counts_buffer.allocation,
+                              reinterpret_cast<void **>(&cmd_errors_counts_buffer_ptr));
+        if (result != VK_SUCCESS) {
+            gpuav_.InternalError(gpuav_.device, loc,
+                                 "Unable to map device memory for commands errors counts buffer. Aborting GPU-AV.", true);
+            return false;
+        }
+        std::memset(cmd_errors_counts_buffer_ptr, 0, static_cast<size_t>(cst::cmd_errors_counts_buffer_byte_size));
+        vmaUnmapMemory(gpuav_.vma_allocator_, out_resources.cmd_errors_counts_buffer.allocation);
+    }
+
+    // BDA snapshot
+    if (gpuav_.gpuav_settings.validate_bda) {
+        VkBufferCreateInfo buffer_info = vku::InitStructHelper();
+        buffer_info.usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
+        VmaAllocationCreateInfo alloc_info = {};
+        buffer_info.size = gpuav_.GetBdaRangesBufferByteSize();
+        // This buffer could be very large if an application uses many buffers. Allocating it as HOST_CACHED
+        // and manually flushing it at the end of the state updates is faster than using HOST_COHERENT.
+        alloc_info.requiredFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_CACHED_BIT;
+        result = vmaCreateBuffer(gpuav_.vma_allocator_, &buffer_info, &alloc_info, &out_resources.bda_ranges_snapshot.buffer,
+                                 &out_resources.bda_ranges_snapshot.allocation, nullptr);
+        if (result != VK_SUCCESS) {
+            gpuav_.InternalError(gpuav_.device, loc,
+                                 "Unable to allocate device memory for buffer device address data. Aborting GPU-AV.", true);
+            return false;
+        }
+    }
+
+    // Validation commands common descriptor set
+    {
+        result = gpuav_.desc_set_manager_->GetDescriptorSet(&out_resources.validation_cmd_desc_pool,
+                                                            validation_cmd_desc_set_layout_, &out_resources.validation_cmd_desc_set);
+        if (result != VK_SUCCESS) {
+            gpuav_.InternalError(gpuav_.device, loc, "Unable to create descriptor set used for validation commands. Aborting GPU-AV.");
+            return false;
+        }
+
+        std::array<VkWriteDescriptorSet, 4> validation_cmd_descriptor_writes = {};
+
+        VkDescriptorBufferInfo error_output_buffer_desc_info = {};
+        error_output_buffer_desc_info.buffer = out_resources.error_output_buffer.buffer;
+        error_output_buffer_desc_info.offset = 0;
+        error_output_buffer_desc_info.range = VK_WHOLE_SIZE;
+
+        validation_cmd_descriptor_writes[0] = vku::InitStructHelper();
+        validation_cmd_descriptor_writes[0].dstBinding = glsl::kBindingDiagErrorBuffer;
+        validation_cmd_descriptor_writes[0].descriptorCount = 1;
+        validation_cmd_descriptor_writes[0].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        validation_cmd_descriptor_writes[0].pBufferInfo = &error_output_buffer_desc_info;
+        validation_cmd_descriptor_writes[0].dstSet = out_resources.validation_cmd_desc_set;
+
+        VkDescriptorBufferInfo cmd_indices_buffer_desc_info = {};
+        cmd_indices_buffer_desc_info.buffer = gpuav_.indices_buffer_.buffer;
+        cmd_indices_buffer_desc_info.offset = 0;
+        cmd_indices_buffer_desc_info.range = sizeof(uint32_t);
+
+        validation_cmd_descriptor_writes[1] = vku::InitStructHelper();
+        validation_cmd_descriptor_writes[1].dstBinding = glsl::kBindingDiagActionIndex;
+        validation_cmd_descriptor_writes[1].descriptorCount = 1;
+        validation_cmd_descriptor_writes[1].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC;
+        validation_cmd_descriptor_writes[1].pBufferInfo = &cmd_indices_buffer_desc_info;
+        validation_cmd_descriptor_writes[1].dstSet = out_resources.validation_cmd_desc_set;
+
+        validation_cmd_descriptor_writes[2] = validation_cmd_descriptor_writes[1];
+        validation_cmd_descriptor_writes[2].dstBinding = glsl::kBindingDiagCmdResourceIndex;
+
+        VkDescriptorBufferInfo cmd_errors_count_buffer_desc_info = {};
+        cmd_errors_count_buffer_desc_info.buffer = out_resources.cmd_errors_counts_buffer.buffer;
+        cmd_errors_count_buffer_desc_info.offset = 0;
+        cmd_errors_count_buffer_desc_info.range = VK_WHOLE_SIZE;
+
+        validation_cmd_descriptor_writes[3] = vku::InitStructHelper();
+        validation_cmd_descriptor_writes[3].dstBinding = glsl::kBindingDiagCmdErrorsCount;
+        validation_cmd_descriptor_writes[3].descriptorCount = 1;
+        validation_cmd_descriptor_writes[3].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        validation_cmd_descriptor_writes[3].pBufferInfo = &cmd_errors_count_buffer_desc_info;
+        validation_cmd_descriptor_writes[3].dstSet = out_resources.validation_cmd_desc_set;
+
+        DispatchUpdateDescriptorSets(gpuav_.device, static_cast<uint32_t>(validation_cmd_descriptor_writes.size()),
+                                     validation_cmd_descriptor_writes.data(), 0, nullptr);
+    }
+
+    return true;
+}
+
+void CommandBufferResourcesPool::DestroyResources(CommandBufferResources &resources) {
+    resources.error_output_buffer.Destroy(gpuav_.vma_allocator_);
+    resources.cmd_errors_counts_buffer.Destroy(gpuav_.vma_allocator_);
+    resources.bda_ranges_snapshot.Destroy(gpuav_.vma_allocator_);
+
+    if (resources.validation_cmd_desc_pool != VK_NULL_HANDLE && resources.validation_cmd_desc_set != VK_NULL_HANDLE) {
+        gpuav_.desc_set_manager_->PutBackDescriptorSet(resources.validation_cmd_desc_pool, resources.validation_cmd_desc_set);
+    }
+    resources.validation_cmd_desc_pool = VK_NULL_HANDLE;
+    resources.validation_cmd_desc_set = VK_NULL_HANDLE;
+}
+
+}  // namespace gpuav
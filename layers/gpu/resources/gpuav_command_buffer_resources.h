@@ -0,0 +1,87 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <mutex>
+#include <vector>
+
+#include "gpu/resources/gpu_resources.h"
+
+struct Location;
+
+namespace gpuav {
+
+class Validator;
+
+// Resources every command buffer needs to run GPU-AV, whatever was recorded in it
+struct CommandBufferResources {
+    // Buffer storing GPU-AV errors
+    gpu::DeviceMemoryBlock error_output_buffer = {};
+    // Buffer storing an error count per validated commands.
+    // Used to limit the number of errors a single command can emit.
+    gpu::DeviceMemoryBlock cmd_errors_counts_buffer = {};
+    // Buffer storing a snapshot of buffer device address ranges
+    gpu::DeviceMemoryBlock bda_ranges_snapshot = {};
+
+    // Bindings: {error output buffer, action index, command resource index, commands errors counts buffer}
+    // Written once, when the resources are created
+    VkDescriptorPool validation_cmd_desc_pool = VK_NULL_HANDLE;
+    VkDescriptorSet validation_cmd_desc_set = VK_NULL_HANDLE;
+
+    bool IsNull() const { return error_output_buffer.buffer == VK_NULL_HANDLE; }
+};
+
+// Recycles CommandBufferResources across command buffers, so that applications allocating and freeing
+// transient command buffers every frame do not create and destroy buffers and descriptor sets at the same rate.
+// The pool grows up to the high watermark of simultaneously alive command buffers.
+// Resources are only given back once the GPU is done writing to them. A command buffer reset or freed while its last
+// submission has not been post processed keeps its resources aside, and gives them back when that submission retires.
+class CommandBufferResourcesPool {
+  public:
+    explicit CommandBufferResourcesPool(Validator &gpuav) : gpuav_(gpuav) {}
+
+    // Return false if resources could not be created, or if the pool was destroyed. GPU-AV is aborted in the first case.
+    bool Acquire(CommandBufferResources &out_resources, const Location &loc);
+    // If reusable is false, the error buffers may hold data not yet post processed, resources are destroyed
+    void Release(CommandBufferResources &resources, bool reusable);
+    // Release resources whose submission retired, the errors they hold are dropped instead of post processed
+    void ReleaseRetired(CommandBufferResources &resources);
+
+    // Layouts are shared by all command buffers, they are created along the first resources
+    VkDescriptorSetLayout GetInstrumentationDescriptorSetLayout() const { return instrumentation_desc_set_layout_; }
+    VkDescriptorSetLayout GetValidationCmdCommonDescriptorSetLayout() const { return validation_cmd_desc_set_layout_; }
+
+    // Destroy pooled resources. Resources released afterwards are destroyed right away.
+    void Destroy();
+
+  private:
+    std::unique_lock<std::mutex> Lock() const { return std::unique_lock<std::mutex>(lock_); }
+
+    bool CreateDescriptorSetLayouts(const Location &loc);
+    bool CreateResources(CommandBufferResources &out_resources, const Location &loc);
+    void DestroyResources(CommandBufferResources &resources);
+
+    Validator &gpuav_;
+    VkDescriptorSetLayout instrumentation_desc_set_layout_ = VK_NULL_HANDLE;
+    VkDescriptorSetLayout validation_cmd_desc_set_layout_ = VK_NULL_HANDLE;
+    std::vector<CommandBufferResources> free_resources_;
+    bool destroyed_ = false;
+    mutable std::mutex lock_;
+};
+
+}  // namespace gpuav
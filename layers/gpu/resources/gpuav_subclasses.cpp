@@ -128,155 +128,23 @@ CommandBuffer::CommandBuffer(Validator &gpuav, VkCommandBuffer handle, const VkC
 }
 
 void CommandBuffer::AllocateResources() {
-    using Func = vvl::Func;
-
     auto gpuav = static_cast<Validator *>(&dev_data);
+    // Acquired resources may come from another command buffer, bda_ranges_snapshot_version_ being 0
+    // makes sure BDA ranges get uploaded again
+    assert(bda_ranges_snapshot_version_ == 0);
+    gpuav->cmd_buffer_resources_pool.Acquire(resources_, Location(vvl::Func::vkAllocateCommandBuffers));
+}
 
-    VkResult result = VK_SUCCESS;
-
-    // Instrumentation descriptor set layout
-    if (instrumentation_desc_set_layout_ == VK_NULL_HANDLE) {
-        assert(!gpuav->instrumentation_bindings_.empty());
-        VkDescriptorSetLayoutCreateInfo instrumentation_desc_set_layout_ci = vku::InitStructHelper();
-        instrumentation_desc_set_layout_ci.bindingCount = static_cast<uint32_t>(gpuav->instrumentation_bindings_.size());
-        instrumentation_desc_set_layout_ci.pBindings = gpuav->instrumentation_bindings_.data();
-        result = DispatchCreateDescriptorSetLayout(gpuav->device, &instrumentation_desc_set_layout_ci, nullptr,
-                                                   &instrumentation_desc_set_layout_);
-        if (result != VK_SUCCESS) {
-            gpuav->InternalError(gpuav->device, Location(Func::vkAllocateCommandBuffers),
-                                 "Unable to create instrumentation descriptor set layout. Aborting GPU-AV.");
-            return;
-        }
-    }
-
-    // Error output buffer
-    if (!gpuav->AllocateErrorLogsBuffer(error_output_buffer_, Location(Func::vkAllocateCommandBuffers))) {
-        return;
-    }
-
-    // Commands errors counts buffer
-    {
-        VkBufferCreateInfo buffer_info = vku::InitStructHelper();
-        buffer_info.size = GetCmdErrorsCountsBufferByteSize();
-        buffer_info.usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
-        VmaAllocationCreateInfo alloc_info = {};
-        alloc_info.requiredFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
-        alloc_info.pool = gpuav->output_buffer_pool_;
-        result = vmaCreateBuffer(gpuav->vma_allocator_, &buffer_info, &alloc_info, &cmd_errors_counts_buffer_.buffer,
-                                 &cmd_errors_counts_buffer_.allocation, nullptr);
-        if (result != VK_SUCCESS) {
-            gpuav->InternalError(gpuav->device, Location(Func::vkAllocateCommandBuffers),
-                                 "Unable to allocate device memory for commands errors counts buffer. Aborting GPU-AV.", true);
-            return;
-        }
-
-        ClearCmdErrorsCountsBuffer();
-        if (gpuav->aborted_) return;
-    }
-
-    // BDA snapshot
-    if (gpuav->gpuav_settings.validate_bda) {
-        VkBufferCreateInfo buffer_info = vku::InitStructHelper();
-        buffer_info.usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
-        VmaAllocationCreateInfo alloc_info = {};
-        buffer_info.size = GetBdaRangesBufferByteSize();
-        // This buffer could be very large if an application uses many buffers. Allocating it as HOST_CACHED
-        // and manually flushing it at the end of the state updates is faster than using HOST_COHERENT.
-        alloc_info.requiredFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_CACHED_BIT;
-        result = vmaCreateBuffer(gpuav->vma_allocator_, &buffer_info, &alloc_info, &bda_ranges_snapshot_.buffer,
-                                 &bda_ranges_snapshot_.allocation, nullptr);
-        if (result != VK_SUCCESS) {
-            gpuav->InternalError(gpuav->device, Location(Func::vkAllocateCommandBuffers),
-                                 "Unable to allocate device memory for buffer device address data. Aborting GPU-AV.", true);
-            return;
-        }
-    }
-
-    // Update validation commands common descriptor set
-    {
-        const std::vector<VkDescriptorSetLayoutBinding> validation_cmd_bindings = {
-            // Error output buffer
-            {glsl::kBindingDiagErrorBuffer, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_ALL, nullptr},
-            // Buffer holding action command index in command buffer
-            {glsl::kBindingDiagActionIndex, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC, 1, VK_SHADER_STAGE_ALL, nullptr},
-            // Buffer holding a resource index from the per command buffer command resources list
-            {glsl::kBindingDiagCmdResourceIndex, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC, 1, VK_SHADER_STAGE_ALL, nullptr},
-            // Commands errors counts buffer
-            {glsl::kBindingDiagCmdErrorsCount, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_ALL, nullptr},
-        };
-
-        if (validation_cmd_desc_set_layout_ == VK_NULL_HANDLE) {
-            VkDescriptorSetLayoutCreateInfo validation_cmd_desc_set_layout_ci = vku::InitStructHelper();
-            validation_cmd_desc_set_layout_ci.bindingCount = static_cast<uint32_t>(validation_cmd_bindings.size());
-            validation_cmd_desc_set_layout_ci.pBindings = validation_cmd_bindings.data();
-            result = DispatchCreateDescriptorSetLayout(gpuav->device, &validation_cmd_desc_set_layout_ci, nullptr,
-                                                       &validation_cmd_desc_set_layout_);
-            if (result != VK_SUCCESS) {
-                gpuav->InternalError(gpuav->device, Location(Func::vkAllocateCommandBuffers),
-                                     "Unable to create descriptor set layout used for validation commands. Aborting GPU-AV.");
-                return;
-            }
-        }
-
-        assert(validation_cmd_desc_pool_ == VK_NULL_HANDLE);
-        assert(validation_cmd_desc_set_ == VK_NULL_HANDLE);
-        result = gpuav->desc_set_manager_->GetDescriptorSet(&validation_cmd_desc_pool_, validation_cmd_desc_set_layout_,
-                                                            &validation_cmd_desc_set_);
-        if (result != VK_SUCCESS) {
-            gpuav->InternalError(gpuav->device, Location(Func::vkAllocateCommandBuffers),
-                                 "Unable to create descriptor set used for validation commands. Aborting GPU-AV.");
-            return;
-        }
+VkDescriptorSetLayout CommandBuffer::GetInstrumentationDescriptorSetLayout() const {
+    const VkDescriptorSetLayout layout = state_.cmd_buffer_resources_pool.GetInstrumentationDescriptorSetLayout();
+    assert(layout != VK_NULL_HANDLE);
+    return layout;
+}
 
-        std::array<VkWriteDescriptorSet, 4> validation_cmd_descriptor_writes = {};
-        assert(validation_cmd_bindings.size() == validation_cmd_descriptor_writes.size());
-
-        VkDescriptorBufferInfo error_output_buffer_desc_info = {};
-
-        assert(error_output_buffer_.buffer != VK_NULL_HANDLE);
-        error_output_buffer_desc_info.buffer = error_output_buffer_.buffer;
-        error_output_buffer_desc_info.offset = 0;
-        error_output_buffer_desc_info.range = VK_WHOLE_SIZE;
-
-        validation_cmd_descriptor_writes[0] = vku::InitStructHelper();
-        validation_cmd_descriptor_writes[0].dstBinding = glsl::kBindingDiagErrorBuffer;
-        validation_cmd_descriptor_writes[0].descriptorCount = 1;
-        validation_cmd_descriptor_writes[0].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
-        validation_cmd_descriptor_writes[0].pBufferInfo = &error_output_buffer_desc_info;
-        validation_cmd_descriptor_writes[0].dstSet = GetValidationCmdCommonDescriptorSet();
-
-        VkDescriptorBufferInfo cmd_indices_buffer_desc_info = {};
-
-        assert(error_output_buffer_.buffer != VK_NULL_HANDLE);
-        cmd_indices_buffer_desc_info.buffer = gpuav->indices_buffer_.buffer;
-        cmd_indices_buffer_desc_info.offset = 0;
-        cmd_indices_buffer_desc_info.range = sizeof(uint32_t);
-
-        validation_cmd_descriptor_writes[1] = vku::InitStructHelper();
-        validation_cmd_descriptor_writes[1].dstBinding = glsl::kBindingDiagActionIndex;
-        validation_cmd_descriptor_writes[1].descriptorCount = 1;
-        validation_cmd_descriptor_writes[1].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC;
-        validation_cmd_descriptor_writes[1].pBufferInfo = &cmd_indices_buffer_desc_info;
-        validation_cmd_descriptor_writes[1].dstSet = GetValidationCmdCommonDescriptorSet();
-
-        validation_cmd_descriptor_writes[2] = validation_cmd_descriptor_writes[1];
-        validation_cmd_descriptor_writes[2].dstBinding = glsl::kBindingDiagCmdResourceIndex;
-
-        VkDescriptorBufferInfo cmd_errors_count_buffer_desc_info = {};
-        cmd_errors_count_buffer_desc_info.buffer = GetCmdErrorsCountsBuffer();
-        cmd_errors_count_buffer_desc_info.offset = 0;
-        cmd_errors_count_buffer_desc_info.range = VK_WHOLE_SIZE;
-
-        validation_cmd_descriptor_writes[3] = vku::InitStructHelper();
-        validation_cmd_descriptor_writes[3].dstBinding = glsl::kBindingDiagCmdErrorsCount;
-        validation_cmd_descriptor_writes[3].descriptorCount = 1;
-        validation_cmd_descriptor_writes[3].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
-        validation_cmd_descriptor_writes[3].pBufferInfo = &cmd_errors_count_buffer_desc_info;
-        validation_cmd_descriptor_writes[3].dstSet = GetValidationCmdCommonDescriptorSet();
-
-        DispatchUpdateDescriptorSets(gpuav->device, static_cast<uint32_t>(validation_cmd_descriptor_writes.size()),
-                                     validation_cmd_descriptor_writes.data(), 0, NULL);
-    }
+VkDescriptorSetLayout CommandBuffer::GetValidationCmdCommonDescriptorSetLayout() const {
+    const VkDescriptorSetLayout layout = state_.cmd_buffer_resources_pool.GetValidationCmdCommonDescriptorSetLayout();
+    assert(layout != VK_NULL_HANDLE);
+    return layout;
 }
 
 bool CommandBuffer::UpdateBdaRangesBuffer() {
@@ -290,9 +158,9 @@ bool CommandBuffer::UpdateBdaRangesBuffer() {
     // Update buffer device address table
     // ---
     VkDeviceAddress *bda_table_ptr = nullptr;
-    assert(bda_ranges_snapshot_.allocation);
-    VkResult result =
-        vmaMapMemory(gpuav->vma_allocator_, bda_ranges_snapshot_.allocation, reinterpret_cast<void **>(&bda_table_ptr));
+    assert(resources_.bda_ranges_snapshot.allocation);
+    VkResult result = vmaMapMemory(gpuav->vma_allocator_, resources_.bda_ranges_snapshot.allocation,
+                                   reinterpret_cast<void **>(&bda_table_ptr));
     assert(result == VK_SUCCESS);
     if (result != VK_SUCCESS) {
         if (result != VK_SUCCESS) {
@@ -312,7 +180,7 @@ bool CommandBuffer::UpdateBdaRangesBuffer() {
     // QWord 5 | ...
 
     const size_t max_recordable_ranges =
-        static_cast<size_t>((GetBdaRangesBufferByteSize() - sizeof(uint64_t)) / (2 * sizeof(VkDeviceAddress)));
+        static_cast<size_t>((gpuav->GetBdaRangesBufferByteSize() - sizeof(uint64_t)) / (2 * sizeof(VkDeviceAddress)));
     auto bda_ranges = reinterpret_cast<ValidationStateTracker::BufferAddressRange *>(bda_table_ptr + 1);
     const auto [ranges_to_update_count, total_address_ranges_count] =
         gpuav->GetBufferAddressRanges(bda_ranges, max_recordable_ranges);
@@ -331,23 +199,22 @@ bool CommandBuffer::UpdateBdaRangesBuffer() {
     // Post update cleanups
     // ---
     // Flush the BDA buffer before un-mapping so that the new state is visible to the GPU
-    result = vmaFlushAllocation(gpuav->vma_allocator_, bda_ranges_snapshot_.allocation, 0, VK_WHOLE_SIZE);
-    vmaUnmapMemory(gpuav->vma_allocator_, bda_ranges_snapshot_.allocation);
+    result = vmaFlushAllocation(gpuav->vma_allocator_, resources_.bda_ranges_snapshot.allocation, 0, VK_WHOLE_SIZE);
+    vmaUnmapMemory(gpuav->vma_allocator_, resources_.bda_ranges_snapshot.allocation);
     bda_ranges_snapshot_version_ = gpuav->buffer_device_address_ranges_version;
 
     return true;
 }
 
-VkDeviceSize CommandBuffer::GetBdaRangesBufferByteSize() const {
+CommandBuffer::~CommandBuffer() {
+    Destroy();
+    // Submissions hold a reference to the command buffers they use, nothing can still be pending at this point
     auto gpuav = static_cast<Validator *>(&dev_data);
-    return (1                                           // 1 QWORD for the number of address ranges
-            + 2 * gpuav->gpuav_settings.max_bda_in_use  // 2 QWORDS per address range
-            ) *
-           8;
+    for (CommandBufferResources &resources : resources_pending_retirement_) {
+        gpuav->cmd_buffer_resources_pool.Release(resources, false);
+    }
 }
 
-CommandBuffer::~CommandBuffer() { Destroy(); }
-
 void CommandBuffer::Destroy() {
     {
         auto guard = WriteLock();
@@ -378,26 +245,18 @@ void CommandBuffer::ResetCBState() {
     di_input_buffer_list.clear();
     current_bindless_buffer = VK_NULL_HANDLE;
 
-    error_output_buffer_.Destroy(gpuav->vma_allocator_);
-    cmd_errors_counts_buffer_.Destroy(gpuav->vma_allocator_);
-    bda_ranges_snapshot_.Destroy(gpuav->vma_allocator_);
-    bda_ranges_snapshot_version_ = 0;
-
-    if (validation_cmd_desc_pool_ != VK_NULL_HANDLE && validation_cmd_desc_set_ != VK_NULL_HANDLE) {
-        gpuav->desc_set_manager_->PutBackDescriptorSet(validation_cmd_desc_pool_, validation_cmd_desc_set_);
-        validation_cmd_desc_pool_ = VK_NULL_HANDLE;
-        validation_cmd_desc_set_ = VK_NULL_HANDLE;
-    }
-
-    if (instrumentation_desc_set_layout_ != VK_NULL_HANDLE) {
-        DispatchDestroyDescriptorSetLayout(gpuav->device, instrumentation_desc_set_layout_, nullptr);
-        instrumentation_desc_set_layout_ = VK_NULL_HANDLE;
-    }
-
-    if (validation_cmd_desc_set_layout_ != VK_NULL_HANDLE) {
-        DispatchDestroyDescriptorSetLayout(gpuav->device, validation_cmd_desc_set_layout_, nullptr);
-        validation_cmd_desc_set_layout_ = VK_NULL_HANDLE;
+    // Resources can be handed to another command buffer only if the GPU is done writing to them,
+    // and what it wrote has been cleared when post processing the last submission.
+    // Otherwise they are kept until that submission retires.
+    if (pending_post_process_.exchange(false)) {
+        if (!resources_.IsNull()) {
+            resources_pending_retirement_.emplace_back(resources_);
+            resources_ = {};
+        }
+    } else {
+        gpuav->cmd_buffer_resources_pool.Release(resources_, true);
     }
+    bda_ranges_snapshot_version_ = 0;
 
     draw_index = 0;
     compute_index = 0;
@@ -407,7 +266,7 @@ void CommandBuffer::ResetCBState() {
 void CommandBuffer::ClearCmdErrorsCountsBuffer() const {
     auto gpuav = static_cast<Validator *>(&dev_data);
     uint32_t *cmd_errors_counts_buffer_ptr = nullptr;
-    VkResult result = vmaMapMemory(gpuav->vma_allocator_, cmd_errors_counts_buffer_.allocation,
+    VkResult result = vmaMapMemory(gpuav->vma_allocator_, resources_.cmd_errors_counts_buffer.allocation,
                                    reinterpret_cast<void **>(&cmd_errors_counts_buffer_ptr));
     if (result != VK_SUCCESS) {
         gpuav->InternalError(gpuav->device, Location(vvl::Func::vkAllocateCommandBuffers),
@@ -415,12 +274,14 @@ void CommandBuffer::ClearCmdErrorsCountsBuffer() const {
         return;
     }
     std::memset(cmd_errors_counts_buffer_ptr, 0, static_cast<size_t>(GetCmdErrorsCountsBufferByteSize()));
-    vmaUnmapMemory(gpuav->vma_allocator_, cmd_errors_counts_buffer_.allocation);
+    vmaUnmapMemory(gpuav->vma_allocator_, resources_.cmd_errors_counts_buffer.allocation);
 }
 
 bool CommandBuffer::PreProcess() {
     auto gpuav = static_cast<Validator *>(&dev_data);
 
+    pending_post_process_ = true;
+
     bool succeeded = UpdateBindlessStateBuffer(*gpuav, *this, state_.vma_allocator_);
     if (!succeeded) {
         return false;
@@ -434,10 +295,87 @@ bool CommandBuffer::PreProcess() {
     return !per_command_error_loggers.empty() || has_build_as_cmd;
 }
 
-bool CommandBuffer::NeedsPostProcess() { return !error_output_buffer_.IsNull(); }
+bool CommandBuffer::NeedsPostProcess() { return !resources_.IsNull(); }
+
+bool CommandBuffer::SnapshotErrorOutputBuffer(std::vector<uint32_t> &out_error_records) {
+    auto gpuav = static_cast<Validator *>(&dev_data);
+    uint32_t *error_output_buffer_ptr = nullptr;
+    VkResult result = vmaMapMemory(gpuav->vma_allocator_, resources_.error_output_buffer.allocation,
+                                   reinterpret_cast<void **>(&error_output_buffer_ptr));
+    assert(result == VK_SUCCESS);
+    if (result != VK_SUCCESS) {
+        return false;
+    }
+
+    // The second word in the debug output buffer is the number of words that would have
+    // been written by the shader instrumentation, if there was enough room in the buffer we provided.
+    // The number of words actually written by the shaders is determined by the size of the buffer
+    // we provide via the descriptor. So, we process only the number of words that can fit in the
+    // buffer.
+    const uint32_t total_words = error_output_buffer_ptr[cst::stream_output_size_offset];
+    // A zero here means that the shader instrumentation didn't write anything.
+    if (total_words != 0) {
+        assert(gpuav->output_buffer_byte_size_ > cst::stream_output_data_offset * sizeof(uint32_t));
+        const uint32_t max_record_words =
+            gpuav->output_buffer_byte_size_ / sizeof(uint32_t) - static_cast<uint32_t>(cst::stream_output_data_offset);
+        const uint32_t record_words = std::min(total_words, max_record_words);
+        const uint32_t *const error_records_start = &error_output_buffer_ptr[cst::stream_output_data_offset];
+        // Only copy what was written, keeping a zero terminator so that decoding stops on a zero record size
+        out_error_records.assign(error_records_start, error_records_start + record_words);
+        out_error_records.emplace_back(0);
+
+        // Clear the written size and any error messages. Note that this preserves the first word, which contains flags.
+        memset(&error_output_buffer_ptr[cst::stream_output_data_offset], 0, record_words * sizeof(uint32_t));
+    }
+    error_output_buffer_ptr[cst::stream_output_size_offset] = 0;
+    vmaUnmapMemory(gpuav->vma_allocator_, resources_.error_output_buffer.allocation);
+
+    // Shaders only increment a command error count right before writing an error record,
+    // so counts can only be non zero if something was written to the error output buffer.
+    if (total_words != 0) {
+        ClearCmdErrorsCountsBuffer();
+    }
+
+    return true;
+}
+
+bool CommandBuffer::LogErrorRecords(VkQueue queue, const std::vector<uint32_t> &error_records) {
+    auto gpuav = static_cast<Validator *>(&dev_data);
+    bool skip = false;
+    if (error_records.empty()) {
+        return skip;
+    }
 
-// For the given command buffer, map its debug data buffers and read their contents for analysis.
+    const uint32_t *error_record_ptr = error_records.data();
+    const uint32_t *const error_records_end = error_records.data() + error_records.size();
+    uint32_t record_size = error_record_ptr[glsl::kHeaderErrorRecordSizeOffset];
+    assert(record_size == glsl::kErrorRecordSize);
+
+    const LogObjectList objlist(queue, VkHandle());
+    while (record_size > 0 && (error_record_ptr + record_size) < error_records_end) {
+        const uint32_t error_logger_i = error_record_ptr[glsl::kHeaderCommandResourceIdOffset];
+        assert(error_logger_i < per_command_error_loggers.size());
+        auto &error_logger = per_command_error_loggers[error_logger_i];
+        skip |= error_logger(*gpuav, error_record_ptr, objlist);
+
+        // Next record
+        error_record_ptr += record_size;
+        record_size = error_record_ptr[glsl::kHeaderErrorRecordSizeOffset];
+    }
+    return skip;
+}
+
+// For the given command buffer, snapshot its error output buffer and decode the error records found in it.
+// The device side buffers are cleared and unmapped before any error message is generated,
+// decoding only works on the host copy.
 void CommandBuffer::PostProcess(VkQueue queue, const Location &loc) {
+    auto gpuav = static_cast<Validator *>(&dev_data);
+    // The recording these resources were used by was reset or freed, its errors are not reported
+    for (CommandBufferResources &resources : resources_pending_retirement_) {
+        gpuav->cmd_buffer_resources_pool.ReleaseRetired(resources);
+    }
+    resources_pending_retirement_.clear();
+
     // CommandBuffer::Destroy can happen on an other thread,
     // so when getting here after acquiring command buffer's lock,
     // make sure there are still things to process
@@ -445,53 +383,21 @@ void CommandBuffer::PostProcess(VkQueue queue, const Location &loc) {
         return;
     }
 
-    auto gpuav = static_cast<Validator *>(&dev_data);
-    bool skip = false;
-    uint32_t *error_output_buffer_ptr = nullptr;
-    VkResult result =
-        vmaMapMemory(gpuav->vma_allocator_, error_output_buffer_.allocation, reinterpret_cast<void **>(&error_output_buffer_ptr));
-    assert(result == VK_SUCCESS);
-    if (result == VK_SUCCESS) {
-        // The second word in the debug output buffer is the number of words that would have
-        // been written by the shader instrumentation, if there was enough room in the buffer we provided.
-        // The number of words actually written by the shaders is determined by the size of the buffer
-        // we provide via the descriptor. So, we process only the number of words that can fit in the
-        // buffer.
-        const uint32_t total_words = error_output_buffer_ptr[cst::stream_output_size_offset];
-        // A zero here means that the shader instrumentation didn't write anything.
-        if (total_words != 0) {
-            uint32_t *const error_records_start = &error_output_buffer_ptr[cst::stream_output_data_offset];
-            assert(gpuav->output_buffer_byte_size_ > cst::stream_output_data_offset);
-            uint32_t *const error_records_end =
-                error_output_buffer_ptr + (gpuav->output_buffer_byte_size_ - cst::stream_output_data_offset);
-
-            uint32_t *error_record_ptr = error_records_start;
-            uint32_t record_size = error_record_ptr[glsl::kHeaderErrorRecordSizeOffset];
-            assert(record_size == glsl::kErrorRecordSize);
-
-            while (record_size > 0 && (error_record_ptr + record_size) <= error_records_end) {
-                const uint32_t error_logger_i = error_record_ptr[glsl::kHeaderCommandResourceIdOffset];
-                assert(error_logger_i < per_command_error_loggers.size());
-                auto &error_logger = per_command_error_loggers[error_logger_i];
-                const LogObjectList objlist(queue, VkHandle());
-                skip |= error_logger(*gpuav, error_record_ptr, objlist);
-
-                // Next record
-                error_record_ptr += record_size;
-                record_size = error_record_ptr[glsl::kHeaderErrorRecordSizeOffset];
-            }
-
-            // Clear the written size and any error messages. Note that this preserves the first word, which contains flags.
-            assert(gpuav->output_buffer_byte_size_ > cst::stream_output_data_offset);
-            memset(&error_output_buffer_ptr[cst::stream_output_data_offset], 0,
-                   gpuav->output_buffer_byte_size_ - cst::stream_output_data_offset * sizeof(uint32_t));
-        }
-        error_output_buffer_ptr[cst::stream_output_size_offset] = 0;
-        vmaUnmapMemory(gpuav->vma_allocator_, error_output_buffer_.allocation);
+    std::vector<uint32_t> error_records = gpuav->error_record_staging_pool.Acquire();
+    const bool snapshot_taken = SnapshotErrorOutputBuffer(error_records);
+    if (snapshot_taken) {
+        pending_post_process_ = false;
+    }
+    if (gpuav->aborted_) {
+        gpuav->error_record_staging_pool.Release(std::move(error_records));
+        return;
     }
 
-    ClearCmdErrorsCountsBuffer();
-    if (gpuav->aborted_) return;
+    bool skip = false;
+    if (snapshot_taken) {
+        skip |= LogErrorRecords(queue, error_records);
+    }
+    gpuav->error_record_staging_pool.Release(std::move(error_records));
 
     // If instrumentation found an error, skip post processing. Errors detected by instrumentation are usually
     // very serious, such as a prematurely destroyed resource and the state needed below is likely invalid.
@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <vector>
 #include <mutex>
 
@@ -24,6 +25,8 @@
 #include "gpu/core/gpu_state_tracker.h"
 #include "gpu/descriptor_validation/gpuav_descriptor_set.h"
 #include "gpu/resources/gpu_resources.h"
+#include "gpu/resources/gpuav_command_buffer_resources.h"
+#include "gpu/core/gpuav_constants.h"
 #include "generated/vk_object_types.h"
 #include "gpu/shaders/gpu_shaders_constants.h"
 
@@ -86,37 +89,31 @@ class CommandBuffer : public gpu_tracker::CommandBuffer {
     void PostProcess(VkQueue queue, const Location &loc) final;
     [[nodiscard]] bool ValidateBindlessDescriptorSets();
 
-    const VkDescriptorSetLayout &GetInstrumentationDescriptorSetLayout() const {
-        assert(instrumentation_desc_set_layout_ != VK_NULL_HANDLE);
-        return instrumentation_desc_set_layout_;
-    }
+    VkDescriptorSetLayout GetInstrumentationDescriptorSetLayout() const;
 
     // Bindings: {error output buffer}
     const VkDescriptorSet &GetValidationCmdCommonDescriptorSet() const {
-        assert(validation_cmd_desc_set_ != VK_NULL_HANDLE);
-        return validation_cmd_desc_set_;
+        assert(resources_.validation_cmd_desc_set != VK_NULL_HANDLE);
+        return resources_.validation_cmd_desc_set;
     }
 
-    const VkDescriptorSetLayout &GetValidationCmdCommonDescriptorSetLayout() const {
-        assert(validation_cmd_desc_set_layout_ != VK_NULL_HANDLE);
-        return validation_cmd_desc_set_layout_;
-    }
+    VkDescriptorSetLayout GetValidationCmdCommonDescriptorSetLayout() const;
 
     uint32_t GetValidationErrorBufferDescSetIndex() const { return 0; }
 
     const VkBuffer &GetErrorOutputBuffer() const {
-        assert(error_output_buffer_.buffer != VK_NULL_HANDLE);
-        return error_output_buffer_.buffer;
+        assert(resources_.error_output_buffer.buffer != VK_NULL_HANDLE);
+        return resources_.error_output_buffer.buffer;
     }
 
-    VkDeviceSize GetCmdErrorsCountsBufferByteSize() const { return 8192 * sizeof(uint32_t); }
+    VkDeviceSize GetCmdErrorsCountsBufferByteSize() const { return cst::cmd_errors_counts_buffer_byte_size; }
 
     const VkBuffer &GetCmdErrorsCountsBuffer() const {
-        assert(cmd_errors_counts_buffer_.buffer != VK_NULL_HANDLE);
-        return cmd_errors_counts_buffer_.buffer;
+        assert(resources_.cmd_errors_counts_buffer.buffer != VK_NULL_HANDLE);
+        return resources_.cmd_errors_counts_buffer.buffer;
     }
 
-    const gpu::DeviceMemoryBlock &GetBdaRangesSnapshot() const { return bda_ranges_snapshot_; }
+    const gpu::DeviceMemoryBlock &GetBdaRangesSnapshot() const { return resources_.bda_ranges_snapshot; }
 
     void ClearCmdErrorsCountsBuffer() const;
 
@@ -133,25 +130,23 @@ class CommandBuffer : public gpu_tracker::CommandBuffer {
     void AllocateResources();
     void ResetCBState();
     bool NeedsPostProcess();
+    // Copy the error records written by the GPU to out_error_records, then clear the device side buffers.
+    // Return false if the error output buffer could not be accessed.
+    [[nodiscard]] bool SnapshotErrorOutputBuffer(std::vector<uint32_t> &out_error_records);
+    // Return true iff an error was logged
+    bool LogErrorRecords(VkQueue queue, const std::vector<uint32_t> &error_records);
 
-    VkDeviceSize GetBdaRangesBufferByteSize() const;
     [[nodiscard]] bool UpdateBdaRangesBuffer();
 
     Validator &state_;
 
-    VkDescriptorSetLayout instrumentation_desc_set_layout_ = VK_NULL_HANDLE;
-
-    VkDescriptorSetLayout validation_cmd_desc_set_layout_ = VK_NULL_HANDLE;
-    VkDescriptorSet validation_cmd_desc_set_ = VK_NULL_HANDLE;
-    VkDescriptorPool validation_cmd_desc_pool_ = VK_NULL_HANDLE;
-
-    // Buffer storing GPU-AV errors
-    gpu::DeviceMemoryBlock error_output_buffer_ = {};
-    // Buffer storing an error count per validated commands.
-    // Used to limit the number of errors a single command can emit.
-    gpu::DeviceMemoryBlock cmd_errors_counts_buffer_ = {};
-    // Buffer storing a snapshot of buffer device address ranges
-    gpu::DeviceMemoryBlock bda_ranges_snapshot_ = {};
+    // Taken from, and given back to, the device level CommandBufferResourcesPool
+    CommandBufferResources resources_ = {};
+    // Set when submitted, cleared once the submission retired and error buffers have been post processed.
+    // Resources are only recycled when there is no pending post processing.
+    std::atomic<bool> pending_post_process_{false};
+    // Resources released by a reset or free while a submission was pending, given back to the pool when it retires
+    std::vector<CommandBufferResources> resources_pending_retirement_;
     uint32_t bda_ranges_snapshot_version_ = 0;
 };
 
@@ -57,6 +57,7 @@ const char *VK_LAYER_UNIQUE_HANDLES = "unique_handles";
 const char *VK_LAYER_OBJECT_LIFETIME = "object_lifetime";
 const char *VK_LAYER_CHECK_SHADERS = "check_shaders";
 const char *VK_LAYER_CHECK_SHADERS_CACHING = "check_shaders_caching";
+const char *VK_LAYER_CHECK_SHADERS_ASYNC = "check_shaders_async";
 const char *VK_LAYER_VALIDATE_SYNC_QUEUE_SUBMIT = "sync_queue_submit";
 
 const char *VK_LAYER_MESSAGE_ID_FILTER = "message_id_filter";
@@ -626,6 +627,7 @@ void ProcessConfigAndEnvSettings(ConfigAndEnvSettings *settings_data) {
         SetValidationSetting(layer_setting_set, settings_data->disables, object_tracking, VK_LAYER_OBJECT_LIFETIME);
         SetValidationSetting(layer_setting_set, settings_data->disables, shader_validation, VK_LAYER_CHECK_SHADERS);
         SetValidationSetting(layer_setting_set, settings_data->disables, shader_validation_caching, VK_LAYER_CHECK_SHADERS_CACHING);
+        SetValidationSetting(layer_setting_set, settings_data->enables, shader_validation_async, VK_LAYER_CHECK_SHADERS_ASYNC);
         SetValidationSetting(layer_setting_set, settings_data->disables, sync_validation_queue_submit,
                              VK_LAYER_VALIDATE_SYNC_QUEUE_SUBMIT);
     }
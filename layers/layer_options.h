@@ -79,6 +79,7 @@ enum EnableFlags {
     vendor_specific_nvidia,
     debug_printf_validation,
     sync_validation,
+    shader_validation_async,
     // Insert new enables above this line
     kMaxEnableFlags,
 };
@@ -172,6 +173,7 @@ static const std::vector<std::string> EnableFlagNameHelper = {
     "VALIDATION_CHECK_ENABLE_VENDOR_SPECIFIC_NVIDIA",                      // vendor_specific_nvidia,
     "VK_VALIDATION_FEATURE_ENABLE_DEBUG_PRINTF_EXT",                       // debug_printf,
     "VK_VALIDATION_FEATURE_ENABLE_SYNCHRONIZATION_VALIDATION",             // sync_validation,
+    "VALIDATION_CHECK_ENABLE_SHADER_VALIDATION_ASYNC",                     // shader_validation_async,
 };
 
 void ProcessConfigAndEnvSettings(ConfigAndEnvSettings *settings_data);
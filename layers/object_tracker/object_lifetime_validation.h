@@ -31,7 +31,7 @@ struct ObjTrackState {
     VulkanObjectType object_type;                                  // Object type identifier
     ObjectStatusFlags status;                                      // Object state
     uint64_t parent_object;                                        // Parent object
-    std::unique_ptr<vvl::unordered_set<uint64_t> > child_objects;  // Child objects (used for VkDescriptorPool only)
+    std::unique_ptr<vvl::unordered_set<uint64_t> > child_objects;  // Child objects (VkDescriptorPool and VkCommandPool only)
 };
 
 typedef vvl::concurrent_unordered_map<uint64_t, std::shared_ptr<ObjTrackState>, 6> object_map_type;
@@ -145,7 +145,7 @@ class ObjectLifetimes : public ValidationObject {
             num_objects[object_type]++;
             num_total_objects++;
 
-            if (object_type == kVulkanObjectTypeDescriptorPool) {
+            if (object_type == kVulkanObjectTypeDescriptorPool || object_type == kVulkanObjectTypeCommandPool) {
                 pNewObjNode->child_objects.reset(new vvl::unordered_set<uint64_t>);
             }
         }
@@ -175,11 +175,13 @@ void ObjectLifetimes::DestroyQueueDataStructures() {
 }
 
 void ObjectLifetimes::DestroyUndestroyedObjects(VulkanObjectType object_type) {
-    auto snapshot = object_map[object_type].snapshot();
-    for (const auto &item : snapshot) {
-        auto object_info = item.second;
-        DestroyObjectSilently(object_info->handle, object_type);
-    }
+    // The parent is being destroyed, no other thread can use these objects anymore.
+    // Drop them all at once instead of popping (and locking a bucket for) each one of them.
+    if (num_objects[object_type] == 0) return;
+    object_map[object_type].clear();
+    const uint64_t count = num_objects[object_type].exchange(0);
+    assert(num_total_objects >= count);
+    num_total_objects -= count;
 }
 
 bool ObjectLifetimes::ValidateAnonymousObject(uint64_t object, VkObjectType core_object_type, const char *invalid_handle_vuid,
@@ -198,6 +200,11 @@ void ObjectLifetimes::AllocateCommandBuffer(const VkCommandPool command_pool, co
     InsertObject(object_map[kVulkanObjectTypeCommandBuffer], command_buffer, kVulkanObjectTypeCommandBuffer, loc, new_obj_node);
     num_objects[kVulkanObjectTypeCommandBuffer]++;
     num_total_objects++;
+
+    auto itr = object_map[kVulkanObjectTypeCommandPool].find(HandleToUint64(command_pool));
+    if (itr != object_map[kVulkanObjectTypeCommandPool].end()) {
+        itr->second->child_objects->insert(HandleToUint64(command_buffer));
+    }
 }
 
 bool ObjectLifetimes::ValidateCommandBuffer(VkCommandPool command_pool, VkCommandBuffer command_buffer, const Location &loc) const {
@@ -426,6 +433,7 @@ void ObjectLifetimes::CreateSwapchainImageObject(VkImage swapchain_image, VkSwap
 bool ObjectLifetimes::ReportLeakedInstanceObjects(VkInstance instance, VulkanObjectType object_type, const std::string &error_code,
                                                   const Location &loc) const {
     bool skip = false;
+    if (num_objects[object_type] == 0) return skip;
 
     auto snapshot = object_map[object_type].snapshot();
     for (const auto &item : snapshot) {
@@ -440,6 +448,7 @@ bool ObjectLifetimes::ReportLeakedInstanceObjects(VkInstance instance, VulkanObj
 bool ObjectLifetimes::ReportLeakedDeviceObjects(VkDevice device, VulkanObjectType object_type, const std::string &error_code,
                                                 const Location &loc) const {
     bool skip = false;
+    if (num_objects[object_type] == 0) return skip;
 
     auto snapshot = object_map[object_type].snapshot();
     for (const auto &item : snapshot) {
@@ -753,6 +762,7 @@ bool ObjectLifetimes::PreCallValidateAllocateCommandBuffers(VkDevice device, con
 void ObjectLifetimes::PostCallRecordAllocateCommandBuffers(VkDevice device, const VkCommandBufferAllocateInfo *pAllocateInfo,
                                                            VkCommandBuffer *pCommandBuffers, const RecordObject &record_obj) {
     if (record_obj.result < VK_SUCCESS) return;
+    auto lock = WriteSharedLock();
     for (uint32_t i = 0; i < pAllocateInfo->commandBufferCount; i++) {
         AllocateCommandBuffer(pAllocateInfo->commandPool, pCommandBuffers[i], pAllocateInfo->level,
                               record_obj.location.dot(Field::pCommandBuffers, i));
@@ -808,7 +818,16 @@ bool ObjectLifetimes::PreCallValidateFreeCommandBuffers(VkDevice device, VkComma
 
 void ObjectLifetimes::PreCallRecordFreeCommandBuffers(VkDevice device, VkCommandPool commandPool, uint32_t commandBufferCount,
                                                       const VkCommandBuffer *pCommandBuffers, const RecordObject &record_obj) {
+    auto lock = WriteSharedLock();
     for (uint32_t i = 0; i < commandBufferCount; i++) {
+        // Use the pool the command buffer was allocated from, commandPool could be the wrong one
+        auto cb_itr = object_map[kVulkanObjectTypeCommandBuffer].find(HandleToUint64(pCommandBuffers[i]));
+        if (cb_itr != object_map[kVulkanObjectTypeCommandBuffer].end()) {
+            auto pool_itr = object_map[kVulkanObjectTypeCommandPool].find(cb_itr->second->parent_object);
+            if (pool_itr != object_map[kVulkanObjectTypeCommandPool].end()) {
+                pool_itr->second->child_objects->erase(HandleToUint64(pCommandBuffers[i]));
+            }
+        }
         RecordDestroyObject(pCommandBuffers[i], kVulkanObjectTypeCommandBuffer);
     }
 }
@@ -902,6 +921,7 @@ void ObjectLifetimes::PreCallRecordDestroyDescriptorPool(VkDevice device, VkDesc
 bool ObjectLifetimes::PreCallValidateDestroyCommandPool(VkDevice device, VkCommandPool commandPool,
                                                         const VkAllocationCallbacks *pAllocator,
                                                         const ErrorObject &error_obj) const {
+    auto lock = ReadSharedLock();
     bool skip = false;
     // Checked by chassis: device: "VUID-vkDestroyCommandPool-device-parameter"
 
@@ -909,13 +929,14 @@ bool ObjectLifetimes::PreCallValidateDestroyCommandPool(VkDevice device, VkComma
     skip |= ValidateObject(commandPool, kVulkanObjectTypeCommandPool, true, "VUID-vkDestroyCommandPool-commandPool-parameter",
                            "VUID-vkDestroyCommandPool-commandPool-parent", command_pool_loc);
 
-    auto snapshot = object_map[kVulkanObjectTypeCommandBuffer].snapshot(
-        [commandPool](const std::shared_ptr<ObjTrackState> &pNode) { return pNode->parent_object == HandleToUint64(commandPool); });
-    for (const auto &itr : snapshot) {
-        auto node = itr.second;
-        skip |= ValidateCommandBuffer(commandPool, reinterpret_cast<VkCommandBuffer>(itr.first), command_pool_loc);
-        skip |= ValidateDestroyObject(reinterpret_cast<VkCommandBuffer>(itr.first), kVulkanObjectTypeCommandBuffer, nullptr,
-                                      kVUIDUndefined, kVUIDUndefined, error_obj.location);
+    auto itr = object_map[kVulkanObjectTypeCommandPool].find(HandleToUint64(commandPool));
+    if (itr != object_map[kVulkanObjectTypeCommandPool].end()) {
+        auto pool_node = itr->second;
+        for (auto command_buffer : *pool_node->child_objects) {
+            skip |= ValidateCommandBuffer(commandPool, reinterpret_cast<VkCommandBuffer>(command_buffer), command_pool_loc);
+            skip |= ValidateDestroyObject(reinterpret_cast<VkCommandBuffer>(command_buffer), kVulkanObjectTypeCommandBuffer,
+                                          nullptr, kVUIDUndefined, kVUIDUndefined, error_obj.location);
+        }
     }
     skip |=
         ValidateDestroyObject(commandPool, kVulkanObjectTypeCommandPool, pAllocator, "VUID-vkDestroyCommandPool-commandPool-00042",
@@ -925,11 +946,15 @@ bool ObjectLifetimes::PreCallValidateDestroyCommandPool(VkDevice device, VkComma
 
 void ObjectLifetimes::PreCallRecordDestroyCommandPool(VkDevice device, VkCommandPool commandPool,
                                                       const VkAllocationCallbacks *pAllocator, const RecordObject &record_obj) {
-    auto snapshot = object_map[kVulkanObjectTypeCommandBuffer].snapshot(
-        [commandPool](const std::shared_ptr<ObjTrackState> &pNode) { return pNode->parent_object == HandleToUint64(commandPool); });
+    auto lock = WriteSharedLock();
     // A CommandPool's cmd buffers are implicitly deleted when pool is deleted. Remove this pool's cmdBuffers from cmd buffer map.
-    for (const auto &itr : snapshot) {
-        RecordDestroyObject(reinterpret_cast<VkCommandBuffer>(itr.first), kVulkanObjectTypeCommandBuffer);
+    auto itr = object_map[kVulkanObjectTypeCommandPool].find(HandleToUint64(commandPool));
+    if (itr != object_map[kVulkanObjectTypeCommandPool].end()) {
+        auto pool_node = itr->second;
+        for (auto command_buffer : *pool_node->child_objects) {
+            RecordDestroyObject(reinterpret_cast<VkCommandBuffer>(command_buffer), kVulkanObjectTypeCommandBuffer);
+        }
+        pool_node->child_objects->clear();
     }
     RecordDestroyObject(commandPool, kVulkanObjectTypeCommandPool);
 }
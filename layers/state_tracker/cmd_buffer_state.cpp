@@ -279,6 +279,8 @@ void CommandBuffer::ResetCBState() {
     cmd_execute_commands_functions.clear();
     eventUpdates.clear();
     queryUpdates.clear();
+    execute_summary.reset();
+    ClearReplayCache();
 
     for (auto &item : lastBound) {
         item.Reset();
@@ -406,6 +408,8 @@ void CommandBuffer::NotifyInvalidate(const StateObject::NodeList &invalid_nodes,
             }
             broken_bindings.emplace(invalid_nodes[0]->Handle(), log_list);
         }
+        // A linked secondary command buffer may have been reset or re-recorded
+        ClearReplayCache();
     }
     StateObject::NotifyInvalidate(invalid_nodes, unlink);
 }
@@ -464,7 +468,7 @@ std::shared_ptr<ImageSubresourceLayoutMap> CommandBuffer::GetImageSubresourceLay
 }
 
 static bool SetQueryState(const QueryObject &object, QueryState value, QueryMap *localQueryToStateMap) {
-    (*localQueryToStateMap)[object] = value;
+    localQueryToStateMap->Set(object, value);
     return false;
 }
 
@@ -476,7 +480,7 @@ void CommandBuffer::BeginQuery(const QueryObject &query_obj) {
         SetQueryState(QueryObject(query_obj, perfQueryPass), QUERYSTATE_RUNNING, localQueryToStateMap);
         return false;
     });
-    updatedQueries.insert(query_obj);
+    updatedQueries.Set(QueryObject(query_obj, 0), QUERYSTATE_RUNNING);
     if (query_obj.inside_render_pass) {
         renderPassQueries.insert(query_obj);
     }
@@ -488,7 +492,7 @@ void CommandBuffer::EndQuery(const QueryObject &query_obj) {
                                           uint32_t perfQueryPass, QueryMap *localQueryToStateMap) {
         return SetQueryState(QueryObject(query_obj, perfQueryPass), QUERYSTATE_ENDED, localQueryToStateMap);
     });
-    updatedQueries.insert(query_obj);
+    updatedQueries.Set(QueryObject(query_obj, 0), QUERYSTATE_ENDED);
     if (query_obj.inside_render_pass) {
         renderPassQueries.erase(query_obj);
     }
@@ -496,31 +500,25 @@ void CommandBuffer::EndQuery(const QueryObject &query_obj) {
 
 bool CommandBuffer::UpdatesQuery(const QueryObject &query_obj) const {
     // Clear out the perf_pass from the caller because it isn't known when the command buffer is recorded.
-    auto key = query_obj;
-    key.perf_pass = 0;
     for (auto *sub_cb : linkedCommandBuffers) {
-        if (sub_cb->updatedQueries.find(key) != sub_cb->updatedQueries.end()) {
+        if (sub_cb->updatedQueries.Contains(query_obj.pool, query_obj.slot, 0)) {
             return true;
         }
     }
-    return updatedQueries.find(key) != updatedQueries.end();
+    return updatedQueries.Contains(query_obj.pool, query_obj.slot, 0);
 }
 
 static bool SetQueryStateMulti(VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount, uint32_t perfPass, QueryState value,
                                QueryMap *localQueryToStateMap) {
-    for (uint32_t i = 0; i < queryCount; i++) {
-        QueryObject query_obj = {queryPool, firstQuery + i, perfPass};
-        (*localQueryToStateMap)[query_obj] = value;
-    }
+    localQueryToStateMap->SetRange(queryPool, firstQuery, queryCount, perfPass, value);
     return false;
 }
 
 void CommandBuffer::EndQueries(VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount) {
     for (uint32_t slot = firstQuery; slot < (firstQuery + queryCount); slot++) {
-        QueryObject query_obj = {queryPool, slot};
-        activeQueries.erase(query_obj);
-        updatedQueries.insert(query_obj);
+        activeQueries.erase(QueryObject(queryPool, slot));
     }
+    updatedQueries.SetRange(queryPool, firstQuery, queryCount, 0, QUERYSTATE_ENDED);
     queryUpdates.emplace_back([queryPool, firstQuery, queryCount](CommandBuffer &cb_state_arg, bool do_validate,
                                                                   VkQueryPool &firstPerfQueryPool, uint32_t perfQueryPass,
                                                                   QueryMap *localQueryToStateMap) {
@@ -529,10 +527,7 @@ void CommandBuffer::EndQueries(VkQueryPool queryPool, uint32_t firstQuery, uint3
 }
 
 void CommandBuffer::ResetQueryPool(VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount) {
-    for (uint32_t slot = firstQuery; slot < (firstQuery + queryCount); slot++) {
-        QueryObject query_obj = {queryPool, slot};
-        updatedQueries.insert(query_obj);
-    }
+    updatedQueries.SetRange(queryPool, firstQuery, queryCount, 0, QUERYSTATE_RESET);
 
     queryUpdates.emplace_back([queryPool, firstQuery, queryCount](CommandBuffer &cb_state_arg, bool do_validate,
                                                                   VkQueryPool &firstPerfQueryPool, uint32_t perfQueryPass,
@@ -905,14 +900,10 @@ void CommandBuffer::ControlVideoCoding(const VkVideoCodingControlInfoKHR *pContr
 void vvl::CommandBuffer::EnqueueUpdateVideoInlineQueries(const VkVideoInlineQueryInfoKHR &query_info) {
     queryUpdates.emplace_back([query_info](vvl::CommandBuffer &cb_state_arg, bool do_validate, VkQueryPool &firstPerfQueryPool,
                                            uint32_t perfQueryPass, QueryMap *localQueryToStateMap) {
-        for (uint32_t i = 0; i < query_info.queryCount; i++) {
-            SetQueryState(QueryObject(query_info.queryPool, query_info.firstQuery + i), QUERYSTATE_ENDED, localQueryToStateMap);
-        }
+        localQueryToStateMap->SetRange(query_info.queryPool, query_info.firstQuery, query_info.queryCount, 0, QUERYSTATE_ENDED);
         return false;
     });
-    for (uint32_t i = 0; i < query_info.queryCount; i++) {
-        updatedQueries.insert(QueryObject(query_info.queryPool, query_info.firstQuery + i));
-    }
+    updatedQueries.SetRange(query_info.queryPool, query_info.firstQuery, query_info.queryCount, 0, QUERYSTATE_ENDED);
 }
 
 void CommandBuffer::DecodeVideo(const VkVideoDecodeInfoKHR *pDecodeInfo) {
@@ -1055,13 +1046,22 @@ void CommandBuffer::Begin(const VkCommandBufferBeginInfo *pBeginInfo) {
         initial_device_mask = (1 << dev_data.physical_device_count) - 1;
     }
     performance_lock_acquired = dev_data.performance_lock_acquired;
-    updatedQueries.clear();
+    updatedQueries.Clear();
 }
 
 void CommandBuffer::End(VkResult result) {
     if (VK_SUCCESS == result) {
         state = CbState::Recorded;
     }
+    if (IsSeconary()) {
+        // A secondary is never submitted on its own, the primaries executing it are the only users of its callbacks
+        auto summary = std::make_shared<ExecuteSummary>();
+        summary->event_updates = std::move(eventUpdates);
+        summary->queue_submit_functions = std::move(queue_submit_functions);
+        eventUpdates.clear();
+        queue_submit_functions.clear();
+        execute_summary = std::move(summary);
+    }
 }
 
 void CommandBuffer::ExecuteCommands(vvl::span<const VkCommandBuffer> secondary_command_buffers) {
@@ -1108,15 +1108,40 @@ void CommandBuffer::ExecuteCommands(vvl::span<const VkCommandBuffer> secondary_c
             }
             return skip;
         });
-        for (auto &function : sub_cb_state->eventUpdates) {
-            eventUpdates.push_back(function);
+        if (const auto summary = sub_cb_state->execute_summary) {
+            // The same secondaries are executed over and over, replay their summary instead of copying each callback
+            if (!summary->event_updates.empty()) {
+                eventUpdates.emplace_back([summary](CommandBuffer &cb_state_arg, bool do_validate,
+                                                    EventMap &local_event_signal_info, VkQueue waiting_queue, const Location &loc) {
+                    bool skip = false;
+                    for (const auto &function : summary->event_updates) {
+                        skip |= function(cb_state_arg, do_validate, local_event_signal_info, waiting_queue, loc);
+                    }
+                    return skip;
+                });
+            }
+            if (!summary->queue_submit_functions.empty()) {
+                queue_submit_functions.emplace_back([summary](const ValidationStateTracker &device_data,
+                                                              const vvl::Queue &queue_state, const CommandBuffer &cb_state_arg) {
+                    bool skip = false;
+                    for (const auto &function : summary->queue_submit_functions) {
+                        skip |= function(device_data, queue_state, cb_state_arg);
+                    }
+                    return skip;
+                });
+            }
+        } else {
+            // Secondary was not ended, which is reported by CoreChecks
+            for (auto &function : sub_cb_state->eventUpdates) {
+                eventUpdates.push_back(function);
+            }
+            for (auto &function : sub_cb_state->queue_submit_functions) {
+                queue_submit_functions.push_back(function);
+            }
         }
         for (auto &event : sub_cb_state->events) {
             events.push_back(event);
         }
-        for (auto &function : sub_cb_state->queue_submit_functions) {
-            queue_submit_functions.push_back(function);
-        }
 
         // State is trashed after executing secondary command buffers.
         // Importantly, this function runs after CoreChecks::PreCallValidateCmdExecuteCommands.
@@ -1609,30 +1634,57 @@ void CommandBuffer::RecordWriteTimestamp(Func command, VkPipelineStageFlags2KHR
     EndQuery(query_obj);
 }
 
-void CommandBuffer::Submit(VkQueue queue, uint32_t perf_submit_pass, const Location &loc) {
-    // Update vvl::QueryPool with a query state at the end of the command buffer.
-    // Ultimately, it tracks the final query state for the entire submission.
-    {
+void CommandBuffer::ClearReplayCache() {
+    replayed_query_states_.clear();
+    replayed_query_update_count_ = 0;
+    replayed_event_states_.reset();
+    replayed_event_update_count_ = 0;
+}
+
+const QueryMap &CommandBuffer::GetReplayedQueryStates(uint32_t perf_submit_pass) {
+    // Updates are only appended while recording, a different count means the cache is from a previous recording
+    if (replayed_query_update_count_ != queryUpdates.size()) {
+        replayed_query_states_.clear();
+        replayed_query_update_count_ = queryUpdates.size();
+    }
+    auto [it, inserted] = replayed_query_states_.try_emplace(perf_submit_pass);
+    if (inserted) {
         VkQueryPool first_pool = VK_NULL_HANDLE;
-        QueryMap local_query_to_state_map;
         for (auto &function : queryUpdates) {
-            function(*this, /*do_validate*/ false, first_pool, perf_submit_pass, &local_query_to_state_map);
+            function(*this, /*do_validate*/ false, first_pool, perf_submit_pass, &it->second);
         }
-        for (const auto &query_state_pair : local_query_to_state_map) {
-            auto query_pool_state = dev_data.Get<vvl::QueryPool>(query_state_pair.first.pool);
-            if (!query_pool_state) continue;
-            query_pool_state->SetQueryState(query_state_pair.first.slot, query_state_pair.first.perf_pass, query_state_pair.second);
+    }
+    return it->second;
+}
+
+const EventMap &CommandBuffer::GetReplayedEventStates(const Location &loc) {
+    if (!replayed_event_states_ || replayed_event_update_count_ != eventUpdates.size()) {
+        replayed_event_states_.emplace();
+        replayed_event_update_count_ = eventUpdates.size();
+        for (const auto &function : eventUpdates) {
+            function(*this, /*do_validate*/ false, *replayed_event_states_,
+                     VK_NULL_HANDLE /* when do_validate is false then wait handler is inactive */, loc);
         }
     }
+    return *replayed_event_states_;
+}
+
+void CommandBuffer::Submit(VkQueue queue, uint32_t perf_submit_pass, const Location &loc) {
+    // Update vvl::QueryPool with a query state at the end of the command buffer.
+    // Ultimately, it tracks the final query state for the entire submission.
+    {
+        const QueryMap &local_query_to_state_map = GetReplayedQueryStates(perf_submit_pass);
+        local_query_to_state_map.ForEachPool([this](VkQueryPool pool, uint32_t perf_pass, const QuerySlotStates &states) {
+            auto query_pool_state = dev_data.Get<vvl::QueryPool>(pool);
+            if (!query_pool_state) return;
+            query_pool_state->SetQueryStates(perf_pass, states);
+        });
+    }
 
     // Update vvl::Event with src_stage from the last recorded SetEvent.
     // Ultimately, it tracks the last SetEvent for the entire submission.
     {
-        EventMap local_event_signal_info;
-        for (const auto &function : eventUpdates) {
-            function(*this, /*do_validate*/ false, local_event_signal_info,
-                     VK_NULL_HANDLE /* when do_validate is false then wait handler is inactive */, loc);
-        }
+        const EventMap &local_event_signal_info = GetReplayedEventStates(loc);
         for (const auto &[event, info] : local_event_signal_info) {
             auto event_state = dev_data.Get<vvl::Event>(event);
             event_state->signaled = info.signal;
@@ -1658,19 +1710,31 @@ void CommandBuffer::Retire(uint32_t perf_submit_pass, const std::function<bool(c
             event_state->write_in_use--;
         }
     }
-    QueryMap local_query_to_state_map;
-    VkQueryPool first_pool = VK_NULL_HANDLE;
-    for (auto &function : queryUpdates) {
-        function(*this, /*do_validate*/ false, first_pool, perf_submit_pass, &local_query_to_state_map);
-    }
-
-    for (const auto &query_state_pair : local_query_to_state_map) {
-        if (query_state_pair.second == QUERYSTATE_ENDED && !is_query_updated_after(query_state_pair.first)) {
-            auto query_pool_state = dev_data.Get<vvl::QueryPool>(query_state_pair.first.pool);
-            if (!query_pool_state) continue;
-            query_pool_state->SetQueryState(query_state_pair.first.slot, query_state_pair.first.perf_pass, QUERYSTATE_AVAILABLE);
-        }
-    }
+    const QueryMap &local_query_to_state_map = GetReplayedQueryStates(perf_submit_pass);
+    local_query_to_state_map.ForEachPool([this, &is_query_updated_after](VkQueryPool pool, uint32_t perf_pass,
+                                                                         const QuerySlotStates &states) {
+        // Slots are visited in order within a page, so consecutive available queries are set as one range
+        QuerySlotStates available;
+        uint32_t range_begin = 0;
+        uint32_t range_count = 0;
+        states.ForEach([&](uint32_t slot, QueryState state) {
+            if (state != QUERYSTATE_ENDED || is_query_updated_after(QueryObject(pool, slot, 0, perf_pass))) {
+                return;
+            }
+            if (range_count > 0 && slot == range_begin + range_count) {
+                ++range_count;
+                return;
+            }
+            available.SetRange(range_begin, range_count, QUERYSTATE_AVAILABLE);
+            range_begin = slot;
+            range_count = 1;
+        });
+        available.SetRange(range_begin, range_count, QUERYSTATE_AVAILABLE);
+        if (available.Empty()) return;
+        auto query_pool_state = dev_data.Get<vvl::QueryPool>(pool);
+        if (!query_pool_state) return;
+        query_pool_state->SetQueryStates(perf_pass, available);
+    });
 }
 
 uint32_t CommandBuffer::GetDynamicColorAttachmentCount() const {
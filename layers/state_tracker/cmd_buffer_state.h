@@ -471,7 +471,8 @@ class CommandBuffer : public RefcountedStateObject {
     std::vector<VkEvent> events;
     vvl::unordered_set<QueryObject> activeQueries;
     vvl::unordered_set<QueryObject> startedQueries;
-    vvl::unordered_set<QueryObject> updatedQueries;
+    // Last state recorded for each query updated by the command buffer (perf_pass is always 0)
+    QueryMap updatedQueries;
     vvl::unordered_set<QueryObject> renderPassQueries;
     ImageLayoutMap image_layout_map;
     AliasedLayoutMap aliased_image_layout_map;  // storage for potentially aliased images
@@ -500,6 +501,14 @@ class CommandBuffer : public RefcountedStateObject {
     std::vector<std::function<bool(CommandBuffer &cb_state, bool do_validate, VkQueryPool &firstPerfQueryPool,
                                    uint32_t perfQueryPass, QueryMap *localQueryToStateMap)>>
         queryUpdates;
+    // Callbacks of a secondary command buffer, moved out of it at vkEndCommandBuffer time. vkCmdExecuteCommands records a single
+    // callback running them instead of copying every recorded callback. Every callback still runs at submit time.
+    struct ExecuteSummary {
+        std::vector<EventCallback> event_updates;
+        std::vector<QueueCallback> queue_submit_functions;
+    };
+    // Null until the secondary command buffer is ended, and after it is reset
+    std::shared_ptr<const ExecuteSummary> execute_summary;
     bool performance_lock_acquired = false;
     bool performance_lock_released = false;
 
@@ -711,6 +720,18 @@ class CommandBuffer : public RefcountedStateObject {
     // Used during sumbit time validation.
     std::vector<LabelCommand> label_commands_;
 
+    // Query and event states at the end of the command buffer, found by replaying queryUpdates and eventUpdates without
+    // validation. That replay only depends on the recorded commands, so command buffers recorded once and submitted every
+    // frame compute it once per recording (and performance query pass) instead of at each submit and retire.
+    const QueryMap &GetReplayedQueryStates(uint32_t perf_submit_pass);
+    const EventMap &GetReplayedEventStates(const Location &loc);
+    void ClearReplayCache();
+
+    vvl::unordered_map<uint32_t, QueryMap> replayed_query_states_;
+    size_t replayed_query_update_count_ = 0;
+    std::optional<EventMap> replayed_event_states_;
+    size_t replayed_event_update_count_ = 0;
+
     uint32_t active_subpass_;
     // Stores rasterization samples count obtained from the first pipeline with a pMultisampleState in the active subpass,
     // or std::nullopt
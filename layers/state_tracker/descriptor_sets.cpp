@@ -543,9 +543,7 @@ void vvl::DescriptorSet::Destroy() {
 // Loop through the write updates to do for a push descriptor set, ignoring dstSet
 void vvl::DescriptorSet::PerformPushDescriptorsUpdate(uint32_t write_count, const VkWriteDescriptorSet *write_descs) {
     assert(IsPushDescriptor());
-    for (uint32_t i = 0; i < write_count; i++) {
-        PerformWriteUpdate(write_descs[i]);
-    }
+    PerformWriteUpdates(write_count, write_descs);
 
     push_descriptor_set_writes.clear();
     push_descriptor_set_writes.reserve(static_cast<std::size_t>(write_count));
@@ -554,8 +552,25 @@ void vvl::DescriptorSet::PerformPushDescriptorsUpdate(uint32_t write_count, cons
     }
 }
 
-// Perform write update in given update struct
-void vvl::DescriptorSet::PerformWriteUpdate(const VkWriteDescriptorSet &update) {
+void vvl::DescriptorSet::PerformWriteUpdates(uint32_t write_count, const VkWriteDescriptorSet *write_descs) {
+    bool changed = false;
+    bool invalidate = false;
+    for (uint32_t i = 0; i < write_count; i++) {
+        ApplyWriteUpdate(write_descs[i], invalidate);
+        changed |= write_descs[i].descriptorCount != 0;
+    }
+    if (changed) {
+        some_update_ = true;
+        ++change_count_;
+    }
+    // Invalidate walks every command buffer this set is bound to, only do it once per run of writes
+    if (invalidate) {
+        Invalidate(false);
+    }
+}
+
+// Perform write update in given update struct, invalidate is set if the bound command buffers must be invalidated
+void vvl::DescriptorSet::ApplyWriteUpdate(const VkWriteDescriptorSet &update, bool &invalidate) {
     // Perform update on a per-binding basis as consecutive updates roll over to next binding
     auto descriptors_remaining = update.descriptorCount;
     auto iter = FindDescriptor(update.dstBinding, update.dstArrayElement);
@@ -570,14 +585,10 @@ void vvl::DescriptorSet::PerformWriteUpdate(const VkWriteDescriptorSet &update)
         iter->WriteUpdate(*this, *state_data_, update, i, iter.CurrentBinding().IsBindless());
         iter.updated(true);
     }
-    if (update.descriptorCount) {
-        some_update_ = true;
-        ++change_count_;
-    }
 
     if (!IsPushDescriptor() && !(orig_binding.binding_flags & (VK_DESCRIPTOR_BINDING_UPDATE_UNUSED_WHILE_PENDING_BIT |
                                                                VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT))) {
-        Invalidate(false);
+        invalidate = true;
     }
 }
 // Perform Copy update
@@ -594,7 +605,8 @@ void vvl::DescriptorSet::PerformCopyUpdate(const VkCopyDescriptorSet &update, co
                 const auto &mutable_src = static_cast<const MutableDescriptor &>(src);
                 type = mutable_src.ActiveType();
             }
-            dst.CopyUpdate(*this, *state_data_, src, src_iter.CurrentBinding().IsBindless(), type);
+            // Whether the descriptor links this set as a parent depends on the binding it is copied to
+            dst.CopyUpdate(*this, *state_data_, src, dst_iter.CurrentBinding().IsBindless(), type);
             some_update_ = true;
             ++change_count_;
             dst_iter.updated(true);
@@ -674,6 +674,10 @@ class DescriptorBinding {
 
     bool IsVariableCount() const { return (binding_flags & VK_DESCRIPTOR_BINDING_VARIABLE_DESCRIPTOR_COUNT_BIT) != 0; }
 
+    // Descriptors of bindless bindings never link the set as a parent of the objects they reference (see ReplaceStatePtr()),
+    // so there is nothing to link, unlink or invalidate. Immutable samplers are always linked when the set is created.
+    bool IsUnlinked() const { return IsBindless() && !has_immutable_samplers; }
+
     bool IsConsistent(const DescriptorBinding &other) const {
         // A write update can overlap over following binding but bindings with descriptorCount == 0 must be skipped.
         // Therefore we consider "consistent" a binding that should be skipped
@@ -714,18 +718,21 @@ class DescriptorBindingImpl : public DescriptorBinding {
         }
     }
 
+    // Bindless bindings can hold millions of descriptors, skip walking them when none of them is linked
     void AddParent(DescriptorSet *ds) override {
+        if (IsUnlinked()) return;
         auto add_parent = [ds](T &descriptor) { descriptor.AddParent(ds); };
         ForAllUpdated(add_parent);
     }
 
     void RemoveParent(DescriptorSet *ds) override {
+        if (IsUnlinked()) return;
         auto remove_parent = [ds](T &descriptor) { descriptor.RemoveParent(ds); };
         ForAllUpdated(remove_parent);
     }
 
     void NotifyInvalidate(const NodeList &invalid_nodes, bool unlink) override {
-        if (!T::SupportsNotifyInvalidate()) return;
+        if (!T::SupportsNotifyInvalidate() || IsUnlinked()) return;
 
         for (const auto &node : invalid_nodes) {
             if (T::IsNotifyInvalidateType(node->Type())) {
@@ -809,8 +816,9 @@ class DescriptorSet : public StateObject {
 
     // Perform a push update whose contents were just validated using ValidatePushDescriptorsUpdate
     virtual void PerformPushDescriptorsUpdate(uint32_t write_count, const VkWriteDescriptorSet *write_descs);
-    // Perform a WriteUpdate whose contents were just validated using ValidateWriteUpdate
-    virtual void PerformWriteUpdate(const VkWriteDescriptorSet &);
+    // Perform a run of WriteUpdates which all target this set. The change count is bumped and the set is invalidated at most
+    // once for the whole run instead of once per write.
+    virtual void PerformWriteUpdates(uint32_t write_count, const VkWriteDescriptorSet *write_descs);
     // Perform a CopyUpdate whose contents were just validated using ValidateCopyUpdate
     virtual void PerformCopyUpdate(const VkCopyDescriptorSet &, const DescriptorSet &src_set);
 
@@ -980,6 +988,9 @@ class DescriptorSet : public StateObject {
     }
 
   protected:
+    // Sets invalidate if the write requires bound command buffers to be invalidated
+    void ApplyWriteUpdate(const VkWriteDescriptorSet &update, bool &invalidate);
+
     union AnyBinding {
         SamplerBinding sampler;
         ImageSamplerBinding image_sampler;
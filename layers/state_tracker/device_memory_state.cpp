@@ -19,6 +19,8 @@
 #include "state_tracker/device_memory_state.h"
 #include "state_tracker/image_state.h"
 
+#include <algorithm>
+
 using MemoryRange = vvl::BindableMemoryTracker::MemoryRange;
 using BoundMemoryRange = vvl::BindableMemoryTracker::BoundMemoryRange;
 using DeviceMemoryState = vvl::BindableMemoryTracker::DeviceMemoryState;
@@ -156,19 +158,96 @@ bool vvl::BindableSparseMemoryTracker::HasFullRangeBound() const {
 
 void vvl::BindableSparseMemoryTracker::BindMemory(StateObject *parent, std::shared_ptr<vvl::DeviceMemory> &mem_state,
                                              VkDeviceSize memory_offset, VkDeviceSize resource_offset, VkDeviceSize size) {
-    MEM_BINDING memory_data{mem_state, memory_offset, resource_offset};
-    BindingMap::value_type item{{resource_offset, resource_offset + size}, memory_data};
+    std::vector<SparseBind> binds{{mem_state, memory_offset, resource_offset, size}};
+    BindSparseMemory(parent, binds);
+}
+
+// Adjacent bindings translating resource offsets to memory offsets the same way are one contiguous binding
+static bool IsSameMapping(const MEM_BINDING &a, const MEM_BINDING &b) {
+    if (a.memory_state != b.memory_state) return false;
+    // Unsigned wrap around is fine, only equality matters
+    return !a.memory_state || (a.memory_offset - a.resource_offset) == (b.memory_offset - b.resource_offset);
+}
+
+// Sort the binds by resource offset and merge the ones that continue each other (resource and memory wise) into runs.
+// Later binds win over earlier ones they overlap, so if any two binds overlap their order is kept as is.
+static void CoalesceSparseBinds(std::vector<vvl::BindableMemoryTracker::SparseBind> &binds) {
+    using SparseBind = vvl::BindableMemoryTracker::SparseBind;
+    const auto by_resource_offset = [](const SparseBind &a, const SparseBind &b) { return a.resource_offset < b.resource_offset; };
+    std::vector<SparseBind> sorted;
+    const bool in_order = std::is_sorted(binds.begin(), binds.end(), by_resource_offset);
+    if (!in_order) {
+        sorted = binds;
+        std::stable_sort(sorted.begin(), sorted.end(), by_resource_offset);
+    }
+    const std::vector<SparseBind> &ordered = in_order ? binds : sorted;
+    for (size_t i = 1; i < ordered.size(); ++i) {
+        if (ordered[i].resource_offset < ordered[i - 1].resource_offset + ordered[i - 1].size) return;
+    }
+    if (!in_order) {
+        binds = std::move(sorted);
+    }
+
+    size_t run = 0;
+    for (size_t i = 1; i < binds.size(); ++i) {
+        SparseBind &current = binds[run];
+        const SparseBind &next = binds[i];
+        if (current.resource_offset + current.size == next.resource_offset && current.memory_state == next.memory_state &&
+            (!current.memory_state || current.memory_offset + current.size == next.memory_offset)) {
+            current.size += next.size;
+        } else if (++run != i) {
+            binds[run] = std::move(binds[i]);
+        }
+    }
+    binds.resize(run + 1);
+}
+
+void vvl::BindableSparseMemoryTracker::MergeWithNeighbors(BindingMap::iterator it) {
+    // range_map iterators don't provide iterator_traits, so no std::prev/std::next
+    auto first = it;
+    if (first != binding_map_.begin()) {
+        auto prev = first;
+        --prev;
+        if (prev->first.end == it->first.begin && IsSameMapping(prev->second, it->second)) {
+            first = prev;
+        }
+    }
+    auto last = it;
+    ++last;
+    VkDeviceSize merged_end = it->first.end;
+    if (last != binding_map_.end() && last->first.begin == merged_end && IsSameMapping(it->second, last->second)) {
+        merged_end = last->first.end;
+        ++last;
+    }
+    if (first == it && merged_end == it->first.end) return;
+
+    BindingMap::value_type merged{{first->first.begin, merged_end}, first->second};
+    binding_map_.erase(first, last);
+    binding_map_.insert(merged);
+}
+
+void vvl::BindableSparseMemoryTracker::BindSparseMemory(StateObject *parent, std::vector<SparseBind> &binds) {
+    if (binds.empty()) return;
+    CoalesceSparseBinds(binds);
 
     auto guard = WriteLockGuard{binding_lock_};
 
-    // Since we don't know which ranges will be removed, we need to unbind everything and rebind later
-    for (auto &value_pair : binding_map_) {
-        if (value_pair.second.memory_state) value_pair.second.memory_state->RemoveParent(parent);
+    // Since we don't know which ranges will be removed, compare the memory bound before and after the whole batch
+    const DeviceMemoryState old_states = GetBoundMemoryStatesLocked();
+    for (auto &bind : binds) {
+        // Invalid (VUID-VkSparseMemoryBind-size-01098), nothing to bind
+        if (bind.size == 0) continue;
+        MEM_BINDING memory_data{bind.memory_state, bind.memory_offset, bind.resource_offset};
+        BindingMap::value_type item{{bind.resource_offset, bind.resource_offset + bind.size}, memory_data};
+        MergeWithNeighbors(binding_map_.overwrite_range(item));
     }
-    binding_map_.overwrite_range(item);
+    const DeviceMemoryState new_states = GetBoundMemoryStatesLocked();
 
-    for (auto &value_pair : binding_map_) {
-        if (value_pair.second.memory_state) value_pair.second.memory_state->AddParent(parent);
+    for (const auto &state : old_states) {
+        if (new_states.find(state) == new_states.end()) state->RemoveParent(parent);
+    }
+    for (const auto &state : new_states) {
+        state->AddParent(parent);
     }
 }
 
@@ -180,11 +259,11 @@ BoundMemoryRange vvl::BindableSparseMemoryTracker::GetBoundMemoryRange(const Mem
     for (auto it = range_bounds.begin; it != range_bounds.end; ++it) {
         const auto &[resource_range, memory_data] = *it;
         if (memory_data.memory_state && memory_data.memory_state->VkHandle() != VK_NULL_HANDLE) {
-            const VkDeviceSize memory_range_start = std::max(range.begin, memory_data.resource_offset) -
-                memory_data.resource_offset + memory_data.memory_offset;
+            // The entry can be a part of the original bind, or several merged binds, so clip to the entry range
+            const VkDeviceSize memory_range_start =
+                std::max(range.begin, resource_range.begin) - memory_data.resource_offset + memory_data.memory_offset;
             const VkDeviceSize memory_range_end =
-                std::min(range.end, memory_data.resource_offset + resource_range.distance()) - memory_data.resource_offset +
-                memory_data.memory_offset;
+                std::min(range.end, resource_range.end) - memory_data.resource_offset + memory_data.memory_offset;
 
             mem_ranges[memory_data.memory_state->VkHandle()].emplace_back(memory_range_start, memory_range_end);
         }
@@ -192,19 +271,18 @@ BoundMemoryRange vvl::BindableSparseMemoryTracker::GetBoundMemoryRange(const Mem
     return mem_ranges;
 }
 
-DeviceMemoryState vvl::BindableSparseMemoryTracker::GetBoundMemoryStates() const {
+DeviceMemoryState vvl::BindableSparseMemoryTracker::GetBoundMemoryStatesLocked() const {
     DeviceMemoryState dev_mem_states;
-
-    {
-        auto guard = ReadLockGuard{binding_lock_};
-        for (auto &binding : binding_map_) {
-            if (binding.second.memory_state) dev_mem_states.emplace(binding.second.memory_state);
-        }
+    for (auto &binding : binding_map_) {
+        if (binding.second.memory_state) dev_mem_states.emplace(binding.second.memory_state);
     }
-
     return dev_mem_states;
 }
 
+DeviceMemoryState vvl::BindableSparseMemoryTracker::GetBoundMemoryStates() const {
+    auto guard = ReadLockGuard{binding_lock_};
+    return GetBoundMemoryStatesLocked();
+}
 
 vvl::BindableMultiplanarMemoryTracker::BindableMultiplanarMemoryTracker(const VkMemoryRequirements *requirements, uint32_t num_planes)
     : planes_(num_planes) {
@@ -44,7 +44,7 @@ struct DedicatedBinding {
 };
 
 // Data struct for tracking memory object
-class DeviceMemory : public StateObject {
+class DeviceMemory : public StateObject, public SubStateHolder {
   public:
     const vku::safe_VkMemoryAllocateInfo safe_allocate_info;
     const VkMemoryAllocateInfo &allocate_info;
@@ -104,6 +104,14 @@ class BindableMemoryTracker {
     using BoundMemoryRange = std::map<VkDeviceMemory, std::vector<MemoryRange>>;
     using DeviceMemoryState = unordered_set<std::shared_ptr<vvl::DeviceMemory>>;
 
+    // One VkSparseMemoryBind of a vkQueueBindSparse batch, with its memory state already resolved
+    struct SparseBind {
+        std::shared_ptr<vvl::DeviceMemory> memory_state;
+        VkDeviceSize memory_offset;
+        VkDeviceSize resource_offset;
+        VkDeviceSize size;
+    };
+
     virtual ~BindableMemoryTracker() {}
     // kept for backwards compatibility, only useful with the Linear tracker
     virtual const MEM_BINDING *Binding() const = 0;
@@ -111,6 +119,12 @@ class BindableMemoryTracker {
     virtual bool HasFullRangeBound() const = 0;
 
     virtual void BindMemory(StateObject *, std::shared_ptr<vvl::DeviceMemory> &, VkDeviceSize, VkDeviceSize, VkDeviceSize) = 0;
+    // Same result as calling BindMemory() for each bind, in order. binds can be reordered or merged by the tracker.
+    virtual void BindSparseMemory(StateObject *parent, std::vector<SparseBind> &binds) {
+        for (auto &bind : binds) {
+            BindMemory(parent, bind.memory_state, bind.memory_offset, bind.resource_offset, bind.size);
+        }
+    }
 
     virtual BoundMemoryRange GetBoundMemoryRange(const MemoryRange &) const = 0;
     virtual DeviceMemoryState GetBoundMemoryStates() const = 0;
@@ -170,14 +184,21 @@ class BindableSparseMemoryTracker : public BindableMemoryTracker {
 
     void BindMemory(StateObject *parent, std::shared_ptr<vvl::DeviceMemory> &mem_state, VkDeviceSize memory_offset,
                     VkDeviceSize resource_offset, VkDeviceSize size) override;
+    void BindSparseMemory(StateObject *parent, std::vector<SparseBind> &binds) override;
 
     BoundMemoryRange GetBoundMemoryRange(const MemoryRange &range) const override;
 
     DeviceMemoryState GetBoundMemoryStates() const override;
 
   private:
-    // This range map uses the range in resource space to know the size of the bound memory
+    // This range map uses the range in resource space to know the size of the bound memory.
+    // Adjacent ranges bound to contiguous memory of the same allocation are kept as a single entry (run length encoded),
+    // so MEM_BINDING::resource_offset is not always the beginning of the range it is mapped to.
     using BindingMap = sparse_container::range_map<VkDeviceSize, MEM_BINDING>;
+
+    void MergeWithNeighbors(BindingMap::iterator it);
+    DeviceMemoryState GetBoundMemoryStatesLocked() const;
+
     BindingMap binding_map_;
     mutable std::shared_mutex binding_lock_;
     VkDeviceSize resource_size_;
@@ -278,6 +299,9 @@ class Bindable : public StateObject {
                     const VkDeviceSize resource_offset, const VkDeviceSize mem_size) {
         memory_tracker_->BindMemory(parent, mem, memory_offset, resource_offset, mem_size);
     }
+    void BindSparseMemory(StateObject *parent, std::vector<BindableMemoryTracker::SparseBind> &binds) {
+        memory_tracker_->BindSparseMemory(parent, binds);
+    }
 
     bool HasFullRangeBound() const { return memory_tracker_->HasFullRangeBound(); }
 
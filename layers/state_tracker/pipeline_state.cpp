@@ -147,7 +147,7 @@ std::vector<ShaderStageState> Pipeline::GetStageStates(const ValidationStateTrac
                 case VK_SHADER_STAGE_FRAGMENT_BIT:
                     if (pipe_state.fragment_shader_state && pipe_state.fragment_shader_state->fragment_shader) {
                         module_state = pipe_state.fragment_shader_state->fragment_shader;
-                        stage_ci = pipe_state.fragment_shader_state->fragment_shader_ci.get();
+                        stage_ci = pipe_state.fragment_shader_state->fragment_shader_ci;
                     }
                     break;
                 default:
@@ -673,9 +673,10 @@ Pipeline::Pipeline(const ValidationStateTracker &state_data, const VkGraphicsPip
     : StateObject(static_cast<VkPipeline>(VK_NULL_HANDLE), kVulkanObjectTypePipeline),
       rp_state(rpstate),
       create_info(MakeGraphicsCreateInfo(*pCreateInfo, rpstate, state_data)),
+      create_info_pnext(GraphicsCreateInfo().pNext),
       pipeline_cache(std::move(pipe_cache)),
-      rendering_create_info(vku::FindStructInPNextChain<VkPipelineRenderingCreateInfo>(GraphicsCreateInfo().pNext)),
-      library_create_info(vku::FindStructInPNextChain<VkPipelineLibraryCreateInfoKHR>(GraphicsCreateInfo().pNext)),
+      rendering_create_info(GetCreateInfoPNext<VkPipelineRenderingCreateInfo>()),
+      library_create_info(GetCreateInfoPNext<VkPipelineLibraryCreateInfoKHR>()),
       graphics_lib_type(GetGraphicsLibType(GraphicsCreateInfo())),
       pipeline_type(VK_PIPELINE_BIND_POINT_GRAPHICS),
       create_flags(GetPipelineCreateFlags(GraphicsCreateInfo().pNext, GraphicsCreateInfo().flags)),
@@ -727,6 +728,7 @@ Pipeline::Pipeline(const ValidationStateTracker &state_data, const VkComputePipe
                    std::shared_ptr<const vvl::PipelineCache> &&pipe_cache, std::shared_ptr<const vvl::PipelineLayout> &&layout)
     : StateObject(static_cast<VkPipeline>(VK_NULL_HANDLE), kVulkanObjectTypePipeline),
       create_info(pCreateInfo),
+      create_info_pnext(ComputeCreateInfo().pNext),
       pipeline_cache(std::move(pipe_cache)),
       pipeline_type(VK_PIPELINE_BIND_POINT_COMPUTE),
       create_flags(GetPipelineCreateFlags(ComputeCreateInfo().pNext, ComputeCreateInfo().flags)),
@@ -750,6 +752,7 @@ Pipeline::Pipeline(const ValidationStateTracker &state_data, const VkRayTracingP
                    std::shared_ptr<const vvl::PipelineCache> &&pipe_cache, std::shared_ptr<const vvl::PipelineLayout> &&layout)
     : StateObject(static_cast<VkPipeline>(VK_NULL_HANDLE), kVulkanObjectTypePipeline),
       create_info(pCreateInfo),
+      create_info_pnext(RayTracingCreateInfo().pNext),
       pipeline_cache(std::move(pipe_cache)),
       pipeline_type(VK_PIPELINE_BIND_POINT_RAY_TRACING_KHR),
       create_flags(GetPipelineCreateFlags(RayTracingCreateInfo().pNext, RayTracingCreateInfo().flags)),
@@ -774,6 +777,7 @@ Pipeline::Pipeline(const ValidationStateTracker &state_data, const VkRayTracingP
                    std::shared_ptr<const vvl::PipelineCache> &&pipe_cache, std::shared_ptr<const vvl::PipelineLayout> &&layout)
     : StateObject(static_cast<VkPipeline>(VK_NULL_HANDLE), kVulkanObjectTypePipeline),
       create_info(pCreateInfo),
+      create_info_pnext(RayTracingCreateInfo().pNext),
       pipeline_cache(std::move(pipe_cache)),
       pipeline_type(VK_PIPELINE_BIND_POINT_RAY_TRACING_NV),
       create_flags(GetPipelineCreateFlags(RayTracingCreateInfo().pNext, RayTracingCreateInfo().flags)),
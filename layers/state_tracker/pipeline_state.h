@@ -22,6 +22,7 @@
 #include <vulkan/utility/vk_safe_struct.hpp>
 
 #include "utils/hash_vk_types.h"
+#include "utils/pnext_chain_index.h"
 #include "state_tracker/pipeline_sub_state.h"
 #include "generated/dynamic_state_helper.h"
 #include "utils/shader_utils.h"
@@ -80,6 +81,8 @@ class Pipeline : public StateObject {
     const std::variant<vku::safe_VkGraphicsPipelineCreateInfo, vku::safe_VkComputePipelineCreateInfo,
                        vku::safe_VkRayTracingPipelineCreateInfoCommon>
         create_info;
+    // Built once from the create info pNext chain, see GetCreateInfoPNext()
+    const PnextChainIndex create_info_pnext;
 
     // Pipeline cache state
     const std::shared_ptr<const vvl::PipelineCache> pipeline_cache;
@@ -263,11 +266,11 @@ class Pipeline : public StateObject {
         if (fragment_shader_state && fragment_shader_state->ms_state &&
             (fragment_shader_state->ms_state->rasterizationSamples >= VK_SAMPLE_COUNT_1_BIT) &&
             (fragment_shader_state->ms_state->rasterizationSamples < VK_SAMPLE_COUNT_FLAG_BITS_MAX_ENUM)) {
-            return fragment_shader_state->ms_state.get();
+            return fragment_shader_state->ms_state;
         } else if (fragment_output_state && fragment_output_state->ms_state &&
                    (fragment_output_state->ms_state->rasterizationSamples >= VK_SAMPLE_COUNT_1_BIT) &&
                    (fragment_output_state->ms_state->rasterizationSamples < VK_SAMPLE_COUNT_FLAG_BITS_MAX_ENUM)) {
-            return fragment_output_state->ms_state.get();
+            return fragment_output_state->ms_state;
         }
         return nullptr;
     }
@@ -313,7 +316,7 @@ class Pipeline : public StateObject {
 
     const vku::safe_VkPipelineColorBlendStateCreateInfo *ColorBlendState() const {
         if (fragment_output_state) {
-            return fragment_output_state->color_blend_state.get();
+            return fragment_output_state->color_blend_state;
         }
         return nullptr;
     }
@@ -354,7 +357,7 @@ class Pipeline : public StateObject {
 
     const vku::safe_VkPipelineDepthStencilStateCreateInfo *DepthStencilState() const {
         if (fragment_shader_state) {
-            return fragment_shader_state->ds_state.get();
+            return fragment_shader_state->ds_state;
         }
         return nullptr;
     }
@@ -368,6 +371,12 @@ class Pipeline : public StateObject {
         return std::get<vku::safe_VkRayTracingPipelineCreateInfoCommon>(create_info);
     }
 
+    // First struct of type T in the pNext chain of the create info, prefer this over walking GraphicsCreateInfo().pNext
+    template <typename T>
+    const T *GetCreateInfoPNext() const {
+        return create_info_pnext.Find<T>();
+    }
+
     VkStructureType GetCreateInfoSType() const {
         const auto *gfx = std::get_if<vku::safe_VkGraphicsPipelineCreateInfo>(&create_info);
         if (gfx) {
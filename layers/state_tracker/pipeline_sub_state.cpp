@@ -18,43 +18,115 @@
 #include "state_tracker/pipeline_sub_state.h"
 #include "state_tracker/pipeline_state.h"
 #include "state_tracker/shader_module.h"
+#include <algorithm>
 
 VkPipelineLayoutCreateFlags PipelineSubState::PipelineLayoutCreateFlags() const {
     const auto layout_state = parent.PipelineLayoutState();
     return (layout_state) ? layout_state->CreateFlags() : static_cast<VkPipelineLayoutCreateFlags>(0);
 }
 
-VertexInputState::VertexInputState(const vvl::Pipeline &p, const vku::safe_VkGraphicsPipelineCreateInfo &create_info)
-    : PipelineSubState(p) {
-    for (uint32_t i = 0; i < create_info.stageCount; i++) {
-        if (create_info.pStages && create_info.pStages[i].stage == VK_SHADER_STAGE_MESH_BIT_EXT) {
-            return;  // if mesh shaders are used, all vertex input state is ignored
-        }
+static VertexInputDescriptionsDict vertex_input_descriptions_dict;
+static ColorBlendAttachmentsDict color_blend_attachments_dict;
+
+size_t VertexInputDescriptionsDef::hash() const {
+    hash_util::HashCombiner hc;
+    for (const auto &description : binding_descriptions) {
+        hc << description.binding << description.stride << description.inputRate;
+    }
+    for (const auto &description : vertex_attribute_descriptions) {
+        hc << description.location << description.binding << description.format << description.offset;
     }
-    input_state = create_info.pVertexInputState;
-    input_assembly_state = create_info.pInputAssemblyState;
+    return hc.Value();
+}
 
+bool VertexInputDescriptionsDef::operator==(const VertexInputDescriptionsDef &other) const {
+    // binding_to_index_map is derived from binding_descriptions
+    return std::equal(binding_descriptions.begin(), binding_descriptions.end(), other.binding_descriptions.begin(),
+                      other.binding_descriptions.end(),
+                      [](const VkVertexInputBindingDescription &a, const VkVertexInputBindingDescription &b) {
+                          return a.binding == b.binding && a.stride == b.stride && a.inputRate == b.inputRate;
+                      }) &&
+           std::equal(vertex_attribute_descriptions.begin(), vertex_attribute_descriptions.end(),
+                      other.vertex_attribute_descriptions.begin(), other.vertex_attribute_descriptions.end(),
+                      [](const VkVertexInputAttributeDescription2EXT &a, const VkVertexInputAttributeDescription2EXT &b) {
+                          return a.location == b.location && a.binding == b.binding && a.format == b.format &&
+                                 a.offset == b.offset;
+                      });
+}
+
+VertexInputDescriptionsId GetCanonicalId(const vku::safe_VkPipelineVertexInputStateCreateInfo *input_state) {
+    VertexInputDescriptionsDef def;
     if (input_state) {
         if (input_state->vertexBindingDescriptionCount) {
             const uint32_t count = input_state->vertexBindingDescriptionCount;
-            binding_descriptions.reserve(count);
-            binding_to_index_map.reserve(count);
+            def.binding_descriptions.reserve(count);
+            def.binding_to_index_map.reserve(count);
 
             for (uint32_t i = 0; i < count; i++) {
-                binding_descriptions.emplace_back(input_state->pVertexBindingDescriptions[i]);
-                binding_to_index_map[binding_descriptions.back().binding] = i;
+                def.binding_descriptions.emplace_back(input_state->pVertexBindingDescriptions[i]);
+                def.binding_to_index_map[def.binding_descriptions.back().binding] = i;
             }
         }
 
-        vertex_attribute_descriptions.reserve(input_state->vertexAttributeDescriptionCount);
+        def.vertex_attribute_descriptions.reserve(input_state->vertexAttributeDescriptionCount);
         for (const auto [i, description] :
              vvl::enumerate(input_state->pVertexAttributeDescriptions, input_state->vertexAttributeDescriptionCount)) {
-            vertex_attribute_descriptions.emplace_back(vku::InitStruct<VkVertexInputAttributeDescription2EXT>(
+            def.vertex_attribute_descriptions.emplace_back(vku::InitStruct<VkVertexInputAttributeDescription2EXT>(
                 nullptr, description->location, description->binding, description->format, description->offset));
         }
     }
+    return vertex_input_descriptions_dict.LookUp(std::move(def));
+}
+
+size_t ColorBlendAttachmentsDef::hash() const {
+    hash_util::HashCombiner hc;
+    for (const auto &attachment : attachment_states) {
+        hc << attachment.blendEnable << attachment.srcColorBlendFactor << attachment.dstColorBlendFactor << attachment.colorBlendOp
+           << attachment.srcAlphaBlendFactor << attachment.dstAlphaBlendFactor << attachment.alphaBlendOp
+           << attachment.colorWriteMask;
+    }
+    return hc.Value();
+}
+
+bool ColorBlendAttachmentsDef::operator==(const ColorBlendAttachmentsDef &other) const {
+    return std::equal(attachment_states.begin(), attachment_states.end(), other.attachment_states.begin(),
+                      other.attachment_states.end(),
+                      [](const VkPipelineColorBlendAttachmentState &a, const VkPipelineColorBlendAttachmentState &b) {
+                          return a.blendEnable == b.blendEnable && a.srcColorBlendFactor == b.srcColorBlendFactor &&
+                                 a.dstColorBlendFactor == b.dstColorBlendFactor && a.colorBlendOp == b.colorBlendOp &&
+                                 a.srcAlphaBlendFactor == b.srcAlphaBlendFactor &&
+                                 a.dstAlphaBlendFactor == b.dstAlphaBlendFactor && a.alphaBlendOp == b.alphaBlendOp &&
+                                 a.colorWriteMask == b.colorWriteMask;
+                      });
 }
 
+ColorBlendAttachmentsId GetCanonicalId(uint32_t attachment_count, const VkPipelineColorBlendAttachmentState *attachment_states) {
+    ColorBlendAttachmentsDef def;
+    if (attachment_states) {
+        def.attachment_states.assign(attachment_states, attachment_states + attachment_count);
+    }
+    return color_blend_attachments_dict.LookUp(std::move(def));
+}
+
+static bool UsesMeshShader(const vku::safe_VkGraphicsPipelineCreateInfo &create_info) {
+    for (uint32_t i = 0; i < create_info.stageCount; i++) {
+        if (create_info.pStages && create_info.pStages[i].stage == VK_SHADER_STAGE_MESH_BIT_EXT) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// if mesh shaders are used, all vertex input state is ignored
+VertexInputState::VertexInputState(const vvl::Pipeline &p, const vku::safe_VkGraphicsPipelineCreateInfo &create_info)
+    : PipelineSubState(p),
+      input_state(UsesMeshShader(create_info) ? nullptr : create_info.pVertexInputState),
+      input_assembly_state(UsesMeshShader(create_info) ? nullptr : create_info.pInputAssemblyState),
+      descriptions(GetCanonicalId(input_state)),
+      binding_descriptions(descriptions->binding_descriptions),
+      binding_to_index_map(descriptions->binding_to_index_map),
+      vertex_attribute_descriptions(descriptions->vertex_attribute_descriptions) {}
+
 PreRasterState::PreRasterState(const vvl::Pipeline &p, const ValidationStateTracker &state_data,
                                const vku::safe_VkGraphicsPipelineCreateInfo &create_info, std::shared_ptr<const vvl::RenderPass> rp)
     : PipelineSubState(p),
@@ -143,40 +215,45 @@ PreRasterState::PreRasterState(const vvl::Pipeline &p, const ValidationStateTrac
     }
 }
 
-std::unique_ptr<const vku::safe_VkPipelineColorBlendStateCreateInfo> ToSafeColorBlendState(
-    const vku::safe_VkPipelineColorBlendStateCreateInfo &cbs) {
-    // This is needlessly copied here. Might better to make this a plain pointer, with an optional "backing unique_ptr"
-    return std::make_unique<const vku::safe_VkPipelineColorBlendStateCreateInfo>(cbs);
+const vku::safe_VkPipelineColorBlendStateCreateInfo *ToSafeColorBlendState(
+    const vku::safe_VkPipelineColorBlendStateCreateInfo &cbs,
+    std::unique_ptr<const vku::safe_VkPipelineColorBlendStateCreateInfo> &) {
+    return &cbs;
 }
-std::unique_ptr<const vku::safe_VkPipelineColorBlendStateCreateInfo> ToSafeColorBlendState(
-    const VkPipelineColorBlendStateCreateInfo &cbs) {
-    return std::make_unique<const vku::safe_VkPipelineColorBlendStateCreateInfo>(&cbs);
+const vku::safe_VkPipelineColorBlendStateCreateInfo *ToSafeColorBlendState(
+    const VkPipelineColorBlendStateCreateInfo &cbs, std::unique_ptr<const vku::safe_VkPipelineColorBlendStateCreateInfo> &owned) {
+    owned = std::make_unique<const vku::safe_VkPipelineColorBlendStateCreateInfo>(&cbs);
+    return owned.get();
 }
-std::unique_ptr<const vku::safe_VkPipelineMultisampleStateCreateInfo> ToSafeMultisampleState(
-    const vku::safe_VkPipelineMultisampleStateCreateInfo &cbs) {
-    // This is needlessly copied here. Might better to make this a plain pointer, with an optional "backing unique_ptr"
-    return std::make_unique<const vku::safe_VkPipelineMultisampleStateCreateInfo>(cbs);
+const vku::safe_VkPipelineMultisampleStateCreateInfo *ToSafeMultisampleState(
+    const vku::safe_VkPipelineMultisampleStateCreateInfo &cbs,
+    std::unique_ptr<const vku::safe_VkPipelineMultisampleStateCreateInfo> &) {
+    return &cbs;
 }
-std::unique_ptr<const vku::safe_VkPipelineMultisampleStateCreateInfo> ToSafeMultisampleState(
-    const VkPipelineMultisampleStateCreateInfo &cbs) {
-    return std::make_unique<const vku::safe_VkPipelineMultisampleStateCreateInfo>(&cbs);
+const vku::safe_VkPipelineMultisampleStateCreateInfo *ToSafeMultisampleState(
+    const VkPipelineMultisampleStateCreateInfo &cbs, std::unique_ptr<const vku::safe_VkPipelineMultisampleStateCreateInfo> &owned) {
+    owned = std::make_unique<const vku::safe_VkPipelineMultisampleStateCreateInfo>(&cbs);
+    return owned.get();
 }
-std::unique_ptr<const vku::safe_VkPipelineDepthStencilStateCreateInfo> ToSafeDepthStencilState(
-    const vku::safe_VkPipelineDepthStencilStateCreateInfo &cbs) {
-    // This is needlessly copied here. Might better to make this a plain pointer, with an optional "backing unique_ptr"
-    return std::make_unique<const vku::safe_VkPipelineDepthStencilStateCreateInfo>(cbs);
+const vku::safe_VkPipelineDepthStencilStateCreateInfo *ToSafeDepthStencilState(
+    const vku::safe_VkPipelineDepthStencilStateCreateInfo &cbs,
+    std::unique_ptr<const vku::safe_VkPipelineDepthStencilStateCreateInfo> &) {
+    return &cbs;
 }
-std::unique_ptr<const vku::safe_VkPipelineDepthStencilStateCreateInfo> ToSafeDepthStencilState(
-    const VkPipelineDepthStencilStateCreateInfo &cbs) {
-    return std::make_unique<const vku::safe_VkPipelineDepthStencilStateCreateInfo>(&cbs);
+const vku::safe_VkPipelineDepthStencilStateCreateInfo *ToSafeDepthStencilState(
+    const VkPipelineDepthStencilStateCreateInfo &cbs,
+    std::unique_ptr<const vku::safe_VkPipelineDepthStencilStateCreateInfo> &owned) {
+    owned = std::make_unique<const vku::safe_VkPipelineDepthStencilStateCreateInfo>(&cbs);
+    return owned.get();
 }
-std::unique_ptr<const vku::safe_VkPipelineShaderStageCreateInfo> ToShaderStageCI(
-    const vku::safe_VkPipelineShaderStageCreateInfo &cbs) {
-    // This is needlessly copied here. Might better to make this a plain pointer, with an optional "backing unique_ptr"
-    return std::make_unique<const vku::safe_VkPipelineShaderStageCreateInfo>(cbs);
+const vku::safe_VkPipelineShaderStageCreateInfo *ToShaderStageCI(
+    const vku::safe_VkPipelineShaderStageCreateInfo &cbs, std::unique_ptr<const vku::safe_VkPipelineShaderStageCreateInfo> &) {
+    return &cbs;
 }
-std::unique_ptr<const vku::safe_VkPipelineShaderStageCreateInfo> ToShaderStageCI(const VkPipelineShaderStageCreateInfo &cbs) {
-    return std::make_unique<const vku::safe_VkPipelineShaderStageCreateInfo>(&cbs);
+const vku::safe_VkPipelineShaderStageCreateInfo *ToShaderStageCI(
+    const VkPipelineShaderStageCreateInfo &cbs, std::unique_ptr<const vku::safe_VkPipelineShaderStageCreateInfo> &owned) {
+    owned = std::make_unique<const vku::safe_VkPipelineShaderStageCreateInfo>(&cbs);
+    return owned.get();
 }
 
 template <typename CreateInfo>
@@ -207,7 +284,7 @@ void SetFragmentShaderInfoPrivate(FragmentShaderState &fs_state, const Validatio
 
             if (module_state) {
                 fs_state.fragment_shader = std::move(module_state);
-                fs_state.fragment_shader_ci = ToShaderStageCI(create_info.pStages[i]);
+                fs_state.fragment_shader_ci = ToShaderStageCI(create_info.pStages[i], fs_state.owned_fragment_shader_ci);
                 // can be null if using VK_EXT_shader_module_identifier
                 if (fs_state.fragment_shader->spirv) {
                     fs_state.fragment_entry_point = fs_state.fragment_shader->spirv->FindEntrypoint(
@@ -234,8 +311,13 @@ FragmentShaderState::FragmentShaderState(const vvl::Pipeline &p, const Validatio
                                          std::shared_ptr<const vvl::RenderPass> rp, uint32_t subp, VkPipelineLayout layout)
     : PipelineSubState(p), rp_state(rp), subpass(subp), pipeline_layout(dev_data.Get<vvl::PipelineLayout>(layout)) {}
 
-FragmentOutputState::FragmentOutputState(const vvl::Pipeline &p, std::shared_ptr<const vvl::RenderPass> rp, uint32_t sp)
-    : PipelineSubState(p), rp_state(rp), subpass(sp) {}
+FragmentOutputState::FragmentOutputState(const vvl::Pipeline &p, std::shared_ptr<const vvl::RenderPass> rp, uint32_t sp,
+                                         ColorBlendAttachmentsId attachments_id)
+    : PipelineSubState(p),
+      rp_state(rp),
+      subpass(sp),
+      attachments(std::move(attachments_id)),
+      attachment_states(attachments->attachment_states) {}
 
 // static
 bool FragmentOutputState::IsBlendConstantsEnabled(const AttachmentStateVector &attachment_states) {
@@ -51,17 +51,45 @@ struct PipelineSubState {
     VkPipelineLayoutCreateFlags PipelineLayoutCreateFlags() const;
 };
 
+// Canonical dictionary for the vertex bindings and attributes, most pipelines of an application share a handful of vertex layouts
+struct VertexInputDescriptionsDef {
+    std::vector<VkVertexInputBindingDescription> binding_descriptions;
+    vvl::unordered_map<uint32_t, uint32_t> binding_to_index_map;
+    std::vector<VkVertexInputAttributeDescription2EXT> vertex_attribute_descriptions;
+
+    size_t hash() const;
+    bool operator==(const VertexInputDescriptionsDef &other) const;
+};
+using VertexInputDescriptionsDict =
+    hash_util::Dictionary<VertexInputDescriptionsDef, hash_util::HasHashMember<VertexInputDescriptionsDef>>;
+using VertexInputDescriptionsId = VertexInputDescriptionsDict::Id;
+
+VertexInputDescriptionsId GetCanonicalId(const vku::safe_VkPipelineVertexInputStateCreateInfo *input_state);
+
+// Canonical dictionary for the color blend attachment states
+struct ColorBlendAttachmentsDef {
+    std::vector<VkPipelineColorBlendAttachmentState> attachment_states;
+
+    size_t hash() const;
+    bool operator==(const ColorBlendAttachmentsDef &other) const;
+};
+using ColorBlendAttachmentsDict =
+    hash_util::Dictionary<ColorBlendAttachmentsDef, hash_util::HasHashMember<ColorBlendAttachmentsDef>>;
+using ColorBlendAttachmentsId = ColorBlendAttachmentsDict::Id;
+
+ColorBlendAttachmentsId GetCanonicalId(uint32_t attachment_count, const VkPipelineColorBlendAttachmentState *attachment_states);
+
 struct VertexInputState : public PipelineSubState {
     VertexInputState(const vvl::Pipeline &p, const vku::safe_VkGraphicsPipelineCreateInfo &create_info);
 
     vku::safe_VkPipelineVertexInputStateCreateInfo *input_state = nullptr;
     vku::safe_VkPipelineInputAssemblyStateCreateInfo *input_assembly_state = nullptr;
 
-    std::vector<VkVertexInputBindingDescription> binding_descriptions;
-
-    vvl::unordered_map<uint32_t, uint32_t> binding_to_index_map;
-
-    std::vector<VkVertexInputAttributeDescription2EXT> vertex_attribute_descriptions;
+    // Shared by all pipelines with the same vertex bindings and attributes
+    const VertexInputDescriptionsId descriptions;
+    const std::vector<VkVertexInputBindingDescription> &binding_descriptions;
+    const vvl::unordered_map<uint32_t, uint32_t> &binding_to_index_map;
+    const std::vector<VkVertexInputAttributeDescription2EXT> &vertex_attribute_descriptions;
 
     std::shared_ptr<VertexInputState> FromCreateInfo(const ValidationStateTracker &state,
                                                      const vku::safe_VkGraphicsPipelineCreateInfo &create_info);
@@ -94,21 +122,28 @@ struct PreRasterState : public PipelineSubState {
                                                    *task_shader_ci = nullptr, *mesh_shader_ci = nullptr;
 };
 
-std::unique_ptr<const vku::safe_VkPipelineColorBlendStateCreateInfo> ToSafeColorBlendState(
-    const vku::safe_VkPipelineColorBlendStateCreateInfo &cbs);
-std::unique_ptr<const vku::safe_VkPipelineColorBlendStateCreateInfo> ToSafeColorBlendState(
-    const VkPipelineColorBlendStateCreateInfo &cbs);
-std::unique_ptr<const vku::safe_VkPipelineMultisampleStateCreateInfo> ToSafeMultisampleState(
-    const vku::safe_VkPipelineMultisampleStateCreateInfo &cbs);
-std::unique_ptr<const vku::safe_VkPipelineMultisampleStateCreateInfo> ToSafeMultisampleState(
-    const VkPipelineMultisampleStateCreateInfo &cbs);
-std::unique_ptr<const vku::safe_VkPipelineDepthStencilStateCreateInfo> ToSafeDepthStencilState(
-    const vku::safe_VkPipelineDepthStencilStateCreateInfo &cbs);
-std::unique_ptr<const vku::safe_VkPipelineDepthStencilStateCreateInfo> ToSafeDepthStencilState(
-    const VkPipelineDepthStencilStateCreateInfo &cbs);
-std::unique_ptr<const vku::safe_VkPipelineShaderStageCreateInfo> ToShaderStageCI(
-    const vku::safe_VkPipelineShaderStageCreateInfo &cbs);
-std::unique_ptr<const vku::safe_VkPipelineShaderStageCreateInfo> ToShaderStageCI(const VkPipelineShaderStageCreateInfo &cbs);
+// Sub-states built from the (safe) create info of their own pipeline point into it, it lives as long as the pipeline.
+// Graphics libraries build theirs from the application create info, those need a copy, kept alive by "owned".
+const vku::safe_VkPipelineColorBlendStateCreateInfo *ToSafeColorBlendState(
+    const vku::safe_VkPipelineColorBlendStateCreateInfo &cbs,
+    std::unique_ptr<const vku::safe_VkPipelineColorBlendStateCreateInfo> &owned);
+const vku::safe_VkPipelineColorBlendStateCreateInfo *ToSafeColorBlendState(
+    const VkPipelineColorBlendStateCreateInfo &cbs, std::unique_ptr<const vku::safe_VkPipelineColorBlendStateCreateInfo> &owned);
+const vku::safe_VkPipelineMultisampleStateCreateInfo *ToSafeMultisampleState(
+    const vku::safe_VkPipelineMultisampleStateCreateInfo &cbs,
+    std::unique_ptr<const vku::safe_VkPipelineMultisampleStateCreateInfo> &owned);
+const vku::safe_VkPipelineMultisampleStateCreateInfo *ToSafeMultisampleState(
+    const VkPipelineMultisampleStateCreateInfo &cbs, std::unique_ptr<const vku::safe_VkPipelineMultisampleStateCreateInfo> &owned);
+const vku::safe_VkPipelineDepthStencilStateCreateInfo *ToSafeDepthStencilState(
+    const vku::safe_VkPipelineDepthStencilStateCreateInfo &cbs,
+    std::unique_ptr<const vku::safe_VkPipelineDepthStencilStateCreateInfo> &owned);
+const vku::safe_VkPipelineDepthStencilStateCreateInfo *ToSafeDepthStencilState(
+    const VkPipelineDepthStencilStateCreateInfo &cbs,
+    std::unique_ptr<const vku::safe_VkPipelineDepthStencilStateCreateInfo> &owned);
+const vku::safe_VkPipelineShaderStageCreateInfo *ToShaderStageCI(
+    const vku::safe_VkPipelineShaderStageCreateInfo &cbs, std::unique_ptr<const vku::safe_VkPipelineShaderStageCreateInfo> &owned);
+const vku::safe_VkPipelineShaderStageCreateInfo *ToShaderStageCI(
+    const VkPipelineShaderStageCreateInfo &cbs, std::unique_ptr<const vku::safe_VkPipelineShaderStageCreateInfo> &owned);
 
 struct FragmentShaderState : public PipelineSubState {
     FragmentShaderState(const vvl::Pipeline &p, const ValidationStateTracker &dev_data, std::shared_ptr<const vvl::RenderPass> rp,
@@ -119,10 +154,10 @@ struct FragmentShaderState : public PipelineSubState {
                         std::shared_ptr<const vvl::RenderPass> rp)
         : FragmentShaderState(p, dev_data, rp, create_info.subpass, create_info.layout) {
         if (create_info.pMultisampleState) {
-            ms_state = ToSafeMultisampleState(*create_info.pMultisampleState);
+            ms_state = ToSafeMultisampleState(*create_info.pMultisampleState, owned_ms_state);
         }
         if (create_info.pDepthStencilState) {
-            ds_state = ToSafeDepthStencilState(*create_info.pDepthStencilState);
+            ds_state = ToSafeDepthStencilState(*create_info.pDepthStencilState, owned_ds_state);
         }
         FragmentShaderState::SetFragmentShaderInfo(*this, dev_data, create_info);
     }
@@ -133,14 +168,19 @@ struct FragmentShaderState : public PipelineSubState {
     uint32_t subpass = 0;
 
     std::shared_ptr<const vvl::PipelineLayout> pipeline_layout;
-    std::unique_ptr<const vku::safe_VkPipelineMultisampleStateCreateInfo> ms_state;
-    std::unique_ptr<const vku::safe_VkPipelineDepthStencilStateCreateInfo> ds_state;
+    const vku::safe_VkPipelineMultisampleStateCreateInfo *ms_state = nullptr;
+    const vku::safe_VkPipelineDepthStencilStateCreateInfo *ds_state = nullptr;
 
     std::shared_ptr<const vvl::ShaderModule> fragment_shader;
-    std::unique_ptr<const vku::safe_VkPipelineShaderStageCreateInfo> fragment_shader_ci;
+    const vku::safe_VkPipelineShaderStageCreateInfo *fragment_shader_ci = nullptr;
     // many times we need to quickly get the entry point to access the SPIR-V static data
     std::shared_ptr<const spirv::EntryPoint> fragment_entry_point;
 
+    // Only set for graphics libraries, see ToSafeMultisampleState()
+    std::unique_ptr<const vku::safe_VkPipelineMultisampleStateCreateInfo> owned_ms_state;
+    std::unique_ptr<const vku::safe_VkPipelineDepthStencilStateCreateInfo> owned_ds_state;
+    std::unique_ptr<const vku::safe_VkPipelineShaderStageCreateInfo> owned_fragment_shader_ci;
+
   private:
     static void SetFragmentShaderInfo(FragmentShaderState &fs_state, const ValidationStateTracker &state_data,
                                       const VkGraphicsPipelineCreateInfo &create_info);
@@ -164,28 +204,21 @@ static bool IsSampleLocationEnabled(const CreateInfo &create_info) {
 struct FragmentOutputState : public PipelineSubState {
     using AttachmentStateVector = std::vector<VkPipelineColorBlendAttachmentState>;
 
-    FragmentOutputState(const vvl::Pipeline &p, std::shared_ptr<const vvl::RenderPass> rp, uint32_t sp);
+    FragmentOutputState(const vvl::Pipeline &p, std::shared_ptr<const vvl::RenderPass> rp, uint32_t sp,
+                        ColorBlendAttachmentsId attachments);
     // For a graphics library, a "non-safe" create info must be passed in in order for pColorBlendState and pMultisampleState to not
     // get stripped out. If this is a "normal" pipeline, then we want to keep the logic from vku::safe_VkGraphicsPipelineCreateInfo
     // that strips out pointers that should be ignored.
     template <typename CreateInfo>
     FragmentOutputState(const vvl::Pipeline &p, const CreateInfo &create_info, std::shared_ptr<const vvl::RenderPass> rp)
-        : FragmentOutputState(p, rp, create_info.subpass) {
+        : FragmentOutputState(p, rp, create_info.subpass, GetAttachmentsId(create_info)) {
         if (create_info.pColorBlendState) {
-            const auto &cbci = *create_info.pColorBlendState;
-            color_blend_state = ToSafeColorBlendState(cbci);
-            // In case of being dynamic state
-            if (cbci.pAttachments) {
-                if (cbci.attachmentCount) {
-                    attachment_states.reserve(cbci.attachmentCount);
-                    std::copy(cbci.pAttachments, cbci.pAttachments + cbci.attachmentCount, std::back_inserter(attachment_states));
-                }
-                blend_constants_enabled = IsBlendConstantsEnabled(attachment_states);
-            }
+            color_blend_state = ToSafeColorBlendState(*create_info.pColorBlendState, owned_color_blend_state);
+            blend_constants_enabled = IsBlendConstantsEnabled(attachment_states);
         }
 
         if (create_info.pMultisampleState) {
-            ms_state = ToSafeMultisampleState(*create_info.pMultisampleState);
+            ms_state = ToSafeMultisampleState(*create_info.pMultisampleState, owned_ms_state);
             sample_location_enabled = IsSampleLocationEnabled(create_info);
         }
 
@@ -198,11 +231,27 @@ struct FragmentOutputState : public PipelineSubState {
     std::shared_ptr<const vvl::RenderPass> rp_state;
     uint32_t subpass = 0;
 
-    std::unique_ptr<const vku::safe_VkPipelineColorBlendStateCreateInfo> color_blend_state;
-    std::unique_ptr<const vku::safe_VkPipelineMultisampleStateCreateInfo> ms_state;
+    const vku::safe_VkPipelineColorBlendStateCreateInfo *color_blend_state = nullptr;
+    const vku::safe_VkPipelineMultisampleStateCreateInfo *ms_state = nullptr;
 
-    AttachmentStateVector attachment_states;
+    // Shared by all pipelines with the same blend attachment states, empty if they are dynamic
+    const ColorBlendAttachmentsId attachments;
+    const AttachmentStateVector &attachment_states;
 
     bool blend_constants_enabled = false;  // Blend constants enabled for any attachments
     bool sample_location_enabled = false;
+
+    // Only set for graphics libraries, see ToSafeColorBlendState()
+    std::unique_ptr<const vku::safe_VkPipelineColorBlendStateCreateInfo> owned_color_blend_state;
+    std::unique_ptr<const vku::safe_VkPipelineMultisampleStateCreateInfo> owned_ms_state;
+
+  private:
+    template <typename CreateInfo>
+    static ColorBlendAttachmentsId GetAttachmentsId(const CreateInfo &create_info) {
+        // In case of being dynamic state, pAttachments is null
+        if (create_info.pColorBlendState && create_info.pColorBlendState->pAttachments) {
+            return GetCanonicalId(create_info.pColorBlendState->attachmentCount, create_info.pColorBlendState->pAttachments);
+        }
+        return GetCanonicalId(0, nullptr);
+    }
 };
@@ -18,6 +18,8 @@
  * limitations under the License.
  */
 #pragma once
+#include <algorithm>
+#include <array>
 #include "state_tracker/state_object.h"
 
 enum QueryState {
@@ -28,6 +30,82 @@ enum QueryState {
     QUERYSTATE_AVAILABLE,  // Results available.
 };
 
+// States of the queries of a single query pool, indexed by query slot.
+// Slots are grouped in pages of 64 so only the ranges touched are stored, and ranges (vkCmdResetQueryPool,
+// multiview vkCmdEndQuery, ...) are written a page at a time instead of one query at a time.
+class QuerySlotStates {
+  public:
+    static constexpr uint32_t kPageSize = 64;
+
+    QueryState Get(uint32_t slot) const {
+        auto it = pages_.find(slot / kPageSize);
+        if (it == pages_.end()) return QUERYSTATE_UNKNOWN;
+        const uint32_t offset = slot % kPageSize;
+        return (it->second.mask & (1ull << offset)) ? static_cast<QueryState>(it->second.states[offset]) : QUERYSTATE_UNKNOWN;
+    }
+
+    void SetRange(uint32_t first, uint32_t count, QueryState state) {
+        // 64 bit so first + count can not wrap, slots past UINT32_MAX only come from invalid ranges and are dropped
+        const uint64_t end = std::min<uint64_t>(static_cast<uint64_t>(first) + count, uint64_t(1) << 32);
+        for (uint64_t slot = first; slot < end;) {
+            const uint32_t page_index = static_cast<uint32_t>(slot / kPageSize);
+            const uint32_t begin_offset = static_cast<uint32_t>(slot % kPageSize);
+            const uint64_t page_begin = static_cast<uint64_t>(page_index) * kPageSize;
+            const uint32_t end_offset = static_cast<uint32_t>(std::min<uint64_t>(end - page_begin, kPageSize));
+            const uint32_t range_size = end_offset - begin_offset;
+            Page &page = pages_[page_index];
+            page.mask |= (range_size == kPageSize ? ~0ull : ((1ull << range_size) - 1)) << begin_offset;
+            std::fill(page.states.begin() + begin_offset, page.states.begin() + end_offset, static_cast<uint8_t>(state));
+            slot += range_size;
+        }
+    }
+
+    // fn(uint32_t slot, QueryState state) is called for each slot of [first, first + count) in order, with QUERYSTATE_UNKNOWN
+    // for the slots without a state, until it returns false. Pages are looked up once instead of once per slot.
+    template <typename Fn>
+    void ForEachInRange(uint32_t first, uint32_t count, Fn &&fn) const {
+        const uint64_t end = std::min<uint64_t>(static_cast<uint64_t>(first) + count, uint64_t(1) << 32);
+        for (uint64_t slot = first; slot < end;) {
+            const uint32_t page_index = static_cast<uint32_t>(slot / kPageSize);
+            const uint64_t page_end = std::min<uint64_t>((static_cast<uint64_t>(page_index) + 1) * kPageSize, end);
+            auto it = pages_.find(page_index);
+            const Page *page = it != pages_.end() ? &it->second : nullptr;
+            for (; slot < page_end; ++slot) {
+                const uint32_t offset = static_cast<uint32_t>(slot % kPageSize);
+                const QueryState state = (page && (page->mask & (1ull << offset))) ? static_cast<QueryState>(page->states[offset])
+                                                                                   : QUERYSTATE_UNKNOWN;
+                if (!fn(static_cast<uint32_t>(slot), state)) {
+                    return;
+                }
+            }
+        }
+    }
+
+    // fn(uint32_t slot, QueryState state) is called for each query with a state, in no particular order
+    template <typename Fn>
+    void ForEach(Fn &&fn) const {
+        for (const auto &[page_index, page] : pages_) {
+            uint32_t offset = 0;
+            for (uint64_t mask = page.mask; mask != 0; mask >>= 1, ++offset) {
+                if (mask & 1) {
+                    fn(page_index * kPageSize + offset, static_cast<QueryState>(page.states[offset]));
+                }
+            }
+        }
+    }
+
+    bool Empty() const { return pages_.empty(); }
+    void Clear() { pages_.clear(); }
+
+  private:
+    struct Page {
+        uint64_t mask = 0;  // slots of the page which have a state
+        std::array<uint8_t, kPageSize> states;
+    };
+
+    vvl::unordered_map<uint32_t, Page> pages_;
+};
+
 namespace vvl {
 
 class VideoProfileDesc;
@@ -61,15 +139,12 @@ class QueryPool : public StateObject {
 
     void SetQueryState(uint32_t query, uint32_t perf_pass, QueryState state) {
         auto guard = WriteLock();
-        assert(query < query_states_.size());
-        assert((n_performance_passes == 0 && perf_pass == 0) || (perf_pass < n_performance_passes));
-        if (state == QUERYSTATE_RESET) {
-            for (auto &state : query_states_[query]) {
-                state = QUERYSTATE_RESET;
-            }
-        } else {
-            query_states_[query][perf_pass] = state;
-        }
+        SetQueryStateLocked(query, perf_pass, state);
+    }
+    // Set the state of every query of states under a single lock
+    void SetQueryStates(uint32_t perf_pass, const QuerySlotStates &states) {
+        auto guard = WriteLock();
+        states.ForEach([this, perf_pass](uint32_t query, QueryState state) { SetQueryStateLocked(query, perf_pass, state); });
     }
     QueryState GetQueryState(uint32_t query, uint32_t perf_pass) const {
         auto guard = ReadLock();
@@ -96,6 +171,18 @@ class QueryPool : public StateObject {
     ReadLockGuard ReadLock() const { return ReadLockGuard(lock_); }
     WriteLockGuard WriteLock() { return WriteLockGuard(lock_); }
 
+    void SetQueryStateLocked(uint32_t query, uint32_t perf_pass, QueryState state) {
+        assert(query < query_states_.size());
+        assert((n_performance_passes == 0 && perf_pass == 0) || (perf_pass < n_performance_passes));
+        if (state == QUERYSTATE_RESET) {
+            for (auto &state : query_states_[query]) {
+                state = QUERYSTATE_RESET;
+            }
+        } else {
+            query_states_[query][perf_pass] = state;
+        }
+    }
+
     std::vector<small_vector<QueryState, 1, uint32_t>> query_states_;
     mutable std::shared_mutex lock_;
 };
@@ -154,7 +241,60 @@ inline bool operator==(const QueryObject &query1, const QueryObject &query2) {
     return ((query1.pool == query2.pool) && (query1.slot == query2.slot) && (query1.perf_pass == query2.perf_pass));
 }
 
-typedef std::map<QueryObject, QueryState> QueryMap;
+// Query states tracked while replaying the query updates of command buffers, per query pool and performance pass.
+class QueryMap {
+  public:
+    QueryState Get(VkQueryPool pool, uint32_t slot, uint32_t perf_pass) const {
+        auto it = pools_.find(Key{pool, perf_pass});
+        return it != pools_.end() ? it->second.Get(slot) : QUERYSTATE_UNKNOWN;
+    }
+    void Set(const QueryObject &query_obj, QueryState state) {
+        SetRange(query_obj.pool, query_obj.slot, 1, query_obj.perf_pass, state);
+    }
+    void SetRange(VkQueryPool pool, uint32_t first, uint32_t count, uint32_t perf_pass, QueryState state) {
+        if (count == 0) return;
+        pools_[Key{pool, perf_pass}].SetRange(first, count, state);
+    }
+
+    // See QuerySlotStates::ForEachInRange()
+    template <typename Fn>
+    void ForEachInRange(VkQueryPool pool, uint32_t first, uint32_t count, uint32_t perf_pass, Fn &&fn) const {
+        auto it = pools_.find(Key{pool, perf_pass});
+        if (it != pools_.end()) {
+            it->second.ForEachInRange(first, count, std::forward<Fn>(fn));
+        } else {
+            QuerySlotStates().ForEachInRange(first, count, std::forward<Fn>(fn));
+        }
+    }
+
+    // fn(VkQueryPool pool, uint32_t perf_pass, const QuerySlotStates &states) is called for each pool with query states
+    template <typename Fn>
+    void ForEachPool(Fn &&fn) const {
+        for (const auto &[key, states] : pools_) {
+            fn(key.pool, key.perf_pass, states);
+        }
+    }
+
+    bool Contains(VkQueryPool pool, uint32_t slot, uint32_t perf_pass) const {
+        return Get(pool, slot, perf_pass) != QUERYSTATE_UNKNOWN;
+    }
+    void Clear() { pools_.clear(); }
+
+  private:
+    struct Key {
+        VkQueryPool pool;
+        uint32_t perf_pass;
+
+        bool operator==(const Key &rhs) const { return pool == rhs.pool && perf_pass == rhs.perf_pass; }
+        struct Hash {
+            size_t operator()(const Key &key) const {
+                return std::hash<uint64_t>()(CastToUint64(key.pool)) ^ (static_cast<size_t>(key.perf_pass) << 1);
+            }
+        };
+    };
+
+    vvl::unordered_map<Key, QuerySlotStates, Key::Hash> pools_;
+};
 
 enum QueryResultType {
     QUERYRESULT_UNKNOWN,
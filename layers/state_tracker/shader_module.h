@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <cassert>
 #include <cstdlib>
 #include <cstring>
@@ -747,5 +748,8 @@ struct ShaderModule : public StateObject {
 
     // Used as way to match instrumented GPU-AV shader to a VkShaderModule handle
     uint32_t gpu_validation_shader_id = 0;
+
+    // Set once the spirv-val messages deferred by check_shaders_async were reported, later uses skip looking for them
+    mutable std::atomic<bool> deferred_spirv_val_reported{false};
 };
 }  // namespace vvl
@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <cassert>
 #include <cstdlib>
 #include <cstring>
@@ -42,6 +43,9 @@ struct ShaderObject : public StateObject {
     // Used as way to match instrumented GPU-AV shader to a VkShaderEXT handle
     uint32_t gpu_validation_shader_id = 0;
 
+    // Set once the spirv-val messages deferred by check_shaders_async were reported, later binds skip looking for them
+    mutable std::atomic<bool> deferred_spirv_val_reported{false};
+
     // NOTE: this map is 'almost' const and used in performance critical code paths.
     // The values of existing entries in the samplers_used_by_image map
     // are updated at various times. Locking requirements are TBD.
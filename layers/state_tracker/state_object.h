@@ -23,6 +23,9 @@
 #include "utils/vk_layer_utils.h"
 
 #include <atomic>
+#include <memory>
+#include <utility>
+#include <vector>
 
 // Intentionally ignore VulkanTypedHandle::node, it is optional
 inline bool operator==(const VulkanTypedHandle &a, const VulkanTypedHandle &b) noexcept {
@@ -36,6 +39,45 @@ struct hash<VulkanTypedHandle> {
 }  // namespace std
 
 namespace vvl {
+// Data a validation object attaches to a state object.
+// Deriving the state object instead (CreateImageState() and friends) ties it to the validation object which created it,
+// sub states let several validation objects extend the same state object.
+class SubState {
+  public:
+    virtual ~SubState() {}
+};
+
+// Storage for the sub states of the state object types validation objects extend, those types inherit it next to StateObject.
+// Sub states are keyed by the LayerObjectTypeId of their validation object. They must be set when the state object is created,
+// before it is added to the state tracker and shared with other threads.
+class SubStateHolder {
+  public:
+    void AttachSubState(uint32_t container_type, std::unique_ptr<SubState> &&sub_state) {
+        sub_states_.emplace_back(container_type, std::move(sub_state));
+    }
+    template <typename T>
+    T *FindSubState(uint32_t container_type) {
+        return static_cast<T *>(FindSubStateImpl(container_type));
+    }
+    template <typename T>
+    const T *FindSubState(uint32_t container_type) const {
+        return static_cast<const T *>(FindSubStateImpl(container_type));
+    }
+
+  private:
+    SubState *FindSubStateImpl(uint32_t container_type) const {
+        for (const auto &[type, sub_state] : sub_states_) {
+            if (type == container_type) {
+                return sub_state.get();
+            }
+        }
+        return nullptr;
+    }
+
+    // Almost always empty or holding a single entry
+    std::vector<std::pair<uint32_t, std::unique_ptr<SubState>>> sub_states_;
+};
+
 // inheriting from enable_shared_from_this<> adds a method, shared_from_this(), which
 // returns a shared_ptr version of the current object. It requires the object to
 // be created with std::make_shared<> and it MUST NOT be used from the constructor
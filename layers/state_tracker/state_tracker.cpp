@@ -19,6 +19,7 @@
  */
 
 #include <algorithm>
+#include <atomic>
 
 #include <vulkan/utility/vk_format_utils.h>
 #include <vulkan/utility/vk_struct_helper.hpp>
@@ -1311,54 +1312,67 @@ void ValidationStateTracker::PreCallRecordQueueBindSparse(VkQueue queue, uint32_
                                                           VkFence fence, const RecordObject &record_obj) {
     auto queue_state = Get<vvl::Queue>(queue);
 
+    // Streaming systems bind thousands of pages of a few allocations per call, only look each memory up once
+    vvl::unordered_map<VkDeviceMemory, std::shared_ptr<vvl::DeviceMemory>> mem_states;
+    auto get_mem_state = [this, &mem_states](VkDeviceMemory memory) {
+        auto [it, inserted] = mem_states.emplace(memory, nullptr);
+        if (inserted) it->second = Get<vvl::DeviceMemory>(memory);
+        return it->second;
+    };
+    // All the binds of a resource are handed to its memory tracker at once, so they can be coalesced into runs
+    std::vector<vvl::BindableMemoryTracker::SparseBind> sparse_binds;
+    auto gather_binds = [&sparse_binds, &get_mem_state](uint32_t bind_count, const VkSparseMemoryBind *binds) {
+        sparse_binds.clear();
+        sparse_binds.reserve(bind_count);
+        for (uint32_t k = 0; k < bind_count; k++) {
+            const VkSparseMemoryBind &sparse_binding = binds[k];
+            sparse_binds.emplace_back(vvl::BindableMemoryTracker::SparseBind{get_mem_state(sparse_binding.memory),
+                                                                             sparse_binding.memoryOffset,
+                                                                             sparse_binding.resourceOffset, sparse_binding.size});
+        }
+    };
+
     std::vector<vvl::QueueSubmission> submissions;
     submissions.reserve(bindInfoCount);
     for (uint32_t bind_idx = 0; bind_idx < bindInfoCount; ++bind_idx) {
         const VkBindSparseInfo &bind_info = pBindInfo[bind_idx];
         // Track objects tied to memory
         for (uint32_t j = 0; j < bind_info.bufferBindCount; j++) {
-            for (uint32_t k = 0; k < bind_info.pBufferBinds[j].bindCount; k++) {
-                auto sparse_binding = bind_info.pBufferBinds[j].pBinds[k];
-                auto mem_state = Get<vvl::DeviceMemory>(sparse_binding.memory);
-                if (auto buffer_state = Get<vvl::Buffer>(bind_info.pBufferBinds[j].buffer)) {
-                    buffer_state->BindMemory(buffer_state.get(), mem_state, sparse_binding.memoryOffset,
-                                             sparse_binding.resourceOffset, sparse_binding.size);
-                }
+            if (auto buffer_state = Get<vvl::Buffer>(bind_info.pBufferBinds[j].buffer)) {
+                gather_binds(bind_info.pBufferBinds[j].bindCount, bind_info.pBufferBinds[j].pBinds);
+                buffer_state->BindSparseMemory(buffer_state.get(), sparse_binds);
             }
         }
         for (uint32_t j = 0; j < bind_info.imageOpaqueBindCount; j++) {
-            for (uint32_t k = 0; k < bind_info.pImageOpaqueBinds[j].bindCount; k++) {
-                auto sparse_binding = bind_info.pImageOpaqueBinds[j].pBinds[k];
-                auto mem_state = Get<vvl::DeviceMemory>(sparse_binding.memory);
-                if (auto image_state = Get<vvl::Image>(bind_info.pImageOpaqueBinds[j].image)) {
-                    // An Android special image cannot get VkSubresourceLayout until the image binds a memory.
-                    // See: VUID-vkGetImageSubresourceLayout-image-09432
-                    if (!image_state->fragment_encoder) {
-                        image_state->fragment_encoder =
-                            std::make_unique<const subresource_adapter::ImageRangeEncoder>(*image_state);
-                    }
-                    image_state->BindMemory(image_state.get(), mem_state, sparse_binding.memoryOffset,
-                                            sparse_binding.resourceOffset, sparse_binding.size);
+            if (auto image_state = Get<vvl::Image>(bind_info.pImageOpaqueBinds[j].image)) {
+                // An Android special image cannot get VkSubresourceLayout until the image binds a memory.
+                // See: VUID-vkGetImageSubresourceLayout-image-09432
+                if (!image_state->fragment_encoder) {
+                    image_state->fragment_encoder = std::make_unique<const subresource_adapter::ImageRangeEncoder>(*image_state);
                 }
+                gather_binds(bind_info.pImageOpaqueBinds[j].bindCount, bind_info.pImageOpaqueBinds[j].pBinds);
+                image_state->BindSparseMemory(image_state.get(), sparse_binds);
             }
         }
         for (uint32_t j = 0; j < bind_info.imageBindCount; j++) {
+            auto image_state = Get<vvl::Image>(bind_info.pImageBinds[j].image);
+            if (!image_state) continue;
+            // An Android special image cannot get VkSubresourceLayout until the image binds a memory.
+            // See: VUID-vkGetImageSubresourceLayout-image-09432
+            if (!image_state->fragment_encoder) {
+                image_state->fragment_encoder = std::make_unique<const subresource_adapter::ImageRangeEncoder>(*image_state);
+            }
+            sparse_binds.clear();
+            sparse_binds.reserve(bind_info.pImageBinds[j].bindCount);
             for (uint32_t k = 0; k < bind_info.pImageBinds[j].bindCount; k++) {
-                auto sparse_binding = bind_info.pImageBinds[j].pBinds[k];
+                const VkSparseImageMemoryBind &sparse_binding = bind_info.pImageBinds[j].pBinds[k];
                 // TODO: This size is broken for non-opaque bindings, need to update to comprehend full sparse binding data
                 VkDeviceSize size = sparse_binding.extent.depth * sparse_binding.extent.height * sparse_binding.extent.width * 4;
                 VkDeviceSize offset = sparse_binding.offset.z * sparse_binding.offset.y * sparse_binding.offset.x * 4;
-                auto mem_state = Get<vvl::DeviceMemory>(sparse_binding.memory);
-                if (auto image_state = Get<vvl::Image>(bind_info.pImageBinds[j].image)) {
-                    // An Android special image cannot get VkSubresourceLayout until the image binds a memory.
-                    // See: VUID-vkGetImageSubresourceLayout-image-09432
-                    if (!image_state->fragment_encoder) {
-                        image_state->fragment_encoder =
-                            std::make_unique<const subresource_adapter::ImageRangeEncoder>(*image_state);
-                    }
-                    image_state->BindMemory(image_state.get(), mem_state, sparse_binding.memoryOffset, offset, size);
-                }
+                sparse_binds.emplace_back(vvl::BindableMemoryTracker::SparseBind{get_mem_state(sparse_binding.memory),
+                                                                                 sparse_binding.memoryOffset, offset, size});
             }
+            image_state->BindSparseMemory(image_state.get(), sparse_binds);
         }
         auto timeline_info = vku::FindStructInPNextChain<VkTimelineSemaphoreSubmitInfo>(bind_info.pNext);
         Location submit_loc = record_obj.location.dot(vvl::Field::pBindInfo, bind_idx);
@@ -1876,6 +1890,14 @@ void ValidationStateTracker::PreCallRecordDestroyPipelineCache(VkDevice device,
     Destroy<vvl::PipelineCache>(pipelineCache);
 }
 
+// Building a pipeline state copies its create info and parses its inlined shaders. The pipelines of a batch are independent, so
+// the large batches applications create while warming up their pipeline caches are split across the device thread pool.
+uint32_t ValidationStateTracker::GetPipelineBatchWorkerCount(uint32_t count) {
+    constexpr uint32_t kMinPipelinesPerWorker = 8;
+    constexpr uint32_t kMaxWorkers = 8;
+    return vvl::GetParallelWorkerCount(count, kMinPipelinesPerWorker, kMaxWorkers);
+}
+
 std::shared_ptr<vvl::Pipeline> ValidationStateTracker::CreateGraphicsPipelineState(
     const VkGraphicsPipelineCreateInfo *pCreateInfo, std::shared_ptr<const vvl::PipelineCache> pipeline_cache,
     std::shared_ptr<const vvl::RenderPass> &&render_pass, std::shared_ptr<const vvl::PipelineLayout> &&layout,
@@ -1889,11 +1911,11 @@ bool ValidationStateTracker::PreCallValidateCreateGraphicsPipelines(VkDevice dev
                                                                     const VkAllocationCallbacks *pAllocator, VkPipeline *pPipelines,
                                                                     const ErrorObject &error_obj, PipelineStates &pipeline_states,
                                                                     chassis::CreateGraphicsPipelines &chassis_state) const {
-    bool skip = false;
     // Set up the state that CoreChecks, gpu_validation and later StateTracker Record will use.
-    pipeline_states.reserve(count);
+    pipeline_states.resize(count);
     auto pipeline_cache = Get<vvl::PipelineCache>(pipelineCache);
-    for (uint32_t i = 0; i < count; i++) {
+    std::atomic<bool> skip{false};
+    vvl::ParallelFor(thread_pool, count, GetPipelineBatchWorkerCount(count), [&](uint32_t i) {
         const auto &create_info = pCreateInfos[i];
         auto layout_state = Get<vvl::PipelineLayout>(create_info.layout);
         std::shared_ptr<const vvl::RenderPass> render_pass;
@@ -1910,16 +1932,16 @@ bool ValidationStateTracker::PreCallValidateCreateGraphicsPipelines(VkDevice dev
             const bool is_graphics_lib = GetGraphicsLibType(create_info) != static_cast<VkGraphicsPipelineLibraryFlagsEXT>(0);
             const bool has_link_info = vku::FindStructInPNextChain<VkPipelineLibraryCreateInfoKHR>(create_info.pNext) != nullptr;
             if (!is_graphics_lib && !has_link_info) {
-                skip = true;
+                skip.store(true, std::memory_order_relaxed);
             }
         }
 
         auto shader_unique_id_map =
             (chassis_state.shader_unique_id_maps.size() > i) ? &chassis_state.shader_unique_id_maps[i] : nullptr;
-        pipeline_states.push_back(CreateGraphicsPipelineState(&create_info, pipeline_cache, std::move(render_pass),
-                                                              std::move(layout_state), shader_unique_id_map));
-    }
-    return skip;
+        pipeline_states[i] = CreateGraphicsPipelineState(&create_info, pipeline_cache, std::move(render_pass),
+                                                         std::move(layout_state), shader_unique_id_map);
+    });
+    return skip.load(std::memory_order_relaxed);
 }
 
 void ValidationStateTracker::PostCallRecordCreateGraphicsPipelines(VkDevice device, VkPipelineCache pipelineCache, uint32_t count,
@@ -1948,13 +1970,13 @@ bool ValidationStateTracker::PreCallValidateCreateComputePipelines(VkDevice devi
                                                                    const VkAllocationCallbacks *pAllocator, VkPipeline *pPipelines,
                                                                    const ErrorObject &error_obj, PipelineStates &pipeline_states,
                                                                    chassis::CreateComputePipelines &chassis_state) const {
-    pipeline_states.reserve(count);
+    pipeline_states.resize(count);
     auto pipeline_cache = Get<vvl::PipelineCache>(pipelineCache);
-    for (uint32_t i = 0; i < count; i++) {
+    vvl::ParallelFor(thread_pool, count, GetPipelineBatchWorkerCount(count), [&](uint32_t i) {
         // Create and initialize internal tracking data structure
-        pipeline_states.push_back(
-            CreateComputePipelineState(&pCreateInfos[i], pipeline_cache, Get<vvl::PipelineLayout>(pCreateInfos[i].layout)));
-    }
+        pipeline_states[i] =
+            CreateComputePipelineState(&pCreateInfos[i], pipeline_cache, Get<vvl::PipelineLayout>(pCreateInfos[i].layout));
+    });
     return false;
 }
 
@@ -2158,13 +2180,19 @@ void ValidationStateTracker::PreCallRecordFreeDescriptorSets(VkDevice device, Vk
 
 void ValidationStateTracker::PerformUpdateDescriptorSets(uint32_t write_count, const VkWriteDescriptorSet *p_wds,
                                                          uint32_t copy_count, const VkCopyDescriptorSet *p_cds) {
-    // Write updates first
+    // Write updates first. Apps often write many descriptors of the same set one at a time, so consecutive writes to the same
+    // set are applied as a single run (one map look-up and one invalidation of the bound command buffers per run)
     uint32_t i = 0;
-    for (i = 0; i < write_count; ++i) {
-        auto dest_set = p_wds[i].dstSet;
+    while (i < write_count) {
+        const VkDescriptorSet dest_set = p_wds[i].dstSet;
+        uint32_t run_end = i + 1;
+        while (run_end < write_count && p_wds[run_end].dstSet == dest_set) {
+            ++run_end;
+        }
         if (auto set_node = Get<vvl::DescriptorSet>(dest_set)) {
-            set_node->PerformWriteUpdate(p_wds[i]);
+            set_node->PerformWriteUpdates(run_end - i, &p_wds[i]);
         }
+        i = run_end;
     }
     // Now copy updates
     for (i = 0; i < copy_count; ++i) {
@@ -5591,6 +5619,65 @@ std::shared_ptr<vvl::CommandBuffer> ValidationStateTracker::CreateCmdBufferState
     return std::make_shared<vvl::CommandBuffer>(*this, handle, pAllocateInfo, pool);
 }
 
+static std::atomic<uint64_t> next_command_buffer_cache_epoch{1};
+
+namespace {
+struct CommandBufferCacheEntry {
+    const ValidationStateTracker *tracker = nullptr;
+    VkCommandBuffer handle = VK_NULL_HANDLE;
+    uint64_t epoch = 0;  // never matches a tracker's epoch
+    // Does not keep the state alive, the state is also checked for Destroyed() as it can outlive its map entry
+    std::weak_ptr<vvl::CommandBuffer> cb_state;
+};
+
+// One entry per validation object deriving from ValidationStateTracker which is enabled at the same time
+struct CommandBufferCache {
+    static constexpr uint32_t kSize = 4;
+    CommandBufferCacheEntry entries[kSize];
+    uint32_t next_replaced = 0;
+};
+thread_local CommandBufferCache command_buffer_cache;
+}  // namespace
+
+uint64_t ValidationStateTracker::NewCommandBufferCacheEpoch() {
+    return next_command_buffer_cache_epoch.fetch_add(1, std::memory_order_relaxed);
+}
+
+void ValidationStateTracker::InvalidateCommandBufferCache() {
+    command_buffer_cache_epoch_.store(NewCommandBufferCacheEpoch(), std::memory_order_release);
+}
+
+std::shared_ptr<vvl::CommandBuffer> ValidationStateTracker::GetCommandBufferState(VkCommandBuffer handle) const {
+    // Loaded before the map lookup, so a state replaced while looking it up is never cached with the new epoch
+    const uint64_t epoch = command_buffer_cache_epoch_.load(std::memory_order_acquire);
+    CommandBufferCache &cache = command_buffer_cache;
+    CommandBufferCacheEntry *tracker_entry = nullptr;
+    for (CommandBufferCacheEntry &entry : cache.entries) {
+        if (entry.tracker == this) {
+            if (entry.handle == handle && entry.epoch == epoch) {
+                auto cb_state = entry.cb_state.lock();
+                if (cb_state && !cb_state->Destroyed()) {
+                    return cb_state;
+                }
+            }
+            tracker_entry = &entry;
+            break;
+        }
+    }
+
+    const auto found_it = command_buffer_map_.find(handle);
+    if (found_it == command_buffer_map_.end()) {
+        return nullptr;
+    }
+    if (!tracker_entry) {
+        tracker_entry = &cache.entries[cache.next_replaced];
+        cache.next_replaced = (cache.next_replaced + 1) % CommandBufferCache::kSize;
+    }
+    *tracker_entry = {this, handle, epoch, found_it->second};
+    // NOTE: vvl::concurrent_unordered_map::find() makes a copy of the value, so it is safe to move out.
+    return std::move(found_it->second);
+}
+
 std::shared_ptr<vvl::DeviceMemory> ValidationStateTracker::CreateDeviceMemoryState(
     VkDeviceMemory handle, const VkMemoryAllocateInfo *pAllocateInfo, uint64_t fake_address, const VkMemoryType &memory_type,
     const VkMemoryHeap &memory_heap, std::optional<vvl::DedicatedBinding> &&dedicated_binding, uint32_t physical_device_count) {
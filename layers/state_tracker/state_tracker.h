@@ -32,6 +32,7 @@
 #include <atomic>
 #include <functional>
 #include <memory>
+#include <type_traits>
 #include <vector>
 
 namespace vvl {
@@ -284,7 +285,16 @@ class ValidationStateTracker : public ValidationObject {
         // Finish setting up the object node tree, which cannot be done from the state object contructors
         // due to use of shared_from_this()
         state_object->LinkChildNodes();
-        map.insert_or_assign(handle, std::move(state_object));
+        if constexpr (std::is_same_v<typename state_object::Traits<State>::BaseType, vvl::CommandBuffer>) {
+            // The handle could still be cached for an older state which is replaced without being destroyed
+            const bool replaced = map.find(handle) != map.end();
+            map.insert_or_assign(handle, std::move(state_object));
+            if (replaced) {
+                InvalidateCommandBufferCache();
+            }
+        } else {
+            map.insert_or_assign(handle, std::move(state_object));
+        }
     }
 
     template <typename State, typename Traits = typename state_object::Traits<State>>
@@ -338,6 +348,9 @@ class ValidationStateTracker : public ValidationObject {
 
     template <typename State, typename Traits = typename state_object::Traits<State>>
     typename Traits::SharedType Get(typename Traits::HandleType handle) {
+        if constexpr (std::is_same_v<typename Traits::BaseType, vvl::CommandBuffer>) {
+            return std::static_pointer_cast<State>(GetCommandBufferState(handle));
+        }
         const auto& map = GetStateMap<State>();
         const auto found_it = map.find(handle);
         if (found_it == map.end()) {
@@ -350,6 +363,9 @@ class ValidationStateTracker : public ValidationObject {
 
     template <typename State, typename Traits = typename state_object::Traits<State>>
     typename Traits::ConstSharedType Get(typename Traits::HandleType handle) const {
+        if constexpr (std::is_same_v<typename Traits::BaseType, vvl::CommandBuffer>) {
+            return std::static_pointer_cast<const State>(GetCommandBufferState(handle));
+        }
         const auto& map = GetStateMap<State>();
         const auto found_it = map.find(handle);
         if (found_it == map.end()) {
@@ -696,6 +712,8 @@ class ValidationStateTracker : public ValidationObject {
     void PostCallRecordResetCommandPool(VkDevice device, VkCommandPool commandPool, VkCommandPoolResetFlags flags,
                                         const RecordObject& record_obj) override;
 
+    // Threads used to build, and validate, the pipelines of a vkCreate*Pipelines batch. 0 or 1 if the batch is too small to split
+    static uint32_t GetPipelineBatchWorkerCount(uint32_t count);
     virtual std::shared_ptr<vvl::Pipeline> CreateComputePipelineState(const VkComputePipelineCreateInfo* pCreateInfo,
                                                                       std::shared_ptr<const vvl::PipelineCache> pipeline_cache,
                                                                       std::shared_ptr<const vvl::PipelineLayout>&& layout) const;
@@ -1944,6 +1962,20 @@ class ValidationStateTracker : public ValidationObject {
 
     std::atomic<vvl::StateObject::IdType> object_id_{1}; // 0 is an invalid id
 
+    // Every vkCmd* hook of every validation object looks up its command buffer state. Recording is externally synchronized,
+    // so a thread records into the same command buffer for many commands in a row: each thread remembers the last command
+    // buffer it looked up, which avoids taking a bucket lock of command_buffer_map_ (shared by all recording threads) per hook.
+    // This only removes the map lookup: the chassis still takes validation_object_mutex around every hook of the validation
+    // objects which do not override ReadLock()/WriteLock() for fine_grained_locking (syncval), and the command buffer's own
+    // lock is still taken by GetRead<>()/GetWrite<>().
+    // Cached states are dropped once destroyed, so freeing command buffers does not affect the other threads' caches.
+    std::shared_ptr<vvl::CommandBuffer> GetCommandBufferState(VkCommandBuffer handle) const;
+    // Must be called when a command buffer state is replaced in command_buffer_map_ without being destroyed
+    void InvalidateCommandBufferCache();
+    // Epochs are unique across trackers, so entries of a tracker reallocated at the same address never match
+    static uint64_t NewCommandBufferCacheEpoch();
+    std::atomic<uint64_t> command_buffer_cache_epoch_{NewCommandBufferCacheEpoch()};
+
     // Simple base address allocator allow allow VkDeviceMemory allocations to appear to exist in a common address space.
     // At 256GB allocated/sec  ( > 8GB at 30Hz), will overflow in just over 2 years
     class FakeAllocator {
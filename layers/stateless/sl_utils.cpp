@@ -216,8 +216,8 @@ bool StatelessValidation::ValidateStructPnext(const Location &loc, const void *n
     bool skip = false;
 
     if (next != nullptr) {
-        vvl::unordered_set<const void *> cycle_check;
-        vvl::unordered_set<VkStructureType, vvl::hash<int>> unique_stype_check;
+        // Chains are short, a linear scan of the sTypes seen so far beats hashing them (and the allocations of a set)
+        small_vector<VkStructureType, 16> unique_stype_check;
         const char *disclaimer =
             "This error is based on the Valid Usage documentation for version %" PRIu32
             " of the Vulkan header.  It is possible that "
@@ -237,13 +237,15 @@ bool StatelessValidation::ValidateStructPnext(const Location &loc, const void *n
             while (current != nullptr) {
                 if ((loc.function != Func::vkCreateInstance || (current->sType != VK_STRUCTURE_TYPE_LOADER_INSTANCE_CREATE_INFO)) &&
                     (loc.function != Func::vkCreateDevice || (current->sType != VK_STRUCTURE_TYPE_LOADER_DEVICE_CREATE_INFO))) {
-                    std::string type_name = string_VkStructureType(current->sType);
-                    if (unique_stype_check.find(current->sType) != unique_stype_check.end() && !IsDuplicatePnext(current->sType)) {
+                    if (std::find(unique_stype_check.begin(), unique_stype_check.end(), current->sType) !=
+                            unique_stype_check.end() &&
+                        !IsDuplicatePnext(current->sType)) {
                         // stype_vuid will only be null if there are no listed pNext and will hit disclaimer check
                         skip |= LogError(stype_vuid, device, pNext_loc,
-                                         "chain contains duplicate structure types: %s appears multiple times.", type_name.c_str());
+                                         "chain contains duplicate structure types: %s appears multiple times.",
+                                         string_VkStructureType(current->sType));
                     } else {
-                        unique_stype_check.insert(current->sType);
+                        unique_stype_check.emplace_back(current->sType);
                     }
 
                     // Search custom stype list -- if sType found, skip this entirely
@@ -256,6 +258,8 @@ bool StatelessValidation::ValidateStructPnext(const Location &loc, const void *n
                     }
                     if (!custom) {
                         if (std::find(start, end, current->sType) == end) {
+                            // Only build the name when reporting, this is on the path of every pNext chain
+                            const std::string type_name = string_VkStructureType(current->sType);
                             // String returned by string_VkStructureType for an unrecognized type.
                             if (type_name.compare("Unhandled VkStructureType") == 0) {
                                 std::string message = "chain includes a structure with unknown VkStructureType (%" PRIu32 "). ";
@@ -106,7 +106,7 @@ AccessContext::AccessContext(uint32_t subpass, VkQueueFlags queue_flags,
 template <typename NormalizeOp>
 void AccessContext::Trim(NormalizeOp &&normalize) {
     ForAll(std::forward<NormalizeOp>(normalize));
-    sparse_container::consolidate(access_state_map_);
+    Consolidate();
 }
 
 void AccessContext::Trim() {
@@ -114,6 +114,17 @@ void AccessContext::Trim() {
     Trim(normalize);
 }
 
+void AccessContext::Consolidate() {
+    sparse_container::consolidate(access_state_map_);
+    image_ranges_split_ = false;
+}
+
+void AccessContext::ConsolidateAfterBarrier() {
+    if (image_ranges_split_) {
+        Consolidate();
+    }
+}
+
 void AccessContext::TrimAndClearFirstAccess() {
     auto normalize = [](ResourceAccessRangeMap::value_type &access) {
         access.second.Normalize();
@@ -237,6 +248,7 @@ void AccessContext::UpdateAccessState(ImageRangeGen &range_gen, SyncStageAccessI
                                       ResourceUsageTag tag) {
     UpdateMemoryAccessStateFunctor action(*this, current_usage, ordering_rule, tag);
     UpdateMemoryAccessState(action, range_gen);
+    image_ranges_split_ = true;
 }
 
 void AccessContext::UpdateAccessState(const ImageRangeGen &range_gen, SyncStageAccessIndex current_usage,
@@ -296,6 +296,7 @@ class AccessContext {
         dst_external_ = TrackBack();
         start_tag_ = ResourceUsageTag();
         access_state_map_.clear();
+        image_ranges_split_ = false;
     }
 
     void ResolvePreviousAccesses();
@@ -343,6 +344,13 @@ class AccessContext {
     AccessContext(const AccessContext &copy_from) = default;
     void Trim();
     void TrimAndClearFirstAccess();
+    // Merge adjacent ranges with identical access state. Unlike Trim, first use information is kept.
+    void Consolidate();
+    // Image accesses recorded piece by piece (per layer, region, ...) split the ranges they touch, leaving adjacent ranges with
+    // the same state. They are merged only after the operations that already walk the whole map: pipeline barriers with global
+    // memory barriers, and event waits (which resolve the pending barriers of every range). Buffer and image barriers only
+    // visit their own ranges and do not merge. The remaining splits are merged at vkEndCommandBuffer.
+    void ConsolidateAfterBarrier();
     void AddReferencedTags(ResourceUsageTagSet &referenced) const;
 
     ResourceAccessRangeMap &GetAccessStateMap() { return access_state_map_; }
@@ -455,6 +463,7 @@ class AccessContext {
     HazardResult DetectPreviousHazard(Detector &detector, const ResourceAccessRange &range) const;
 
     ResourceAccessRangeMap access_state_map_;
+    bool image_ranges_split_ = false;  // image accesses were recorded since the last Consolidate()
     std::vector<TrackBack> prev_;
     std::vector<TrackBack *> prev_by_subpass_;
     // These contexts *must* have the same lifespan as this context, or be cleared, before the referenced contexts can expire
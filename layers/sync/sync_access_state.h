@@ -406,9 +406,12 @@ class ResourceAccessState : public SyncStageAccess {
 
         const bool read_write_same = write_same && (last_read_stages == rhs.last_read_stages) && (last_reads == rhs.last_reads);
 
+        // Adjacent ranges are merged when their states compare equal, so every member which affects later validation counts
         const bool same = read_write_same && (first_accesses_ == rhs.first_accesses_) &&
                           (first_read_stages_ == rhs.first_read_stages_) &&
-                          (first_write_layout_ordering_ == rhs.first_write_layout_ordering_);
+                          (first_write_layout_ordering_ == rhs.first_write_layout_ordering_) &&
+                          (first_access_closed_ == rhs.first_access_closed_) &&
+                          (pending_layout_transition == rhs.pending_layout_transition);
 
         return same;
     }
@@ -364,6 +364,10 @@ void SyncOpPipelineBarrier::ReplayRecord(CommandExecutionContext &exec_context,
     ApplyBarriers(barrier_set.buffer_memory_barriers, factory, queue_id, exec_tag, access_context);
     ApplyBarriers(barrier_set.image_memory_barriers, factory, queue_id, exec_tag, access_context);
     ApplyGlobalBarriers(barrier_set.memory_barriers, factory, queue_id, exec_tag, access_context);
+    // Buffer and image barriers only visit their own ranges, merging is only free when a global barrier walked the whole map
+    if (!barrier_set.memory_barriers.empty()) {
+        access_context->ConsolidateAfterBarrier();
+    }
     if (barrier_set.single_exec_scope) {
         events_context->ApplyBarrier(barrier_set.src_exec_scope, barrier_set.dst_exec_scope, exec_tag);
     } else {
@@ -783,6 +787,7 @@ void SyncOpWaitEvents::ReplayRecord(CommandExecutionContext &exec_context, Resou
     // Apply the pending barriers
     ResolvePendingBarrierFunctor apply_pending_action(exec_tag);
     access_context->ApplyToContext(apply_pending_action);
+    access_context->ConsolidateAfterBarrier();
 }
 
 bool SyncOpWaitEvents::ReplayValidate(ReplayState &replay, ResourceUsageTag recorded_tag) const {
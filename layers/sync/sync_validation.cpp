@@ -637,6 +637,18 @@ void SyncValidator::PostCallRecordBeginCommandBuffer(VkCommandBuffer commandBuff
     cb_state->access_context.Reset();
 }
 
+void SyncValidator::PostCallRecordEndCommandBuffer(VkCommandBuffer commandBuffer, const RecordObject &record_obj) {
+    StateTracker::PostCallRecordEndCommandBuffer(commandBuffer, record_obj);
+
+    // The recorded accesses are resolved into the primary (or the submitted batch) each time the command buffer is executed,
+    // compact them once here so that cost follows the number of distinct ranges rather than the number of recorded commands.
+    auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    assert(cb_state);
+    if (AccessContext *access_context = cb_state->access_context.GetCurrentAccessContext()) {
+        access_context->Consolidate();
+    }
+}
+
 void SyncValidator::RecordCmdBeginRenderPass(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo *pRenderPassBegin,
                                              const VkSubpassBeginInfo *pSubpassBeginInfo, Func command) {
     auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
@@ -47,4 +47,9 @@ uint64_t DescriptorVariableHash(const void *info, const size_t info_size) {
     return XXH64(info, info_size, seed);
 }
 
+uint64_t IndexBufferHash(const void *indices, const size_t size) {
+    // Index buffers can be large, XXH3 is much faster than XXH32/XXH64 on long inputs
+    return XXH3_64bits(indices, size);
+}
+
 }  // namespace hash_util
\ No newline at end of file
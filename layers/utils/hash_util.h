@@ -164,4 +164,6 @@ uint32_t ShaderHash(const void *pCode, const size_t codeSize);
 
 uint64_t DescriptorVariableHash(const void *info, const size_t info_size);
 
+uint64_t IndexBufferHash(const void *indices, const size_t size);
+
 }  // namespace hash_util
@@ -0,0 +1,311 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "utils/index_buffer_scan.h"
+
+#include <algorithm>
+#include <bitset>
+#include <limits>
+#include <vector>
+
+#include "utils/vk_layer_utils.h"
+
+// The instruction set is picked at compile time, there is no runtime CPU dispatch.
+// SSE2 is part of x86-64, AVX2 and SSE4.1 are only used if the build enables them.
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define INDEX_SCAN_AVX2
+#define INDEX_SCAN_X86
+#elif defined(__SSE4_1__)
+#include <smmintrin.h>
+#define INDEX_SCAN_SSE41
+#define INDEX_SCAN_X86
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define INDEX_SCAN_SSE2
+#define INDEX_SCAN_X86
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define INDEX_SCAN_NEON
+#endif
+
+#if defined(INDEX_SCAN_X86) || defined(INDEX_SCAN_NEON)
+#define INDEX_SCAN_SIMD
+#endif
+
+namespace index_buffer {
+
+#if defined(INDEX_SCAN_SIMD)
+// Unsigned min/max over a full register of indices.
+// Store() gives back the original index values, undoing any transformation done by Load().
+template <typename T>
+struct SimdOps;
+
+#if defined(INDEX_SCAN_AVX2)
+template <>
+struct SimdOps<uint8_t> {
+    using Reg = __m256i;
+    static constexpr uint32_t kBytes = 32;
+    static Reg Load(const uint8_t *p) { return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p)); }
+    static void Store(uint8_t *p, Reg r) { _mm256_storeu_si256(reinterpret_cast<__m256i *>(p), r); }
+    static Reg Min(Reg a, Reg b) { return _mm256_min_epu8(a, b); }
+    static Reg Max(Reg a, Reg b) { return _mm256_max_epu8(a, b); }
+};
+template <>
+struct SimdOps<uint16_t> {
+    using Reg = __m256i;
+    static constexpr uint32_t kBytes = 32;
+    static Reg Load(const uint16_t *p) { return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p)); }
+    static void Store(uint16_t *p, Reg r) { _mm256_storeu_si256(reinterpret_cast<__m256i *>(p), r); }
+    static Reg Min(Reg a, Reg b) { return _mm256_min_epu16(a, b); }
+    static Reg Max(Reg a, Reg b) { return _mm256_max_epu16(a, b); }
+};
+template <>
+struct SimdOps<uint32_t> {
+    using Reg = __m256i;
+    static constexpr uint32_t kBytes = 32;
+    static Reg Load(const uint32_t *p) { return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p)); }
+    static void Store(uint32_t *p, Reg r) { _mm256_storeu_si256(reinterpret_cast<__m256i *>(p), r); }
+    static Reg Min(Reg a, Reg b) { return _mm256_min_epu32(a, b); }
+    static Reg Max(Reg a, Reg b) { return _mm256_max_epu32(a, b); }
+};
+#elif defined(INDEX_SCAN_SSE41)
+template <>
+struct SimdOps<uint8_t> {
+    using Reg = __m128i;
+    static constexpr uint32_t kBytes = 16;
+    static Reg Load(const uint8_t *p) { return _mm_loadu_si128(reinterpret_cast<const __m128i *>(p)); }
+    static void Store(uint8_t *p, Reg r) { _mm_storeu_si128(reinterpret_cast<__m128i *>(p), r); }
+    static Reg Min(Reg a, Reg b) { return _mm_min_epu8(a, b); }
+    static Reg Max(Reg a, Reg b) { return _mm_max_epu8(a, b); }
+};
+template <>
+struct SimdOps<uint16_t> {
+    using Reg = __m128i;
+    static constexpr uint32_t kBytes = 16;
+    static Reg Load(const uint16_t *p) { return _mm_loadu_si128(reinterpret_cast<const __m128i *>(p)); }
+    static void Store(uint16_t *p, Reg r) { _mm_storeu_si128(reinterpret_cast<__m128i *>(p), r); }
+    static Reg Min(Reg a, Reg b) { return _mm_min_epu16(a, b); }
+    static Reg Max(Reg a, Reg b) { return _mm_max_epu16(a, b); }
+};
+template <>
+struct SimdOps<uint32_t> {
+    using Reg = __m128i;
+    static constexpr uint32_t kBytes = 16;
+    static Reg Load(const uint32_t *p) { return _mm_loadu_si128(reinterpret_cast<const __m128i *>(p)); }
+    static void Store(uint32_t *p, Reg r) { _mm_storeu_si128(reinterpret_cast<__m128i *>(p), r); }
+    static Reg Min(Reg a, Reg b) { return _mm_min_epu32(a, b); }
+    static Reg Max(Reg a, Reg b) { return _mm_max_epu32(a, b); }
+};
+#elif defined(INDEX_SCAN_SSE2)
+// SSE2 only has unsigned min/max for 8-bit values.
+// 16 and 32-bit indices are biased by their sign bit so signed comparisons give the unsigned order.
+template <>
+struct SimdOps<uint8_t> {
+    using Reg = __m128i;
+    static constexpr uint32_t kBytes = 16;
+    static Reg Load(const uint8_t *p) { return _mm_loadu_si128(reinterpret_cast<const __m128i *>(p)); }
+    static void Store(uint8_t *p, Reg r) { _mm_storeu_si128(reinterpret_cast<__m128i *>(p), r); }
+    static Reg Min(Reg a, Reg b) { return _mm_min_epu8(a, b); }
+    static Reg Max(Reg a, Reg b) { return _mm_max_epu8(a, b); }
+};
+template <>
+struct SimdOps<uint16_t> {
+    using Reg = __m128i;
+    static constexpr uint32_t kBytes = 16;
+    static Reg Bias() { return _mm_set1_epi16(static_cast<short>(0x8000)); }
+    static Reg Load(const uint16_t *p) { return _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i *>(p)), Bias()); }
+    static void Store(uint16_t *p, Reg r) { _mm_storeu_si128(reinterpret_cast<__m128i *>(p), _mm_xor_si128(r, Bias())); }
+    static Reg Min(Reg a, Reg b) { return _mm_min_epi16(a, b); }
+    static Reg Max(Reg a, Reg b) { return _mm_max_epi16(a, b); }
+};
+template <>
+struct SimdOps<uint32_t> {
+    using Reg = __m128i;
+    static constexpr uint32_t kBytes = 16;
+    static Reg Bias() { return _mm_set1_epi32(static_cast<int>(0x80000000u)); }
+    static Reg Load(const uint32_t *p) { return _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i *>(p)), Bias()); }
+    static void Store(uint32_t *p, Reg r) { _mm_storeu_si128(reinterpret_cast<__m128i *>(p), _mm_xor_si128(r, Bias())); }
+    static Reg Min(Reg a, Reg b) {
+        const Reg a_greater = _mm_cmpgt_epi32(a, b);
+        return _mm_or_si128(_mm_and_si128(a_greater, b), _mm_andnot_si128(a_greater, a));
+    }
+    static Reg Max(Reg a, Reg b) {
+        const Reg a_greater = _mm_cmpgt_epi32(a, b);
+        return _mm_or_si128(_mm_and_si128(a_greater, a), _mm_andnot_si128(a_greater, b));
+    }
+};
+#elif defined(INDEX_SCAN_NEON)
+template <>
+struct SimdOps<uint8_t> {
+    using Reg = uint8x16_t;
+    static constexpr uint32_t kBytes = 16;
+    static Reg Load(const uint8_t *p) { return vld1q_u8(p); }
+    static void Store(uint8_t *p, Reg r) { vst1q_u8(p, r); }
+    static Reg Min(Reg a, Reg b) { return vminq_u8(a, b); }
+    static Reg Max(Reg a, Reg b) { return vmaxq_u8(a, b); }
+};
+template <>
+struct SimdOps<uint16_t> {
+    using Reg = uint16x8_t;
+    static constexpr uint32_t kBytes = 16;
+    static Reg Load(const uint16_t *p) { return vld1q_u16(p); }
+    static void Store(uint16_t *p, Reg r) { vst1q_u16(p, r); }
+    static Reg Min(Reg a, Reg b) { return vminq_u16(a, b); }
+    static Reg Max(Reg a, Reg b) { return vmaxq_u16(a, b); }
+};
+template <>
+struct SimdOps<uint32_t> {
+    using Reg = uint32x4_t;
+    static constexpr uint32_t kBytes = 16;
+    static Reg Load(const uint32_t *p) { return vld1q_u32(p); }
+    static void Store(uint32_t *p, Reg r) { vst1q_u32(p, r); }
+    static Reg Min(Reg a, Reg b) { return vminq_u32(a, b); }
+    static Reg Max(Reg a, Reg b) { return vmaxq_u32(a, b); }
+};
+#endif
+#endif  // INDEX_SCAN_SIMD
+
+template <typename T>
+static MinMax ScanMinMax(const T *indices, uint32_t index_count) {
+    MinMax result;
+    uint32_t i = 0;
+#if defined(INDEX_SCAN_SIMD)
+    using Ops = SimdOps<T>;
+    constexpr uint32_t kLanes = Ops::kBytes / sizeof(T);
+    if (index_count >= kLanes) {
+        typename Ops::Reg v_min = Ops::Load(indices);
+        typename Ops::Reg v_max = v_min;
+        for (i = kLanes; i + kLanes <= index_count; i += kLanes) {
+            const typename Ops::Reg v = Ops::Load(indices + i);
+            v_min = Ops::Min(v_min, v);
+            v_max = Ops::Max(v_max, v);
+        }
+
+        T lanes[kLanes];
+        Ops::Store(lanes, v_min);
+        for (const T lane : lanes) {
+            result.min = std::min(result.min, static_cast<uint32_t>(lane));
+        }
+        Ops::Store(lanes, v_max);
+        for (const T lane : lanes) {
+            result.max = std::max(result.max, static_cast<uint32_t>(lane));
+        }
+    }
+#endif
+    // Tail, or everything if there is no SIMD support
+    for (; i < index_count; ++i) {
+        const uint32_t index = indices[i];
+        result.min = std::min(result.min, index);
+        result.max = std::max(result.max, index);
+    }
+    return result;
+}
+
+MinMax ScanMinMax(const void *indices, uint32_t index_count, VkIndexType index_type) {
+    switch (index_type) {
+        case VK_INDEX_TYPE_UINT8_KHR:
+            return ScanMinMax(static_cast<const uint8_t *>(indices), index_count);
+        case VK_INDEX_TYPE_UINT16:
+            return ScanMinMax(static_cast<const uint16_t *>(indices), index_count);
+        default:
+            return ScanMinMax(static_cast<const uint32_t *>(indices), index_count);
+    }
+}
+
+bool PostTransformCacheModel::Query(uint32_t value) {
+    // Compare against every entry instead of stopping at the first hit, the first matching entry is the lowest bit of the mask
+    uint32_t hit_mask = 0;
+#if defined(INDEX_SCAN_X86)
+    const __m128i v_value = _mm_set1_epi32(static_cast<int>(value));
+    for (uint32_t i = 0; i < kSize; i += 4) {
+        const __m128i equal = _mm_cmpeq_epi32(_mm_load_si128(reinterpret_cast<const __m128i *>(values_ + i)), v_value);
+        hit_mask |= static_cast<uint32_t>(_mm_movemask_ps(_mm_castsi128_ps(equal))) << i;
+    }
+#else
+    for (uint32_t i = 0; i < kSize; ++i) {
+        hit_mask |= static_cast<uint32_t>(values_[i] == value) << i;
+    }
+#endif
+
+    if (hit_mask != 0) {
+        // mark the cache hit as being most recently used
+        ages_[LeastSignificantBit(hit_mask)] = iteration_++;
+        return true;
+    }
+
+    // if there's no cache hit, we need to model the entry being inserted into the cache
+    uint32_t slot = iteration_;
+    if (iteration_ >= kSize) {
+        // replace the least recently used entry, the first one if several have the same age.
+        // Reduce to the oldest age first, then look for it, so neither loop carries a dependency on a load.
+        uint32_t oldest = ages_[0];
+        for (uint32_t i = 1; i < kSize; ++i) {
+            oldest = std::min(oldest, ages_[i]);
+        }
+        uint32_t oldest_mask = 0;
+        for (uint32_t i = 0; i < kSize; ++i) {
+            oldest_mask |= static_cast<uint32_t>(ages_[i] == oldest) << i;
+        }
+        slot = static_cast<uint32_t>(LeastSignificantBit(oldest_mask));
+    }
+    values_[slot] = value;
+    ages_[slot] = iteration_++;
+    return false;
+}
+
+template <typename T>
+static VertexReuse ScanVertexReuse(const T *indices, uint32_t index_count, bool primitive_restart_enable, const MinMax &range) {
+    constexpr uint32_t primitive_restart_value = std::numeric_limits<T>::max();
+    VertexReuse result;
+    PostTransformCacheModel post_transform_cache;
+
+    // use a vector of bitsets as a memory-compact representation of which indices are included in the draw call
+    constexpr uint32_t refs_per_bucket = 64;
+    const uint32_t n_indices = range.max - range.min + 1;
+    std::vector<uint64_t> vertex_reference_buckets(std::max(1u, (n_indices + refs_per_bucket - 1) / refs_per_bucket), 0);
+
+    for (uint32_t i = 0; i < index_count; ++i) {
+        const uint32_t index = indices[i];
+        if (!primitive_restart_enable || index != primitive_restart_value) {
+            // if the shaded vertex corresponding to the index is not in the PT-cache, we need to shade again
+            result.shaded_count += post_transform_cache.Query(index) ? 0 : 1;
+        }
+        // keep track of the set of all indices used to reference vertices in the draw call
+        const uint32_t index_offset = index - range.min;
+        vertex_reference_buckets[index_offset / refs_per_bucket] |= 1ull << (index_offset % refs_per_bucket);
+    }
+
+    for (const uint64_t bucket : vertex_reference_buckets) {
+        result.referenced_count += static_cast<uint32_t>(std::bitset<refs_per_bucket>(bucket).count());
+    }
+    return result;
+}
+
+VertexReuse ScanVertexReuse(const void *indices, uint32_t index_count, VkIndexType index_type, bool primitive_restart_enable,
+                            const MinMax &range) {
+    switch (index_type) {
+        case VK_INDEX_TYPE_UINT8_KHR:
+            return ScanVertexReuse(static_cast<const uint8_t *>(indices), index_count, primitive_restart_enable, range);
+        case VK_INDEX_TYPE_UINT16:
+            return ScanVertexReuse(static_cast<const uint16_t *>(indices), index_count, primitive_restart_enable, range);
+        default:
+            return ScanVertexReuse(static_cast<const uint32_t *>(indices), index_count, primitive_restart_enable, range);
+    }
+}
+
+}  // namespace index_buffer
@@ -0,0 +1,66 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <vulkan/vulkan.h>
+
+#include <cstdint>
+
+// Kernels scanning the content of index buffers, used by the Arm best practices index buffer checks.
+// Index buffers can hold millions of indices, those are on the hot path of every indexed draw.
+namespace index_buffer {
+
+struct MinMax {
+    // If no index was scanned, min > max
+    uint32_t min = ~0u;
+    uint32_t max = 0u;
+};
+
+// Min and max of index_count indices of type index_type. Primitive restart values are not skipped.
+// Vectorized (AVX2/SSE4.1/SSE2 or NEON, picked at compile time) with a scalar fallback.
+MinMax ScanMinMax(const void *indices, uint32_t index_count, VkIndexType index_type);
+
+// Model of a fully associative LRU post-transform vertex cache.
+// Modelling a cache with more than 32 elements gives diminishing returns in practice.
+// http://eelpi.gotdns.org/papers/fast_vert_cache_opt.html
+class PostTransformCacheModel {
+  public:
+    static constexpr uint32_t kSize = 32;
+
+    // Returns true if there was a cache hit - also models LRU behavior which will effect subsequent calls.
+    bool Query(uint32_t value);
+
+  private:
+    alignas(16) uint32_t values_[kSize] = {};
+    alignas(16) uint32_t ages_[kSize] = {};
+    uint32_t iteration_ = 0;
+};
+
+struct VertexReuse {
+    // Vertices the post-transform cache model had to shade
+    uint32_t shaded_count = 0;
+    // Distinct indices referenced by the draw
+    uint32_t referenced_count = 0;
+};
+
+// Run the post-transform cache model and count distinct indices in a single pass.
+// range must come from ScanMinMax() and be smaller than index_count, it bounds the memory used to track indices.
+VertexReuse ScanVertexReuse(const void *indices, uint32_t index_count, VkIndexType index_type, bool primitive_restart_enable,
+                            const MinMax &range);
+
+}  // namespace index_buffer
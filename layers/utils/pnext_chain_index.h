@@ -0,0 +1,75 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <vulkan/vulkan.h>
+#include <vulkan/utility/vk_struct_helper.hpp>
+
+#include <cstdint>
+
+namespace vvl {
+
+// sType -> struct index of a pNext chain, built with a single walk of the chain.
+// Finding a struct is then a scan of a small contiguous array instead of chasing pNext pointers again, which adds up for
+// create infos queried for a dozen extension structs (pipelines). Same result as vku::FindStructInPNextChain: the first
+// struct of the requested type. The chain must outlive the index.
+class PnextChainIndex {
+  public:
+    // Longer chains are very rare, the structs after the first kMaxEntries are found by walking the rest of the chain
+    static constexpr uint32_t kMaxEntries = 16;
+
+    PnextChainIndex() = default;
+    explicit PnextChainIndex(const void *pnext) {
+        const auto *current = reinterpret_cast<const VkBaseInStructure *>(pnext);
+        for (; current && count_ < kMaxEntries; current = current->pNext) {
+            stypes_[count_] = current->sType;
+            structs_[count_] = current;
+            ++count_;
+        }
+        overflow_ = current;
+    }
+
+    const void *Find(VkStructureType stype) const {
+        for (uint32_t i = 0; i < count_; ++i) {
+            if (stypes_[i] == stype) {
+                return structs_[i];
+            }
+        }
+        for (const auto *current = overflow_; current; current = current->pNext) {
+            if (current->sType == stype) {
+                return current;
+            }
+        }
+        return nullptr;
+    }
+
+    template <typename T>
+    const T *Find() const {
+        return static_cast<const T *>(Find(vku::GetSType<T>()));
+    }
+
+    uint32_t Size() const { return count_; }
+
+  private:
+    VkStructureType stypes_[kMaxEntries] = {};
+    const VkBaseInStructure *structs_[kMaxEntries] = {};
+    uint32_t count_ = 0;
+    const VkBaseInStructure *overflow_ = nullptr;
+};
+
+}  // namespace vvl
@@ -0,0 +1,129 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "thread_pool.h"
+
+#include <atomic>
+#include <memory>
+#include <system_error>
+
+namespace vvl {
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> guard(lock_);
+        stopping_ = true;
+    }
+    task_ready_.notify_all();
+    for (auto &thread : threads_) {
+        thread.join();
+    }
+}
+
+bool ThreadPool::Submit(std::function<void()> &&task) {
+    {
+        std::lock_guard<std::mutex> guard(lock_);
+        if (idle_threads_ == 0 && threads_.size() < max_threads_) {
+            try {
+                threads_.emplace_back(&ThreadPool::WorkerLoop, this);
+            } catch (const std::system_error &) {
+                // The threads already started keep running the tasks, do not try starting more
+                max_threads_ = static_cast<uint32_t>(threads_.size());
+                if (threads_.empty()) {
+                    return false;
+                }
+            }
+        }
+        tasks_.emplace_back(std::move(task));
+    }
+    task_ready_.notify_one();
+    return true;
+}
+
+void ThreadPool::WorkerLoop() {
+    std::unique_lock<std::mutex> guard(lock_);
+    while (true) {
+        if (tasks_.empty()) {
+            if (stopping_) {
+                return;
+            }
+            ++idle_threads_;
+            task_ready_.wait(guard, [this]() { return stopping_ || !tasks_.empty(); });
+            --idle_threads_;
+            continue;
+        }
+        std::function<void()> task = std::move(tasks_.front());
+        tasks_.pop_front();
+        guard.unlock();
+        task();
+        guard.lock();
+    }
+}
+
+void ParallelFor(ThreadPool *pool, uint32_t count, uint32_t worker_count, const std::function<void(uint32_t)> &fn) {
+    if (!pool || worker_count <= 1) {
+        for (uint32_t i = 0; i < count; i++) {
+            fn(i);
+        }
+        return;
+    }
+
+    // Outlives the call, as the pool can run a helper task after the calling thread returned. Such a helper finds the work
+    // closed and does not touch fn.
+    struct SharedState {
+        std::atomic<uint32_t> next_index{0};
+        std::mutex lock;
+        std::condition_variable helpers_done;
+        uint32_t running_helpers = 0;
+        bool closed = false;
+    };
+    auto state = std::make_shared<SharedState>();
+    auto work = [count, &fn](SharedState &shared) {
+        for (uint32_t i = shared.next_index.fetch_add(1, std::memory_order_relaxed); i < count;
+             i = shared.next_index.fetch_add(1, std::memory_order_relaxed)) {
+            fn(i);
+        }
+    };
+    for (uint32_t helper = 1; helper < worker_count; helper++) {
+        const bool submitted = pool->Submit([state, work]() {
+            {
+                std::lock_guard<std::mutex> guard(state->lock);
+                if (state->closed) {
+                    return;
+                }
+                ++state->running_helpers;
+            }
+            work(*state);
+            {
+                std::lock_guard<std::mutex> guard(state->lock);
+                --state->running_helpers;
+            }
+            state->helpers_done.notify_one();
+        });
+        if (!submitted) {
+            break;
+        }
+    }
+
+    // This thread is one of the workers
+    work(*state);
+    std::unique_lock<std::mutex> guard(state->lock);
+    state->closed = true;
+    state->helpers_done.wait(guard, [&state]() { return state->running_helpers == 0; });
+}
+
+}  // namespace vvl
@@ -0,0 +1,72 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace vvl {
+
+// Runs tasks on at most max_threads background threads, in submission order. Threads are only started when tasks are waiting
+// and no thread is idle, so a pool that never gets any task costs nothing.
+// The destructor runs the tasks still queued, then joins the threads.
+class ThreadPool {
+  public:
+    explicit ThreadPool(uint32_t max_threads) : max_threads_(max_threads) {}
+    ~ThreadPool();
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    // Returns false, and drops the task, if the pool has no thread and none can be started. The caller then has to run the work
+    // itself.
+    bool Submit(std::function<void()> &&task);
+
+  private:
+    void WorkerLoop();
+
+    uint32_t max_threads_;  // lowered to the threads started if the system refuses to start more
+    std::mutex lock_;
+    std::condition_variable task_ready_;
+    std::deque<std::function<void()>> tasks_;
+    std::vector<std::thread> threads_;
+    uint32_t idle_threads_ = 0;
+    bool stopping_ = false;
+};
+
+// Background threads of the pool a device shares between all its validation objects
+static constexpr uint32_t kDeviceThreadPoolSize = 8;
+
+// Threads worth using for item_count independent items, each thread getting at least min_items_per_worker of them.
+// Returns 0 or 1 when the items should be processed on the calling thread.
+static inline uint32_t GetParallelWorkerCount(uint32_t item_count, uint32_t min_items_per_worker, uint32_t max_workers) {
+    return std::min(item_count / min_items_per_worker, max_workers);
+}
+
+// Calls fn(i) for every i in [0, count), on the calling thread and up to worker_count - 1 threads of the pool, and returns once
+// all calls are done. Indices are handed out one at a time, so a few costly items do not leave the other threads idle.
+// Pool threads that only get to the work once the calling thread has handed out every index are not waited for, so a busy
+// pool never makes the caller slower than running the items itself. Without a pool the items are processed serially.
+void ParallelFor(ThreadPool *pool, uint32_t count, uint32_t worker_count, const std::function<void(uint32_t)> &fn);
+
+}  // namespace vvl
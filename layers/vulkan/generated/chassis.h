@@ -51,6 +51,7 @@
 #include "vk_object_types.h"
 #include "utils/vk_layer_extension_utils.h"
 #include "utils/vk_layer_utils.h"
+#include "utils/thread_pool.h"
 #include "vk_dispatch_table_helper.h"
 #include "vk_extension_helper.h"
 #include "gpu/core/gpu_settings.h"
@@ -2233,6 +2234,11 @@ class ValidationObject {
     VkDevice device = VK_NULL_HANDLE;
     bool is_device_lost = false;
 
+    // Shared by all the validation objects of a device and owned by the device dispatch object. Its threads are joined
+    // at vkDestroyDevice, before the validation objects are deleted, so tasks can use them.
+    vvl::ThreadPool* thread_pool = nullptr;
+    std::unique_ptr<vvl::ThreadPool> owned_thread_pool;
+
     std::vector<ValidationObject*> object_dispatch;
     std::vector<ValidationObject*> aborted_object_dispatch;
     LayerObjectTypeId container_type;
@@ -2256,6 +2262,15 @@ class ValidationObject {
     virtual ReadLockGuard ReadLock() const { return ReadLockGuard(validation_object_mutex); }
     virtual WriteLockGuard WriteLock() { return WriteLockGuard(validation_object_mutex); }
 
+    // Used by the chassis intercept loops, only makes the virtual ReadLock()/WriteLock() call if the lock is taken
+    bool intercept_lock_required = true;
+    ReadLockGuard InterceptReadLock() const {
+        return intercept_lock_required ? ReadLock() : ReadLockGuard(validation_object_mutex, std::defer_lock);
+    }
+    WriteLockGuard InterceptWriteLock() {
+        return intercept_lock_required ? WriteLock() : WriteLockGuard(validation_object_mutex, std::defer_lock);
+    }
+
     // If the Record phase calls a function that blocks, we might need to release
     // the lock that protects Record itself in order to avoid mutual waiting.
     static thread_local WriteLockGuard* record_guard;
@@ -1773,6 +1773,12 @@ void ValidationObject::InitObjectDispatchVectors() {
     // clang-format on
 
     intercept_vectors.resize(InterceptIdCount);
+
+    // ReadLock()/WriteLock() only depend on fine_grained_locking, which is fixed once the device is created.
+    // Cache it so the intercept loops skip the virtual lock call for objects which do not take their lock.
+    for (auto item : object_dispatch) {
+        item->intercept_lock_required = item->WriteLock().owns_lock();
+    }
     BUILD_DISPATCH_VECTOR(PreCallValidateGetDeviceQueue);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetDeviceQueue);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetDeviceQueue);
@@ -29,7 +29,8 @@
 #include "generated/vk_api_version.h"
 
 namespace vvl {
-enum class Func {
+// Func/Struct/Field are stored in every Location, keep them small so building location chains stays cheap
+enum class Func : uint16_t {
     Empty = 0,
     vkAcquireDrmDisplayEXT,
     vkAcquireFullScreenExclusiveModeEXT,
@@ -713,7 +714,7 @@ enum class Func {
     vkWriteMicromapsPropertiesEXT,
 };
 
-enum class Struct {
+enum class Struct : uint16_t {
     Empty = 0,
     VkAabbPositionsKHR,
     VkAccelerationStructureBuildGeometryInfoKHR,
@@ -1762,7 +1763,7 @@ enum class Struct {
     VkXlibSurfaceCreateInfoKHR,
 };
 
-enum class Field {
+enum class Field : uint16_t {
     Empty = 0,
     AType,
     BType,
@@ -264,6 +264,7 @@ def GenerateSpecErrorMessage(api : str, valid_usage_json : str, out_file : str):
 // clang-format off
 
 // Mapping from VUID string to the corresponding spec text
+// Entries are sorted by VUID (strcmp order), lookups rely on it to do a binary search
 typedef struct _vuid_spec_text_pair {{
     const char * vuid;
     const char * spec_text;
@@ -271,8 +272,10 @@ typedef struct _vuid_spec_text_pair {{
 }} vuid_spec_text_pair;
 \n''')
 
+    # Sort by code point, which for ASCII VUIDs matches the strcmp order the layer uses for its binary search
     vuid_list = list(val_json.all_vuids)
     vuid_list.sort()
+    assert all(vuid.isascii() for vuid in vuid_list)
     minor_version = int(val_json.api_version.split('.')[1])
 
     out.append('static const vuid_spec_text_pair vuid_spec_text[] = {\n')
@@ -93,7 +93,8 @@ class ErrorLocationHelperOutputGenerator(BaseGenerator):
             #include "generated/vk_api_version.h"
 
             namespace vvl {
-            enum class Func {
+            // Func/Struct/Field are stored in every Location, keep them small so building location chains stays cheap
+            enum class Func : uint16_t {
                 Empty = 0,
             ''')
         # Want alpha-sort for ease of look at list while debugging
@@ -102,7 +103,7 @@ class ErrorLocationHelperOutputGenerator(BaseGenerator):
         out.append('};\n')
 
         out.append('\n')
-        out.append('enum class Struct {\n')
+        out.append('enum class Struct : uint16_t {\n')
         out.append('    Empty = 0,\n')
         # Want alpha-sort for ease of look at list while debugging
         for struct in sorted(self.vk.structs.values()):
@@ -110,7 +111,7 @@ class ErrorLocationHelperOutputGenerator(BaseGenerator):
         out.append('};\n')
 
         out.append('\n')
-        out.append('enum class Field {\n')
+        out.append('enum class Field : uint16_t {\n')
         out.append('    Empty = 0,\n')
         # Already alpha-sorted
         for field in self.fields:
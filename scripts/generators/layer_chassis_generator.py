@@ -185,6 +185,12 @@ void ValidationObject::InitObjectDispatchVectors() {
 // clang-format on
 
     intercept_vectors.resize(InterceptIdCount);
+
+    // ReadLock()/WriteLock() only depend on fine_grained_locking, which is fixed once the device is created.
+    // Cache it so the intercept loops skip the virtual lock call for objects which do not take their lock.
+    for (auto item : object_dispatch) {
+        item->intercept_lock_required = item->WriteLock().owns_lock();
+    }
 '''
 
 
@@ -314,6 +320,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
             #include "vk_object_types.h"
             #include "utils/vk_layer_extension_utils.h"
             #include "utils/vk_layer_utils.h"
+            #include "utils/thread_pool.h"
             #include "vk_dispatch_table_helper.h"
             #include "vk_extension_helper.h"
             #include "gpu/core/gpu_settings.h"
@@ -431,6 +438,11 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 VkDevice device = VK_NULL_HANDLE;
                 bool is_device_lost = false;
 
+                // Shared by all the validation objects of a device and owned by the device dispatch object. Its threads are joined
+                // at vkDestroyDevice, before the validation objects are deleted, so tasks can use them.
+                vvl::ThreadPool* thread_pool = nullptr;
+                std::unique_ptr<vvl::ThreadPool> owned_thread_pool;
+
                 std::vector<ValidationObject*> object_dispatch;
                 std::vector<ValidationObject*> aborted_object_dispatch;
                 LayerObjectTypeId container_type;
@@ -454,6 +466,15 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 virtual ReadLockGuard ReadLock() const { return ReadLockGuard(validation_object_mutex); }
                 virtual WriteLockGuard WriteLock() { return WriteLockGuard(validation_object_mutex); }
 
+                // Used by the chassis intercept loops, only makes the virtual ReadLock()/WriteLock() call if the lock is taken
+                bool intercept_lock_required = true;
+                ReadLockGuard InterceptReadLock() const {
+                    return intercept_lock_required ? ReadLock() : ReadLockGuard(validation_object_mutex, std::defer_lock);
+                }
+                WriteLockGuard InterceptWriteLock() {
+                    return intercept_lock_required ? WriteLock() : WriteLockGuard(validation_object_mutex, std::defer_lock);
+                }
+
                 // If the Record phase calls a function that blocks, we might need to release
                 // the lock that protects Record itself in order to avoid mutual waiting.
                 static thread_local WriteLockGuard* record_guard;
@@ -1135,7 +1156,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 bool skip = false;
                 ErrorObject error_obj(vvl::Func::vkCreateInstance, VulkanTypedHandle());
                 for (const ValidationObject* intercept : local_object_dispatch) {
-                    auto lock = intercept->ReadLock();
+                    auto lock = intercept->InterceptReadLock();
                     skip |= intercept->PreCallValidateCreateInstance(pCreateInfo, pAllocator, pInstance, error_obj);
                     if (skip) {
                         cleanup_allocations();
@@ -1145,7 +1166,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
                 RecordObject record_obj(vvl::Func::vkCreateInstance);
                 for (ValidationObject* intercept : local_object_dispatch) {
-                    auto lock = intercept->WriteLock();
+                    auto lock = intercept->InterceptWriteLock();
                     intercept->PreCallRecordCreateInstance(pCreateInfo, pAllocator, pInstance, record_obj);
                 }
 
@@ -1188,7 +1209,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 }
 
                 for (ValidationObject* intercept : framework->object_dispatch) {
-                    auto lock = intercept->WriteLock();
+                    auto lock = intercept->InterceptWriteLock();
                     intercept->PostCallRecordCreateInstance(pCreateInfo, pAllocator, pInstance, record_obj);
                 }
 
@@ -1204,26 +1225,26 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 ErrorObject error_obj(vvl::Func::vkDestroyInstance, VulkanTypedHandle(instance, kVulkanObjectTypeInstance));
 
                 for (const ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->ReadLock();
+                    auto lock = intercept->InterceptReadLock();
                     intercept->PreCallValidateDestroyInstance(instance, pAllocator, error_obj);
                 }
 
                 RecordObject record_obj(vvl::Func::vkDestroyInstance);
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->WriteLock();
+                    auto lock = intercept->InterceptWriteLock();
                     intercept->PreCallRecordDestroyInstance(instance, pAllocator, record_obj);
                 }
 
                 // Before instance is destroyed, allow aborted objects to clean up
                 for (ValidationObject* intercept : layer_data->aborted_object_dispatch) {
-                    auto lock = intercept->WriteLock();
+                    auto lock = intercept->InterceptWriteLock();
                     intercept->PreCallRecordDestroyInstance(instance, pAllocator, record_obj);
                 }
 
                 layer_data->instance_dispatch_table.DestroyInstance(instance, pAllocator);
 
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->WriteLock();
+                    auto lock = intercept->InterceptWriteLock();
                     intercept->PostCallRecordDestroyInstance(instance, pAllocator, record_obj);
                 }
 
@@ -1275,14 +1296,14 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 bool skip = false;
                 ErrorObject error_obj(vvl::Func::vkCreateDevice, VulkanTypedHandle(gpu, kVulkanObjectTypePhysicalDevice));
                 for (const ValidationObject* intercept : instance_interceptor->object_dispatch) {
-                    auto lock = intercept->ReadLock();
+                    auto lock = intercept->InterceptReadLock();
                     skip |= intercept->PreCallValidateCreateDevice(gpu, pCreateInfo, pAllocator, pDevice, error_obj);
                     if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
                 }
 
                 RecordObject record_obj(vvl::Func::vkCreateDevice);
                 for (ValidationObject* intercept : instance_interceptor->object_dispatch) {
-                    auto lock = intercept->WriteLock();
+                    auto lock = intercept->InterceptWriteLock();
                     intercept->PreCallRecordCreateDevice(gpu, pCreateInfo, pAllocator, pDevice, record_obj, &modified_create_info);
                 }
 
@@ -1311,6 +1332,10 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
                 InitDeviceObjectDispatch(instance_interceptor, device_interceptor);
 
+                // Its threads are only started when a validation object has work for them
+                device_interceptor->owned_thread_pool = std::make_unique<vvl::ThreadPool>(vvl::kDeviceThreadPoolSize);
+                device_interceptor->thread_pool = device_interceptor->owned_thread_pool.get();
+
                 // Initialize all of the objects with the appropriate data
                 for (auto* object : device_interceptor->object_dispatch) {
                     object->device = device_interceptor->device;
@@ -1322,6 +1347,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
                     object->disabled = instance_interceptor->disabled;
                     object->enabled = instance_interceptor->enabled;
                     object->fine_grained_locking = instance_interceptor->fine_grained_locking;
+                    object->thread_pool = device_interceptor->thread_pool;
                     object->gpuav_settings = instance_interceptor->gpuav_settings;
                     object->printf_settings = instance_interceptor->printf_settings;
                     object->instance_dispatch_table = instance_interceptor->instance_dispatch_table;
@@ -1330,7 +1356,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 }
 
                 for (ValidationObject* intercept : instance_interceptor->object_dispatch) {
-                    auto lock = intercept->WriteLock();
+                    auto lock = intercept->InterceptWriteLock();
                     intercept->PostCallRecordCreateDevice(gpu, pCreateInfo, pAllocator, pDevice, record_obj);
                 }
 
@@ -1350,31 +1376,35 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 auto layer_data = GetLayerDataPtr(key, layer_data_map);
                 ErrorObject error_obj(vvl::Func::vkDestroyDevice, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
                 for (const ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->ReadLock();
+                    auto lock = intercept->InterceptReadLock();
                     intercept->PreCallValidateDestroyDevice(device, pAllocator, error_obj);
                 }
 
                 RecordObject record_obj(vvl::Func::vkDestroyDevice);
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->WriteLock();
+                    auto lock = intercept->InterceptWriteLock();
                     intercept->PreCallRecordDestroyDevice(device, pAllocator, record_obj);
                 }
 
                 // Before device is destroyed, allow aborted objects to clean up
                 for (ValidationObject* intercept : layer_data->aborted_object_dispatch) {
-                    auto lock = intercept->WriteLock();
+                    auto lock = intercept->InterceptWriteLock();
                     intercept->PreCallRecordDestroyDevice(device, pAllocator, record_obj);
                 }
 
                 layer_data->device_dispatch_table.DestroyDevice(device, pAllocator);
 
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->WriteLock();
+                    auto lock = intercept->InterceptWriteLock();
                     intercept->PostCallRecordDestroyDevice(device, pAllocator, record_obj);
                 }
 
                 auto instance_interceptor = GetLayerDataPtr(GetDispatchKey(layer_data->physical_device), layer_data_map);
                 instance_interceptor->debug_report->device_created--;
+                instance_interceptor->debug_report->LogSuppressedMessageSummary();
+
+                // Runs what is left of the background tasks and joins the threads
+                layer_data->owned_thread_pool.reset();
 
                 for (auto item = layer_data->object_dispatch.begin(); item != layer_data->object_dispatch.end(); item++) {
                     delete *item;
@@ -1400,7 +1430,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 chassis_state.pCreateInfos = pCreateInfos;
 
                 for (const ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->ReadLock();
+                    auto lock = intercept->InterceptReadLock();
                     skip |= intercept->PreCallValidateCreateGraphicsPipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator,
                                                                             pPipelines, error_obj, pipeline_states[intercept->container_type], chassis_state);
                     if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
@@ -1408,7 +1438,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
                 RecordObject record_obj(vvl::Func::vkCreateGraphicsPipelines);
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->WriteLock();
+                    auto lock = intercept->InterceptWriteLock();
                     intercept->PreCallRecordCreateGraphicsPipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator,
                                                                     pPipelines, record_obj, pipeline_states[intercept->container_type], chassis_state);
                 }
@@ -1418,7 +1448,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 record_obj.result = result;
 
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->WriteLock();
+                    auto lock = intercept->InterceptWriteLock();
                     intercept->PostCallRecordCreateGraphicsPipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator,
                                                                     pPipelines, record_obj, pipeline_states[intercept->container_type], chassis_state);
                 }
@@ -1438,7 +1468,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 chassis_state.pCreateInfos = pCreateInfos;
 
                 for (const ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->ReadLock();
+                    auto lock = intercept->InterceptReadLock();
                     skip |= intercept->PreCallValidateCreateComputePipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator,
                                                                             pPipelines, error_obj, pipeline_states[intercept->container_type], chassis_state);
                     if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
@@ -1446,7 +1476,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
                 RecordObject record_obj(vvl::Func::vkCreateComputePipelines);
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->WriteLock();
+                    auto lock = intercept->InterceptWriteLock();
                     intercept->PreCallRecordCreateComputePipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines, record_obj,
                                                                 pipeline_states[intercept->container_type], chassis_state);
                 }
@@ -1456,7 +1486,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 record_obj.result = result;
 
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->WriteLock();
+                    auto lock = intercept->InterceptWriteLock();
                     intercept->PostCallRecordCreateComputePipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator,
                                                                     pPipelines, record_obj, pipeline_states[intercept->container_type], chassis_state);
                 }
@@ -1475,7 +1505,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 chassis_state.pCreateInfos = pCreateInfos;
 
                 for (const ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->ReadLock();
+                    auto lock = intercept->InterceptReadLock();
                     skip |=
                         intercept->PreCallValidateCreateRayTracingPipelinesNV(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator,
                                                                             pPipelines, error_obj, pipeline_states[intercept->container_type], chassis_state);
@@ -1484,7 +1514,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
                 RecordObject record_obj(vvl::Func::vkCreateRayTracingPipelinesNV);
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->WriteLock();
+                    auto lock = intercept->InterceptWriteLock();
                     intercept->PreCallRecordCreateRayTracingPipelinesNV(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator,
                                                                         pPipelines, record_obj, pipeline_states[intercept->container_type], chassis_state);
                 }
@@ -1494,7 +1524,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 record_obj.result = result;
 
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->WriteLock();
+                    auto lock = intercept->InterceptWriteLock();
                     intercept->PostCallRecordCreateRayTracingPipelinesNV(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator,
                                                                         pPipelines, record_obj, pipeline_states[intercept->container_type], chassis_state);
                 }
@@ -1514,7 +1544,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 chassis_state.pCreateInfos = pCreateInfos;
 
                 for (const ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->ReadLock();
+                    auto lock = intercept->InterceptReadLock();
                     skip |= intercept->PreCallValidateCreateRayTracingPipelinesKHR(device, deferredOperation, pipelineCache, createInfoCount,
                                                                                 pCreateInfos, pAllocator, pPipelines, error_obj,
                                                                                 pipeline_states[intercept->container_type], chassis_state);
@@ -1523,7 +1553,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
                 RecordObject record_obj(vvl::Func::vkCreateRayTracingPipelinesKHR);
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->WriteLock();
+                    auto lock = intercept->InterceptWriteLock();
                     intercept->PreCallRecordCreateRayTracingPipelinesKHR(device, deferredOperation, pipelineCache, createInfoCount,
                                                                         pCreateInfos, pAllocator, pPipelines, record_obj,
                                                                         pipeline_states[intercept->container_type], chassis_state);
@@ -1535,7 +1565,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 record_obj.result = result;
 
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->WriteLock();
+                    auto lock = intercept->InterceptWriteLock();
                     intercept->PostCallRecordCreateRayTracingPipelinesKHR(device, deferredOperation, pipelineCache, createInfoCount,
                                                                         pCreateInfos, pAllocator, pPipelines, record_obj,
                                                                         pipeline_states[intercept->container_type], chassis_state);
@@ -1551,7 +1581,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 ErrorObject error_obj(vvl::Func::vkCreatePipelineLayout, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
 
                 for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreatePipelineLayout]) {
-                    auto lock = intercept->ReadLock();
+                    auto lock = intercept->InterceptReadLock();
                     skip |= intercept->PreCallValidateCreatePipelineLayout(device, pCreateInfo, pAllocator, pPipelineLayout, error_obj);
                     if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
                 }
@@ -1561,7 +1591,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
                 RecordObject record_obj(vvl::Func::vkCreatePipelineLayout);
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->WriteLock();
+                    auto lock = intercept->InterceptWriteLock();
                     intercept->PreCallRecordCreatePipelineLayout(device, pCreateInfo, pAllocator, pPipelineLayout, record_obj, chassis_state);
                 }
 
@@ -1569,7 +1599,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 record_obj.result = result;
 
                 for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreatePipelineLayout]) {
-                    auto lock = intercept->WriteLock();
+                    auto lock = intercept->InterceptWriteLock();
                     intercept->PostCallRecordCreatePipelineLayout(device, pCreateInfo, pAllocator, pPipelineLayout, record_obj);
                 }
                 return result;
@@ -1583,7 +1613,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 ErrorObject error_obj(vvl::Func::vkCreateShaderModule, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
 
                 for (const ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->ReadLock();
+                    auto lock = intercept->InterceptReadLock();
                     skip |= intercept->PreCallValidateCreateShaderModule(device, pCreateInfo, pAllocator, pShaderModule, error_obj);
                     if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
                 }
@@ -1593,7 +1623,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
                 RecordObject record_obj(vvl::Func::vkCreateShaderModule);
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->WriteLock();
+                    auto lock = intercept->InterceptWriteLock();
                     intercept->PreCallRecordCreateShaderModule(device, pCreateInfo, pAllocator, pShaderModule, record_obj, chassis_state);
                 }
 
@@ -1604,7 +1634,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 record_obj.result = result;
 
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->WriteLock();
+                    auto lock = intercept->InterceptWriteLock();
                     intercept->PostCallRecordCreateShaderModule(device, pCreateInfo, pAllocator, pShaderModule, record_obj, chassis_state);
                 }
                 return result;
@@ -1624,14 +1654,14 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 chassis::ShaderObject chassis_state(createInfoCount, new_shader_create_infos.data());
 
                 for (const ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->ReadLock();
+                    auto lock = intercept->InterceptReadLock();
                     skip |= intercept->PreCallValidateCreateShadersEXT(device, createInfoCount, pCreateInfos, pAllocator, pShaders, error_obj);
                     if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
                 }
 
                 RecordObject record_obj(vvl::Func::vkCreateShadersEXT);
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->WriteLock();
+                    auto lock = intercept->InterceptWriteLock();
                     intercept->PreCallRecordCreateShadersEXT(device, createInfoCount, pCreateInfos, pAllocator, pShaders, record_obj, chassis_state);
                 }
 
@@ -1642,7 +1672,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 record_obj.result = result;
 
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->WriteLock();
+                    auto lock = intercept->InterceptWriteLock();
                     intercept->PostCallRecordCreateShadersEXT(device, createInfoCount, pCreateInfos, pAllocator, pShaders, record_obj,
                                                             chassis_state);
                 }
@@ -1659,7 +1689,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
                 for (const ValidationObject* intercept : layer_data->object_dispatch) {
                     ads_state[intercept->container_type].Init(pAllocateInfo->descriptorSetCount);
-                    auto lock = intercept->ReadLock();
+                    auto lock = intercept->InterceptReadLock();
                     skip |= intercept->PreCallValidateAllocateDescriptorSets(device, pAllocateInfo, pDescriptorSets, error_obj,
                                                                             ads_state[intercept->container_type]);
                     if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
@@ -1667,7 +1697,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
                 RecordObject record_obj(vvl::Func::vkAllocateDescriptorSets);
                 for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordAllocateDescriptorSets]) {
-                    auto lock = intercept->WriteLock();
+                    auto lock = intercept->InterceptWriteLock();
                     intercept->PreCallRecordAllocateDescriptorSets(device, pAllocateInfo, pDescriptorSets, record_obj);
                 }
 
@@ -1675,7 +1705,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 record_obj.result = result;
 
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->WriteLock();
+                    auto lock = intercept->InterceptWriteLock();
                     intercept->PostCallRecordAllocateDescriptorSets(device, pAllocateInfo, pDescriptorSets, record_obj,
                                                                     ads_state[intercept->container_type]);
                 }
@@ -1690,7 +1720,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 ErrorObject error_obj(vvl::Func::vkCreateBuffer, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
 
                 for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateBuffer]) {
-                    auto lock = intercept->ReadLock();
+                    auto lock = intercept->InterceptReadLock();
                     skip |= intercept->PreCallValidateCreateBuffer(device, pCreateInfo, pAllocator, pBuffer, error_obj);
                     if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
                 }
@@ -1700,7 +1730,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
                 RecordObject record_obj(vvl::Func::vkCreateBuffer);
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->WriteLock();
+                    auto lock = intercept->InterceptWriteLock();
                     intercept->PreCallRecordCreateBuffer(device, pCreateInfo, pAllocator, pBuffer, record_obj, chassis_state);
                 }
 
@@ -1708,7 +1738,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 record_obj.result = result;
 
                 for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateBuffer]) {
-                    auto lock = intercept->WriteLock();
+                    auto lock = intercept->InterceptWriteLock();
                     intercept->PostCallRecordCreateBuffer(device, pCreateInfo, pAllocator, pBuffer, record_obj);
                 }
                 return result;
@@ -1726,14 +1756,14 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 ErrorObject error_obj(vvl::Func::vkBeginCommandBuffer, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer),
                                     &handle_data);
                 for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateBeginCommandBuffer]) {
-                    auto lock = intercept->ReadLock();
+                    auto lock = intercept->InterceptReadLock();
                     skip |= intercept->PreCallValidateBeginCommandBuffer(commandBuffer, pBeginInfo, error_obj);
                     if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
                 }
 
                 RecordObject record_obj(vvl::Func::vkBeginCommandBuffer, &handle_data);
                 for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordBeginCommandBuffer]) {
-                    auto lock = intercept->WriteLock();
+                    auto lock = intercept->InterceptWriteLock();
                     intercept->PreCallRecordBeginCommandBuffer(commandBuffer, pBeginInfo, record_obj);
                 }
 
@@ -1741,7 +1771,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 record_obj.result = result;
 
                 for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordBeginCommandBuffer]) {
-                    auto lock = intercept->WriteLock();
+                    auto lock = intercept->InterceptWriteLock();
                     intercept->PostCallRecordBeginCommandBuffer(commandBuffer, pBeginInfo, record_obj);
                 }
                 return result;
@@ -1774,7 +1804,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 }
 
                 for (const ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->ReadLock();
+                    auto lock = intercept->InterceptReadLock();
                     skip |=
                         intercept->PreCallValidateGetPhysicalDeviceToolPropertiesEXT(physicalDevice, pToolCount, pToolProperties, error_obj);
                     if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
@@ -1782,7 +1812,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
                 RecordObject record_obj(vvl::Func::vkGetPhysicalDeviceToolPropertiesEXT);
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->WriteLock();
+                    auto lock = intercept->InterceptWriteLock();
                     intercept->PreCallRecordGetPhysicalDeviceToolPropertiesEXT(physicalDevice, pToolCount, pToolProperties, record_obj);
                 }
 
@@ -1796,7 +1826,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 (*pToolCount)++;
 
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->WriteLock();
+                    auto lock = intercept->InterceptWriteLock();
                     intercept->PostCallRecordGetPhysicalDeviceToolPropertiesEXT(physicalDevice, pToolCount, pToolProperties, record_obj);
                 }
                 return result;
@@ -1818,7 +1848,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 }
 
                 for (const ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->ReadLock();
+                    auto lock = intercept->InterceptReadLock();
                     skip |=
                         intercept->PreCallValidateGetPhysicalDeviceToolProperties(physicalDevice, pToolCount, pToolProperties, error_obj);
                     if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
@@ -1826,7 +1856,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
                 RecordObject record_obj(vvl::Func::vkGetPhysicalDeviceToolProperties);
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->WriteLock();
+                    auto lock = intercept->InterceptWriteLock();
                     intercept->PreCallRecordGetPhysicalDeviceToolProperties(physicalDevice, pToolCount, pToolProperties, record_obj);
                 }
 
@@ -1840,7 +1870,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 (*pToolCount)++;
 
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->WriteLock();
+                    auto lock = intercept->InterceptWriteLock();
                     intercept->PostCallRecordGetPhysicalDeviceToolProperties(physicalDevice, pToolCount, pToolProperties, record_obj);
                 }
                 return result;
@@ -1923,7 +1953,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
             else:
                 out.append('for (const ValidationObject* intercept : layer_data->object_dispatch) {\n')
             out.append(f'''
-                auto lock = intercept->ReadLock();
+                auto lock = intercept->InterceptReadLock();
                     skip |= intercept->PreCallValidate{command.name[2:]}({paramsList}, error_obj);
                     if (skip) {return_map[command.returnType]}
                 }}\n''')
@@ -1935,7 +1965,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
             else:
                 out.append('for (ValidationObject* intercept : layer_data->object_dispatch) {\n')
             out.append(f'''
-                auto lock = intercept->WriteLock();
+                auto lock = intercept->InterceptWriteLock();
                 intercept->PreCallRecord{command.name[2:]}({paramsList}, record_obj);
             }}\n''')
 
@@ -1991,7 +2021,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
             ]
 
             if command.name not in commands_with_blocking_operations:
-                out.append('auto lock = intercept->WriteLock();\n')
+                out.append('auto lock = intercept->InterceptWriteLock();\n')
             else:
                 out.append('ValidationObject::BlockingOperationGuard lock(intercept);\n')
 
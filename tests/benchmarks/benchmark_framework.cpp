@@ -0,0 +1,270 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "benchmark_framework.h"
+
+#include <cstdio>
+#include <cstring>
+#include <sstream>
+
+#include "generated/vk_function_pointers.h"
+
+namespace bench {
+
+static constexpr const char *kLayerName = "VK_LAYER_KHRONOS_validation";
+
+const std::vector<ValidationConfig> &GetValidationConfigs() {
+    // Every validation object enabled by default, disabling them all isolates the one being measured
+    static const std::vector<VkValidationFeatureDisableEXT> kDisableDefaults = {
+        VK_VALIDATION_FEATURE_DISABLE_CORE_CHECKS_EXT, VK_VALIDATION_FEATURE_DISABLE_THREAD_SAFETY_EXT,
+        VK_VALIDATION_FEATURE_DISABLE_OBJECT_LIFETIMES_EXT, VK_VALIDATION_FEATURE_DISABLE_API_PARAMETERS_EXT};
+
+    static const std::vector<ValidationConfig> configs = {
+        {"no_layer", false, {}, {}},
+        {"default", true, {}, {}},
+        {"core", true,
+         {},
+         {VK_VALIDATION_FEATURE_DISABLE_THREAD_SAFETY_EXT, VK_VALIDATION_FEATURE_DISABLE_OBJECT_LIFETIMES_EXT,
+          VK_VALIDATION_FEATURE_DISABLE_API_PARAMETERS_EXT}},
+        {"stateless", true,
+         {},
+         {VK_VALIDATION_FEATURE_DISABLE_CORE_CHECKS_EXT, VK_VALIDATION_FEATURE_DISABLE_THREAD_SAFETY_EXT,
+          VK_VALIDATION_FEATURE_DISABLE_OBJECT_LIFETIMES_EXT}},
+        {"thread_safety", true,
+         {},
+         {VK_VALIDATION_FEATURE_DISABLE_CORE_CHECKS_EXT, VK_VALIDATION_FEATURE_DISABLE_OBJECT_LIFETIMES_EXT,
+          VK_VALIDATION_FEATURE_DISABLE_API_PARAMETERS_EXT}},
+        {"object_lifetime", true,
+         {},
+         {VK_VALIDATION_FEATURE_DISABLE_CORE_CHECKS_EXT, VK_VALIDATION_FEATURE_DISABLE_THREAD_SAFETY_EXT,
+          VK_VALIDATION_FEATURE_DISABLE_API_PARAMETERS_EXT}},
+        {"syncval", true, {VK_VALIDATION_FEATURE_ENABLE_SYNCHRONIZATION_VALIDATION_EXT}, kDisableDefaults},
+        {"best_practices", true, {VK_VALIDATION_FEATURE_ENABLE_BEST_PRACTICES_EXT}, kDisableDefaults},
+        {"gpu_av", true, {VK_VALIDATION_FEATURE_ENABLE_GPU_ASSISTED_EXT}, kDisableDefaults},
+        // Core checks, syncval and best practices each run their own state tracker
+        {"core_syncval_best_practices", true,
+         {VK_VALIDATION_FEATURE_ENABLE_SYNCHRONIZATION_VALIDATION_EXT, VK_VALIDATION_FEATURE_ENABLE_BEST_PRACTICES_EXT},
+         {VK_VALIDATION_FEATURE_DISABLE_THREAD_SAFETY_EXT, VK_VALIDATION_FEATURE_DISABLE_OBJECT_LIFETIMES_EXT,
+          VK_VALIDATION_FEATURE_DISABLE_API_PARAMETERS_EXT}},
+    };
+    return configs;
+}
+
+static bool HasLayer(const char *layer_name) {
+    uint32_t count = 0;
+    vk::EnumerateInstanceLayerProperties(&count, nullptr);
+    std::vector<VkLayerProperties> layers(count);
+    vk::EnumerateInstanceLayerProperties(&count, layers.data());
+    for (const VkLayerProperties &layer : layers) {
+        if (strcmp(layer.layerName, layer_name) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+Context::~Context() {
+    if (device != VK_NULL_HANDLE) {
+        vk::DeviceWaitIdle(device);
+        vk::DestroyDevice(device, nullptr);
+    }
+    if (messenger_ != VK_NULL_HANDLE) {
+        vk::DestroyDebugUtilsMessengerEXT(instance, messenger_, nullptr);
+    }
+    if (instance != VK_NULL_HANDLE) {
+        vk::DestroyInstance(instance, nullptr);
+    }
+}
+
+VKAPI_ATTR VkBool32 VKAPI_CALL Context::DebugCallback(VkDebugUtilsMessageSeverityFlagBitsEXT severity,
+                                                      VkDebugUtilsMessageTypeFlagsEXT types,
+                                                      const VkDebugUtilsMessengerCallbackDataEXT *callback_data,
+                                                      void *user_data) {
+    auto *context = static_cast<Context *>(user_data);
+    // Only report the first one, a workload hitting an error usually hits it on every call
+    if (context->message_count_.fetch_add(1) == 0) {
+        fprintf(stderr, "    [layer message] %s\n", callback_data->pMessage);
+    }
+    return VK_FALSE;
+}
+
+bool Context::Init(const ValidationConfig &config, std::string &error) {
+    VkApplicationInfo app_info = {VK_STRUCTURE_TYPE_APPLICATION_INFO};
+    app_info.pApplicationName = "vvl_benchmarks";
+    app_info.apiVersion = VK_API_VERSION_1_1;
+
+    VkValidationFeaturesEXT validation_features = {VK_STRUCTURE_TYPE_VALIDATION_FEATURES_EXT};
+    validation_features.enabledValidationFeatureCount = static_cast<uint32_t>(config.enables.size());
+    validation_features.pEnabledValidationFeatures = config.enables.data();
+    validation_features.disabledValidationFeatureCount = static_cast<uint32_t>(config.disables.size());
+    validation_features.pDisabledValidationFeatures = config.disables.data();
+
+    std::vector<const char *> layers;
+    std::vector<const char *> extensions;
+    VkInstanceCreateInfo instance_ci = {VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO};
+    instance_ci.pApplicationInfo = &app_info;
+    if (config.use_layer) {
+        if (!HasLayer(kLayerName)) {
+            error = "validation layer not found, check VK_LAYER_PATH";
+            return false;
+        }
+        layers.push_back(kLayerName);
+        // Both are implemented by the layer
+        extensions.push_back(VK_EXT_DEBUG_UTILS_EXTENSION_NAME);
+        extensions.push_back(VK_EXT_VALIDATION_FEATURES_EXTENSION_NAME);
+        instance_ci.pNext = &validation_features;
+    }
+    instance_ci.enabledLayerCount = static_cast<uint32_t>(layers.size());
+    instance_ci.ppEnabledLayerNames = layers.data();
+    instance_ci.enabledExtensionCount = static_cast<uint32_t>(extensions.size());
+    instance_ci.ppEnabledExtensionNames = extensions.data();
+
+    if (vk::CreateInstance(&instance_ci, nullptr, &instance) != VK_SUCCESS) {
+        error = "vkCreateInstance failed, check VK_DRIVER_FILES";
+        return false;
+    }
+
+    if (config.use_layer) {
+        vk::InitInstanceExtension(instance, VK_EXT_DEBUG_UTILS_EXTENSION_NAME);
+        VkDebugUtilsMessengerCreateInfoEXT messenger_ci = {VK_STRUCTURE_TYPE_DEBUG_UTILS_MESSENGER_CREATE_INFO_EXT};
+        messenger_ci.messageSeverity = VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT | VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT;
+        messenger_ci.messageType = VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT | VK_DEBUG_UTILS_MESSAGE_TYPE_PERFORMANCE_BIT_EXT;
+        messenger_ci.pfnUserCallback = DebugCallback;
+        messenger_ci.pUserData = this;
+        vk::CreateDebugUtilsMessengerEXT(instance, &messenger_ci, nullptr, &messenger_);
+    }
+
+    uint32_t gpu_count = 1;
+    const VkResult enumerate_result = vk::EnumeratePhysicalDevices(instance, &gpu_count, &gpu);
+    if ((enumerate_result != VK_SUCCESS && enumerate_result != VK_INCOMPLETE) || gpu_count == 0) {
+        error = "no physical device";
+        return false;
+    }
+    vk::GetPhysicalDeviceMemoryProperties(gpu, &memory_properties_);
+
+    uint32_t queue_family_count = 0;
+    vk::GetPhysicalDeviceQueueFamilyProperties(gpu, &queue_family_count, nullptr);
+    std::vector<VkQueueFamilyProperties> queue_families(queue_family_count);
+    vk::GetPhysicalDeviceQueueFamilyProperties(gpu, &queue_family_count, queue_families.data());
+    queue_family_index = queue_family_count;
+    for (uint32_t i = 0; i < queue_family_count; ++i) {
+        if (queue_families[i].queueFlags & VK_QUEUE_GRAPHICS_BIT) {
+            queue_family_index = i;
+            break;
+        }
+    }
+    if (queue_family_index == queue_family_count) {
+        error = "no graphics queue";
+        return false;
+    }
+
+    // Features GPU-AV relies on, enabled for every config so all of them run the same device
+    VkPhysicalDeviceFeatures supported_features = {};
+    vk::GetPhysicalDeviceFeatures(gpu, &supported_features);
+    VkPhysicalDeviceFeatures features = {};
+    features.fragmentStoresAndAtomics = supported_features.fragmentStoresAndAtomics;
+    features.vertexPipelineStoresAndAtomics = supported_features.vertexPipelineStoresAndAtomics;
+    features.shaderInt64 = supported_features.shaderInt64;
+
+    const float priority = 1.0f;
+    VkDeviceQueueCreateInfo queue_ci = {VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO};
+    queue_ci.queueFamilyIndex = queue_family_index;
+    queue_ci.queueCount = 1;
+    queue_ci.pQueuePriorities = &priority;
+
+    VkDeviceCreateInfo device_ci = {VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO};
+    device_ci.queueCreateInfoCount = 1;
+    device_ci.pQueueCreateInfos = &queue_ci;
+    device_ci.pEnabledFeatures = &features;
+    if (vk::CreateDevice(gpu, &device_ci, nullptr, &device) != VK_SUCCESS) {
+        error = "vkCreateDevice failed";
+        return false;
+    }
+    vk::GetDeviceQueue(device, queue_family_index, 0, &queue);
+    return true;
+}
+
+VkShaderModule Context::CreateShaderModule(const std::vector<uint32_t> &spirv) const {
+    VkShaderModuleCreateInfo module_ci = {VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO};
+    module_ci.codeSize = spirv.size() * sizeof(uint32_t);
+    module_ci.pCode = spirv.data();
+    VkShaderModule shader_module = VK_NULL_HANDLE;
+    vk::CreateShaderModule(device, &module_ci, nullptr, &shader_module);
+    return shader_module;
+}
+
+VkDeviceMemory Context::AllocateMemory(const VkMemoryRequirements &requirements, VkMemoryPropertyFlags properties) const {
+    VkMemoryAllocateInfo alloc_info = {VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO};
+    alloc_info.allocationSize = requirements.size;
+    alloc_info.memoryTypeIndex = memory_properties_.memoryTypeCount;
+    for (uint32_t i = 0; i < memory_properties_.memoryTypeCount; ++i) {
+        if ((requirements.memoryTypeBits & (1u << i)) &&
+            (memory_properties_.memoryTypes[i].propertyFlags & properties) == properties) {
+            alloc_info.memoryTypeIndex = i;
+            break;
+        }
+    }
+    VkDeviceMemory memory = VK_NULL_HANDLE;
+    if (alloc_info.memoryTypeIndex != memory_properties_.memoryTypeCount) {
+        vk::AllocateMemory(device, &alloc_info, nullptr, &memory);
+    }
+    return memory;
+}
+
+static std::string EscapeJson(const std::string &str) {
+    std::string escaped;
+    escaped.reserve(str.size());
+    for (const char c : str) {
+        if (c == '"' || c == '\\') {
+            escaped += '\\';
+        }
+        escaped += c;
+    }
+    return escaped;
+}
+
+// Loosely follows the google-benchmark layout so existing tooling can be reused to track regressions
+std::string ToJson(const std::vector<Result> &results) {
+    std::stringstream out;
+    out << "{\n  \"benchmarks\": [";
+    for (size_t i = 0; i < results.size(); ++i) {
+        const Result &result = results[i];
+        out << (i == 0 ? "\n" : ",\n");
+        out << "    {\n";
+        out << "      \"name\": \"" << result.workload << "/" << result.config << "\",\n";
+        out << "      \"workload\": \"" << result.workload << "\",\n";
+        out << "      \"config\": \"" << result.config << "\",\n";
+        if (!result.skip_reason.empty()) {
+            out << "      \"skipped\": \"" << EscapeJson(result.skip_reason) << "\"\n";
+        } else {
+            const double ns_per_call = result.calls ? double(result.elapsed_ns) / double(result.calls) : 0.0;
+            const double ns_per_iteration = result.iterations ? double(result.elapsed_ns) / double(result.iterations) : 0.0;
+            out << "      \"iterations\": " << result.iterations << ",\n";
+            out << "      \"calls\": " << result.calls << ",\n";
+            out << "      \"real_time_ns\": " << result.elapsed_ns << ",\n";
+            out << "      \"ns_per_call\": " << ns_per_call << ",\n";
+            out << "      \"ns_per_iteration\": " << ns_per_iteration << ",\n";
+            out << "      \"layer_messages\": " << result.messages << "\n";
+        }
+        out << "    }";
+    }
+    out << "\n  ]\n}\n";
+    return out.str();
+}
+
+}  // namespace bench
@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <vulkan/vulkan.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Small in-tree harness measuring the CPU overhead the validation layer adds to Vulkan calls.
+// The layer runs on top of the Test ICD, so the time measured is (almost) only spent in the layer.
+namespace bench {
+
+// Which validation object(s) are turned on for a run
+struct ValidationConfig {
+    const char *name;
+    // If false, the layer is not loaded at all and calls go straight to the Test ICD (baseline)
+    bool use_layer;
+    std::vector<VkValidationFeatureEnableEXT> enables;
+    std::vector<VkValidationFeatureDisableEXT> disables;
+};
+
+const std::vector<ValidationConfig> &GetValidationConfigs();
+
+// Instance, device and queue for one validation config
+class Context {
+  public:
+    ~Context();
+
+    // Return false, with a reason, if the config can not run (missing layer, device creation failed, ...)
+    bool Init(const ValidationConfig &config, std::string &error);
+
+    VkShaderModule CreateShaderModule(const std::vector<uint32_t> &spirv) const;
+    VkDeviceMemory AllocateMemory(const VkMemoryRequirements &requirements, VkMemoryPropertyFlags properties) const;
+
+    // Number of warnings and errors reported by the layer, workloads are expected to be error free
+    uint32_t MessageCount() const { return message_count_.load(); }
+
+    VkInstance instance = VK_NULL_HANDLE;
+    VkPhysicalDevice gpu = VK_NULL_HANDLE;
+    VkDevice device = VK_NULL_HANDLE;
+    VkQueue queue = VK_NULL_HANDLE;
+    uint32_t queue_family_index = 0;
+
+  private:
+    static VKAPI_ATTR VkBool32 VKAPI_CALL DebugCallback(VkDebugUtilsMessageSeverityFlagBitsEXT severity,
+                                                       VkDebugUtilsMessageTypeFlagsEXT types,
+                                                       const VkDebugUtilsMessengerCallbackDataEXT *callback_data, void *user_data);
+
+    VkDebugUtilsMessengerEXT messenger_ = VK_NULL_HANDLE;
+    VkPhysicalDeviceMemoryProperties memory_properties_ = {};
+    std::atomic<uint32_t> message_count_{0};
+};
+
+// Passed to workloads, only time spent between ResumeTiming() and PauseTiming() is accounted for.
+// Workloads report how many Vulkan calls they made so results can be compared as a per call overhead.
+class State {
+  public:
+    explicit State(uint32_t iterations) : iterations_(iterations) {}
+
+    uint32_t Iterations() const { return iterations_; }
+
+    void ResumeTiming() { start_ = std::chrono::steady_clock::now(); }
+    void PauseTiming() { elapsed_ += std::chrono::steady_clock::now() - start_; }
+    void AddCalls(uint64_t calls) { calls_ += calls; }
+
+    int64_t ElapsedNs() const { return std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed_).count(); }
+    uint64_t Calls() const { return calls_; }
+
+  private:
+    const uint32_t iterations_;
+    std::chrono::steady_clock::time_point start_;
+    std::chrono::steady_clock::duration elapsed_{0};
+    uint64_t calls_ = 0;
+};
+
+struct Workload {
+    const char *name;
+    void (*run)(Context &context, State &state);
+};
+
+// Benchmark of a layer internal algorithm, linked directly into vvl_benchmarks.
+// Kernels do not need a device and run once instead of once per validation config.
+// Calls are the number of elements processed (for example indices scanned).
+struct Kernel {
+    const char *name;
+    void (*run)(State &state);
+    uint32_t default_iterations;
+};
+
+const std::vector<Kernel> &GetKernels();
+
+struct Result {
+    std::string workload;
+    std::string config;
+    // Empty if the run was successful
+    std::string skip_reason;
+    uint32_t iterations = 0;
+    uint64_t calls = 0;
+    int64_t elapsed_ns = 0;
+    uint32_t messages = 0;
+};
+
+std::string ToJson(const std::vector<Result> &results);
+
+}  // namespace bench
@@ -0,0 +1,624 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// vvl_benchmarks: measure per call overhead of the validation layer on top of the Test ICD
+//
+// usage: vvl_benchmarks [--filter <substring>] [--iterations <count>] [--output <file.json>] [--list]
+//   --filter      only run benchmarks whose "workload/config" name contains the substring
+//   --iterations  number of iterations per benchmark (default is picked per workload)
+//   --output      write JSON results to a file instead of stdout
+
+#include "benchmark_framework.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "generated/vk_function_pointers.h"
+#include BENCHMARK_CONFIG_HEADER_FILE
+
+namespace bench {
+
+// The Test ICD does not execute shaders, an empty entry point is enough and keeps glslang out of the benchmarks.
+//    OpCapability Shader
+//    OpMemoryModel Logical GLSL450
+//    OpEntryPoint <stage> %4 "main"
+//    [OpExecutionMode %4 OriginUpperLeft]
+//    %2 = OpTypeVoid
+//    %3 = OpTypeFunction %2
+//    %4 = OpFunction %2 None %3
+//    %5 = OpLabel
+//    OpReturn
+//    OpFunctionEnd
+static std::vector<uint32_t> EmptyShaderSpirv(VkShaderStageFlagBits stage) {
+    const uint32_t execution_model = (stage == VK_SHADER_STAGE_FRAGMENT_BIT) ? 4u : 0u;
+    std::vector<uint32_t> spirv = {0x07230203, 0x00010000, 0, 6, 0,  // header, bound = 6
+                                   0x00020011, 1,                    // OpCapability Shader
+                                   0x0003000e, 0, 1,                 // OpMemoryModel Logical GLSL450
+                                   0x0005000f, execution_model, 4, 0x6e69616d, 0};  // OpEntryPoint "main"
+    if (stage == VK_SHADER_STAGE_FRAGMENT_BIT) {
+        spirv.insert(spirv.end(), {0x00030010, 4, 7});  // OpExecutionMode OriginUpperLeft
+    }
+    spirv.insert(spirv.end(), {
+                                  0x00020013, 2,           // OpTypeVoid
+                                  0x00030021, 3, 2,        // OpTypeFunction
+                                  0x00050036, 2, 4, 0, 3,  // OpFunction
+                                  0x000200f8, 5,           // OpLabel
+                                  0x000100fd,              // OpReturn
+                                  0x00010038,              // OpFunctionEnd
+                              });
+    return spirv;
+}
+
+static constexpr uint32_t kFramebufferSize = 64;
+static constexpr uint32_t kUniformDescriptorCount = 16;
+static constexpr VkDeviceSize kUniformRange = 256;
+
+// Objects needed to record a render pass with draws, shared by most workloads
+struct GraphicsObjects {
+    explicit GraphicsObjects(Context &context);
+    ~GraphicsObjects();
+
+    VkPipeline CreatePipeline() const;
+    // Record a full render pass with draw_count draws, return the number of Vulkan calls made
+    uint64_t RecordDraws(VkCommandBuffer cb, uint32_t draw_count, VkCommandBufferUsageFlags usage = 0) const;
+
+    Context &context;
+    VkImage image = VK_NULL_HANDLE;
+    VkDeviceMemory image_memory = VK_NULL_HANDLE;
+    VkImageView image_view = VK_NULL_HANDLE;
+    VkRenderPass render_pass = VK_NULL_HANDLE;
+    VkFramebuffer framebuffer = VK_NULL_HANDLE;
+    VkBuffer uniform_buffer = VK_NULL_HANDLE;
+    VkDeviceMemory uniform_memory = VK_NULL_HANDLE;
+    VkDescriptorSetLayout set_layout = VK_NULL_HANDLE;
+    VkPipelineLayout pipeline_layout = VK_NULL_HANDLE;
+    VkDescriptorPool descriptor_pool = VK_NULL_HANDLE;
+    VkDescriptorSet descriptor_set = VK_NULL_HANDLE;
+    VkShaderModule vertex_module = VK_NULL_HANDLE;
+    VkShaderModule fragment_module = VK_NULL_HANDLE;
+    VkPipeline pipeline = VK_NULL_HANDLE;
+};
+
+GraphicsObjects::GraphicsObjects(Context &context_) : context(context_) {
+    VkDevice device = context.device;
+
+    VkImageCreateInfo image_ci = {VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO};
+    image_ci.imageType = VK_IMAGE_TYPE_2D;
+    image_ci.format = VK_FORMAT_R8G8B8A8_UNORM;
+    image_ci.extent = {kFramebufferSize, kFramebufferSize, 1};
+    image_ci.mipLevels = 1;
+    image_ci.arrayLayers = 1;
+    image_ci.samples = VK_SAMPLE_COUNT_1_BIT;
+    image_ci.tiling = VK_IMAGE_TILING_OPTIMAL;
+    image_ci.usage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT;
+    image_ci.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+    vk::CreateImage(device, &image_ci, nullptr, &image);
+    VkMemoryRequirements image_requirements;
+    vk::GetImageMemoryRequirements(device, image, &image_requirements);
+    image_memory = context.AllocateMemory(image_requirements, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+    vk::BindImageMemory(device, image, image_memory, 0);
+
+    VkImageViewCreateInfo view_ci = {VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO};
+    view_ci.image = image;
+    view_ci.viewType = VK_IMAGE_VIEW_TYPE_2D;
+    view_ci.format = image_ci.format;
+    view_ci.subresourceRange = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1};
+    vk::CreateImageView(device, &view_ci, nullptr, &image_view);
+
+    VkAttachmentDescription attachment = {};
+    attachment.format = image_ci.format;
+    attachment.samples = VK_SAMPLE_COUNT_1_BIT;
+    attachment.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
+    attachment.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
+    attachment.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+    attachment.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+    attachment.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+    attachment.finalLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+    VkAttachmentReference color_ref = {0, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL};
+    VkSubpassDescription subpass = {};
+    subpass.pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
+    subpass.colorAttachmentCount = 1;
+    subpass.pColorAttachments = &color_ref;
+    // Order render passes recorded back to back (and resubmitted) so sync validation has nothing to report
+    VkSubpassDependency dependency = {};
+    dependency.srcSubpass = VK_SUBPASS_EXTERNAL;
+    dependency.dstSubpass = 0;
+    dependency.srcStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+    dependency.dstStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+    dependency.srcAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+    dependency.dstAccessMask = VK_ACCESS_COLOR_ATTACHMENT_READ_BIT | VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+    VkRenderPassCreateInfo render_pass_ci = {VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO};
+    render_pass_ci.attachmentCount = 1;
+    render_pass_ci.pAttachments = &attachment;
+    render_pass_ci.subpassCount = 1;
+    render_pass_ci.pSubpasses = &subpass;
+    render_pass_ci.dependencyCount = 1;
+    render_pass_ci.pDependencies = &dependency;
+    vk::CreateRenderPass(device, &render_pass_ci, nullptr, &render_pass);
+
+    VkFramebufferCreateInfo framebuffer_ci = {VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO};
+    framebuffer_ci.renderPass = render_pass;
+    framebuffer_ci.attachmentCount = 1;
+    framebuffer_ci.pAttachments = &image_view;
+    framebuffer_ci.width = kFramebufferSize;
+    framebuffer_ci.height = kFramebufferSize;
+    framebuffer_ci.layers = 1;
+    vk::CreateFramebuffer(device, &framebuffer_ci, nullptr, &framebuffer);
+
+    VkBufferCreateInfo buffer_ci = {VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO};
+    buffer_ci.size = kUniformDescriptorCount * kUniformRange;
+    buffer_ci.usage = VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT;
+    buffer_ci.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    vk::CreateBuffer(device, &buffer_ci, nullptr, &uniform_buffer);
+    VkMemoryRequirements buffer_requirements;
+    vk::GetBufferMemoryRequirements(device, uniform_buffer, &buffer_requirements);
+    uniform_memory = context.AllocateMemory(buffer_requirements, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT);
+    vk::BindBufferMemory(device, uniform_buffer, uniform_memory, 0);
+
+    VkDescriptorSetLayoutBinding binding = {0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, kUniformDescriptorCount,
+                                            VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT, nullptr};
+    VkDescriptorSetLayoutCreateInfo set_layout_ci = {VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO};
+    set_layout_ci.bindingCount = 1;
+    set_layout_ci.pBindings = &binding;
+    vk::CreateDescriptorSetLayout(device, &set_layout_ci, nullptr, &set_layout);
+
+    VkPipelineLayoutCreateInfo pipeline_layout_ci = {VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO};
+    pipeline_layout_ci.setLayoutCount = 1;
+    pipeline_layout_ci.pSetLayouts = &set_layout;
+    vk::CreatePipelineLayout(device, &pipeline_layout_ci, nullptr, &pipeline_layout);
+
+    VkDescriptorPoolSize pool_size = {VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, kUniformDescriptorCount};
+    VkDescriptorPoolCreateInfo pool_ci = {VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO};
+    pool_ci.maxSets = 1;
+    pool_ci.poolSizeCount = 1;
+    pool_ci.pPoolSizes = &pool_size;
+    vk::CreateDescriptorPool(device, &pool_ci, nullptr, &descriptor_pool);
+    VkDescriptorSetAllocateInfo set_alloc_info = {VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO};
+    set_alloc_info.descriptorPool = descriptor_pool;
+    set_alloc_info.descriptorSetCount = 1;
+    set_alloc_info.pSetLayouts = &set_layout;
+    vk::AllocateDescriptorSets(device, &set_alloc_info, &descriptor_set);
+
+    std::vector<VkDescriptorBufferInfo> buffer_infos(kUniformDescriptorCount);
+    for (uint32_t i = 0; i < kUniformDescriptorCount; ++i) {
+        buffer_infos[i] = {uniform_buffer, i * kUniformRange, kUniformRange};
+    }
+    VkWriteDescriptorSet write = {VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET};
+    write.dstSet = descriptor_set;
+    write.dstBinding = 0;
+    write.descriptorCount = kUniformDescriptorCount;
+    write.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+    write.pBufferInfo = buffer_infos.data();
+    vk::UpdateDescriptorSets(device, 1, &write, 0, nullptr);
+
+    vertex_module = context.CreateShaderModule(EmptyShaderSpirv(VK_SHADER_STAGE_VERTEX_BIT));
+    fragment_module = context.CreateShaderModule(EmptyShaderSpirv(VK_SHADER_STAGE_FRAGMENT_BIT));
+    pipeline = CreatePipeline();
+}
+
+GraphicsObjects::~GraphicsObjects() {
+    VkDevice device = context.device;
+    vk::DeviceWaitIdle(device);
+    vk::DestroyPipeline(device, pipeline, nullptr);
+    vk::DestroyShaderModule(device, fragment_module, nullptr);
+    vk::DestroyShaderModule(device, vertex_module, nullptr);
+    vk::DestroyDescriptorPool(device, descriptor_pool, nullptr);
+    vk::DestroyPipelineLayout(device, pipeline_layout, nullptr);
+    vk::DestroyDescriptorSetLayout(device, set_layout, nullptr);
+    vk::DestroyBuffer(device, uniform_buffer, nullptr);
+    vk::FreeMemory(device, uniform_memory, nullptr);
+    vk::DestroyFramebuffer(device, framebuffer, nullptr);
+    vk::DestroyRenderPass(device, render_pass, nullptr);
+    vk::DestroyImageView(device, image_view, nullptr);
+    vk::DestroyImage(device, image, nullptr);
+    vk::FreeMemory(device, image_memory, nullptr);
+}
+
+VkPipeline GraphicsObjects::CreatePipeline() const {
+    VkPipelineShaderStageCreateInfo stages[2] = {};
+    stages[0].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+    stages[0].stage = VK_SHADER_STAGE_VERTEX_BIT;
+    stages[0].module = vertex_module;
+    stages[0].pName = "main";
+    stages[1].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+    stages[1].stage = VK_SHADER_STAGE_FRAGMENT_BIT;
+    stages[1].module = fragment_module;
+    stages[1].pName = "main";
+
+    VkPipelineVertexInputStateCreateInfo vertex_input = {VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO};
+    VkPipelineInputAssemblyStateCreateInfo input_assembly = {VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO};
+    input_assembly.topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+    VkPipelineViewportStateCreateInfo viewport_state = {VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO};
+    viewport_state.viewportCount = 1;
+    viewport_state.scissorCount = 1;
+    VkPipelineRasterizationStateCreateInfo rasterization = {VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO};
+    rasterization.polygonMode = VK_POLYGON_MODE_FILL;
+    rasterization.cullMode = VK_CULL_MODE_NONE;
+    rasterization.frontFace = VK_FRONT_FACE_COUNTER_CLOCKWISE;
+    rasterization.lineWidth = 1.0f;
+    VkPipelineMultisampleStateCreateInfo multisample = {VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO};
+    multisample.rasterizationSamples = VK_SAMPLE_COUNT_1_BIT;
+    VkPipelineColorBlendAttachmentState blend_attachment = {};
+    blend_attachment.colorWriteMask =
+        VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT | VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT;
+    VkPipelineColorBlendStateCreateInfo color_blend = {VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO};
+    color_blend.attachmentCount = 1;
+    color_blend.pAttachments = &blend_attachment;
+    const VkDynamicState dynamic_states[2] = {VK_DYNAMIC_STATE_VIEWPORT, VK_DYNAMIC_STATE_SCISSOR};
+    VkPipelineDynamicStateCreateInfo dynamic_state = {VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO};
+    dynamic_state.dynamicStateCount = 2;
+    dynamic_state.pDynamicStates = dynamic_states;
+
+    VkGraphicsPipelineCreateInfo pipeline_ci = {VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO};
+    pipeline_ci.stageCount = 2;
+    pipeline_ci.pStages = stages;
+    pipeline_ci.pVertexInputState = &vertex_input;
+    pipeline_ci.pInputAssemblyState = &input_assembly;
+    pipeline_ci.pViewportState = &viewport_state;
+    pipeline_ci.pRasterizationState = &rasterization;
+    pipeline_ci.pMultisampleState = &multisample;
+    pipeline_ci.pColorBlendState = &color_blend;
+    pipeline_ci.pDynamicState = &dynamic_state;
+    pipeline_ci.layout = pipeline_layout;
+    pipeline_ci.renderPass = render_pass;
+    pipeline_ci.subpass = 0;
+
+    VkPipeline new_pipeline = VK_NULL_HANDLE;
+    vk::CreateGraphicsPipelines(context.device, VK_NULL_HANDLE, 1, &pipeline_ci, nullptr, &new_pipeline);
+    return new_pipeline;
+}
+
+uint64_t GraphicsObjects::RecordDraws(VkCommandBuffer cb, uint32_t draw_count, VkCommandBufferUsageFlags usage) const {
+    VkCommandBufferBeginInfo begin_info = {VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO};
+    begin_info.flags = usage;
+    vk::BeginCommandBuffer(cb, &begin_info);
+
+    VkClearValue clear_value = {};
+    VkRenderPassBeginInfo render_pass_begin = {VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO};
+    render_pass_begin.renderPass = render_pass;
+    render_pass_begin.framebuffer = framebuffer;
+    render_pass_begin.renderArea = {{0, 0}, {kFramebufferSize, kFramebufferSize}};
+    render_pass_begin.clearValueCount = 1;
+    render_pass_begin.pClearValues = &clear_value;
+    vk::CmdBeginRenderPass(cb, &render_pass_begin, VK_SUBPASS_CONTENTS_INLINE);
+
+    const VkViewport viewport = {0.0f, 0.0f, float(kFramebufferSize), float(kFramebufferSize), 0.0f, 1.0f};
+    const VkRect2D scissor = {{0, 0}, {kFramebufferSize, kFramebufferSize}};
+    vk::CmdBindPipeline(cb, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline);
+    vk::CmdSetViewport(cb, 0, 1, &viewport);
+    vk::CmdSetScissor(cb, 0, 1, &scissor);
+    vk::CmdBindDescriptorSets(cb, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline_layout, 0, 1, &descriptor_set, 0, nullptr);
+    for (uint32_t i = 0; i < draw_count; ++i) {
+        vk::CmdDraw(cb, 3, 1, 0, 0);
+    }
+
+    vk::CmdEndRenderPass(cb);
+    vk::EndCommandBuffer(cb);
+    return 8 + draw_count;
+}
+
+// Command pool with a single resettable primary command buffer
+struct CommandObjects {
+    explicit CommandObjects(const Context &context_) : context(context_) {
+        VkCommandPoolCreateInfo pool_ci = {VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO};
+        pool_ci.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+        pool_ci.queueFamilyIndex = context.queue_family_index;
+        vk::CreateCommandPool(context.device, &pool_ci, nullptr, &pool);
+        VkCommandBufferAllocateInfo alloc_info = {VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO};
+        alloc_info.commandPool = pool;
+        alloc_info.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+        alloc_info.commandBufferCount = 1;
+        vk::AllocateCommandBuffers(context.device, &alloc_info, &cb);
+    }
+    ~CommandObjects() { vk::DestroyCommandPool(context.device, pool, nullptr); }
+
+    const Context &context;
+    VkCommandPool pool = VK_NULL_HANDLE;
+    VkCommandBuffer cb = VK_NULL_HANDLE;
+};
+
+// Recording a command buffer with many draws, the most common hot path of an application
+static void DrawRecording(Context &context, State &state) {
+    constexpr uint32_t kDrawCount = 1000;
+    GraphicsObjects objects(context);
+    CommandObjects commands(context);
+
+    for (uint32_t i = 0; i < state.Iterations(); ++i) {
+        state.ResumeTiming();
+        state.AddCalls(objects.RecordDraws(commands.cb, kDrawCount));
+        state.PauseTiming();
+        vk::ResetCommandBuffer(commands.cb, 0);
+    }
+}
+
+// Rewriting descriptors every frame, as applications without descriptor indexing do
+static void DescriptorUpdates(Context &context, State &state) {
+    constexpr uint32_t kUpdateCount = 100;
+    GraphicsObjects objects(context);
+
+    // One write per descriptor, instead of a single write for the whole array, to stress the per write cost
+    std::vector<VkDescriptorBufferInfo> buffer_infos(kUniformDescriptorCount);
+    std::vector<VkWriteDescriptorSet> writes(kUniformDescriptorCount);
+    for (uint32_t i = 0; i < kUniformDescriptorCount; ++i) {
+        buffer_infos[i] = {objects.uniform_buffer, 0, kUniformRange};
+        writes[i] = {VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET};
+        writes[i].dstSet = objects.descriptor_set;
+        writes[i].dstBinding = 0;
+        writes[i].dstArrayElement = i;
+        writes[i].descriptorCount = 1;
+        writes[i].descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+        writes[i].pBufferInfo = &buffer_infos[i];
+    }
+
+    for (uint32_t i = 0; i < state.Iterations(); ++i) {
+        for (uint32_t d = 0; d < kUniformDescriptorCount; ++d) {
+            buffer_infos[d].offset = ((i + d) % kUniformDescriptorCount) * kUniformRange;
+        }
+        state.ResumeTiming();
+        for (uint32_t u = 0; u < kUpdateCount; ++u) {
+            vk::UpdateDescriptorSets(context.device, kUniformDescriptorCount, writes.data(), 0, nullptr);
+        }
+        state.PauseTiming();
+        state.AddCalls(kUpdateCount);
+    }
+}
+
+// Thousands of single descriptor writes to a set in one call, while the set is bound in recorded command buffers.
+// Every write that could invalidate the command buffers the set is bound to used to walk all of them.
+static void DescriptorUpdateStorm(Context &context, State &state) {
+    constexpr uint32_t kWriteCount = 4096;
+    constexpr uint32_t kBoundCommandBufferCount = 16;
+    GraphicsObjects objects(context);
+    std::vector<std::unique_ptr<CommandObjects>> commands;
+    for (uint32_t c = 0; c < kBoundCommandBufferCount; ++c) {
+        commands.emplace_back(std::make_unique<CommandObjects>(context));
+        objects.RecordDraws(commands.back()->cb, 1);
+    }
+
+    std::vector<VkDescriptorBufferInfo> buffer_infos(kWriteCount);
+    std::vector<VkWriteDescriptorSet> writes(kWriteCount);
+    for (uint32_t i = 0; i < kWriteCount; ++i) {
+        const uint32_t element = i % kUniformDescriptorCount;
+        buffer_infos[i] = {objects.uniform_buffer, element * kUniformRange, kUniformRange};
+        writes[i] = {VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET};
+        writes[i].dstSet = objects.descriptor_set;
+        writes[i].dstBinding = 0;
+        writes[i].dstArrayElement = element;
+        writes[i].descriptorCount = 1;
+        writes[i].descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+        writes[i].pBufferInfo = &buffer_infos[i];
+    }
+
+    for (uint32_t i = 0; i < state.Iterations(); ++i) {
+        state.ResumeTiming();
+        vk::UpdateDescriptorSets(context.device, kWriteCount, writes.data(), 0, nullptr);
+        state.PauseTiming();
+        state.AddCalls(1);
+    }
+}
+
+// Loading screens and shader caches warming up create many pipelines in a row
+static void PipelineCreation(Context &context, State &state) {
+    constexpr uint32_t kPipelineCount = 16;
+    GraphicsObjects objects(context);
+    std::vector<VkPipeline> pipelines(kPipelineCount);
+
+    for (uint32_t i = 0; i < state.Iterations(); ++i) {
+        state.ResumeTiming();
+        for (VkPipeline &pipeline : pipelines) {
+            pipeline = objects.CreatePipeline();
+        }
+        state.PauseTiming();
+        state.AddCalls(kPipelineCount);
+        for (VkPipeline pipeline : pipelines) {
+            vk::DestroyPipeline(context.device, pipeline, nullptr);
+        }
+    }
+}
+
+// Submitting already recorded work, which also covers the queue submission state update and retirement
+static void QueueSubmit(Context &context, State &state) {
+    constexpr uint32_t kSubmitCount = 64;
+    GraphicsObjects objects(context);
+    CommandObjects commands(context);
+    objects.RecordDraws(commands.cb, 10, VK_COMMAND_BUFFER_USAGE_SIMULTANEOUS_USE_BIT);
+
+    VkSubmitInfo submit_info = {VK_STRUCTURE_TYPE_SUBMIT_INFO};
+    submit_info.commandBufferCount = 1;
+    submit_info.pCommandBuffers = &commands.cb;
+
+    for (uint32_t i = 0; i < state.Iterations(); ++i) {
+        state.ResumeTiming();
+        for (uint32_t s = 0; s < kSubmitCount; ++s) {
+            vk::QueueSubmit(context.queue, 1, &submit_info, VK_NULL_HANDLE);
+        }
+        vk::QueueWaitIdle(context.queue);
+        state.PauseTiming();
+        state.AddCalls(kSubmitCount + 1);
+    }
+}
+
+// Each thread records into its own command pool, measures contention on the layer's shared state.
+// Run with 1 to 32 threads: calls per second for each thread count give the scaling of recording.
+template <uint32_t thread_count>
+static void MultithreadedRecording(Context &context, State &state) {
+    constexpr uint32_t kDrawCount = 250;
+    GraphicsObjects objects(context);
+    std::vector<std::unique_ptr<CommandObjects>> commands;
+    for (uint32_t t = 0; t < thread_count; ++t) {
+        commands.emplace_back(std::make_unique<CommandObjects>(context));
+    }
+
+    std::vector<uint64_t> calls(thread_count, 0);
+    std::vector<std::thread> threads;
+    state.ResumeTiming();
+    for (uint32_t t = 0; t < thread_count; ++t) {
+        threads.emplace_back([&, t]() {
+            for (uint32_t i = 0; i < state.Iterations(); ++i) {
+                calls[t] += objects.RecordDraws(commands[t]->cb, kDrawCount);
+                vk::ResetCommandBuffer(commands[t]->cb, 0);
+                ++calls[t];
+            }
+        });
+    }
+    for (std::thread &thread : threads) {
+        thread.join();
+    }
+    state.PauseTiming();
+    for (uint64_t thread_calls : calls) {
+        state.AddCalls(thread_calls);
+    }
+}
+
+struct WorkloadInfo {
+    Workload workload;
+    uint32_t default_iterations;
+};
+
+static const std::vector<WorkloadInfo> kWorkloads = {
+    {{"draw_recording", DrawRecording}, 200},
+    {{"descriptor_updates", DescriptorUpdates}, 200},
+    {{"descriptor_update_storm", DescriptorUpdateStorm}, 100},
+    {{"pipeline_creation", PipelineCreation}, 50},
+    {{"queue_submit", QueueSubmit}, 100},
+    {{"multithreaded_recording_1", MultithreadedRecording<1>}, 100},
+    {{"multithreaded_recording_2", MultithreadedRecording<2>}, 100},
+    {{"multithreaded_recording_4", MultithreadedRecording<4>}, 100},
+    {{"multithreaded_recording_8", MultithreadedRecording<8>}, 50},
+    {{"multithreaded_recording_16", MultithreadedRecording<16>}, 25},
+    {{"multithreaded_recording_32", MultithreadedRecording<32>}, 25},
+};
+
+}  // namespace bench
+
+static void SetDefaultEnvironment(const char *variable, const char *value) {
+    const char *current = std::getenv(variable);
+    if (current && current[0] != '\0') {
+        return;
+    }
+#if defined(_WIN32)
+    _putenv_s(variable, value);
+#else
+    setenv(variable, value, 1);
+#endif
+}
+
+int main(int argc, char **argv) {
+    std::string filter;
+    std::string output_path;
+    uint32_t iterations = 0;
+    bool list_only = false;
+    for (int i = 1; i < argc; ++i) {
+        const std::string_view arg = argv[i];
+        if (arg == "--filter" && i + 1 < argc) {
+            filter = argv[++i];
+        } else if (arg == "--iterations" && i + 1 < argc) {
+            iterations = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        } else if (arg == "--output" && i + 1 < argc) {
+            output_path = argv[++i];
+        } else if (arg == "--list") {
+            list_only = true;
+        } else {
+            fprintf(stderr, "usage: %s [--filter <substring>] [--iterations <count>] [--output <file.json>] [--list]\n", argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    // Unless told otherwise, measure the layer of this build on top of the Test ICD of this build
+    SetDefaultEnvironment("VK_LAYER_PATH", VALIDATION_LAYERS_BUILD_PATH);
+    SetDefaultEnvironment("VK_DRIVER_FILES", TEST_ICD_JSON_PATH);
+    vk::InitCore("vulkan");
+
+    std::vector<bench::Result> results;
+    for (const bench::WorkloadInfo &info : bench::kWorkloads) {
+        for (const bench::ValidationConfig &config : bench::GetValidationConfigs()) {
+            const std::string name = std::string(info.workload.name) + "/" + config.name;
+            if (!filter.empty() && name.find(filter) == std::string::npos) {
+                continue;
+            }
+            if (list_only) {
+                printf("%s\n", name.c_str());
+                continue;
+            }
+
+            bench::Result result;
+            result.workload = info.workload.name;
+            result.config = config.name;
+            fprintf(stderr, "%s\n", name.c_str());
+            {
+                bench::Context context;
+                if (!context.Init(config, result.skip_reason)) {
+                    fprintf(stderr, "    skipped: %s\n", result.skip_reason.c_str());
+                    results.emplace_back(std::move(result));
+                    continue;
+                }
+                bench::State state(iterations ? iterations : info.default_iterations);
+                info.workload.run(context, state);
+                result.iterations = state.Iterations();
+                result.calls = state.Calls();
+                result.elapsed_ns = state.ElapsedNs();
+                result.messages = context.MessageCount();
+            }
+            fprintf(stderr, "    %.1f ns/call (%llu calls)\n", result.calls ? double(result.elapsed_ns) / double(result.calls) : 0.0,
+                    static_cast<unsigned long long>(result.calls));
+            results.emplace_back(std::move(result));
+        }
+    }
+    for (const bench::Kernel &kernel : bench::GetKernels()) {
+        const std::string name = std::string(kernel.name) + "/kernel";
+        if (!filter.empty() && name.find(filter) == std::string::npos) {
+            continue;
+        }
+        if (list_only) {
+            printf("%s\n", name.c_str());
+            continue;
+        }
+
+        fprintf(stderr, "%s\n", name.c_str());
+        bench::State state(iterations ? iterations : kernel.default_iterations);
+        kernel.run(state);
+        bench::Result result;
+        result.workload = kernel.name;
+        result.config = "kernel";
+        result.iterations = state.Iterations();
+        result.calls = state.Calls();
+        result.elapsed_ns = state.ElapsedNs();
+        fprintf(stderr, "    %.3f ns/element (%llu elements)\n",
+                result.calls ? double(result.elapsed_ns) / double(result.calls) : 0.0, static_cast<unsigned long long>(result.calls));
+        results.emplace_back(std::move(result));
+    }
+    if (list_only) {
+        return EXIT_SUCCESS;
+    }
+
+    const std::string json = bench::ToJson(results);
+    if (output_path.empty()) {
+        printf("%s", json.c_str());
+    } else {
+        std::ofstream file(output_path);
+        file << json;
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "benchmark_framework.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "utils/index_buffer_scan.h"
+
+namespace bench {
+
+// Size of a large mesh, index buffers of this size are common in recent games
+static constexpr uint32_t kIndexCount = 2 * 1024 * 1024;
+
+// Triangle list of a grid, with the locality a vertex cache optimized mesh would have
+template <typename T>
+static std::vector<T> MeshIndices() {
+    std::vector<T> indices(kIndexCount);
+    // Wrap around before reaching the primitive restart value
+    const uint32_t wrap = std::min<uint32_t>(std::numeric_limits<T>::max() - 16, kIndexCount);
+    std::mt19937 rng(0);
+    for (uint32_t i = 0; i < kIndexCount; ++i) {
+        const uint32_t base = (i / 2) % wrap;
+        indices[i] = static_cast<T>(base + static_cast<uint32_t>(rng() % 16));
+    }
+    return indices;
+}
+
+template <typename T, VkIndexType index_type>
+static void IndexBufferMinMax(State &state) {
+    const std::vector<T> indices = MeshIndices<T>();
+    uint32_t checksum = 0;
+    for (uint32_t i = 0; i < state.Iterations(); ++i) {
+        state.ResumeTiming();
+        const index_buffer::MinMax range = index_buffer::ScanMinMax(indices.data(), kIndexCount, index_type);
+        state.PauseTiming();
+        checksum += range.max - range.min;
+        state.AddCalls(kIndexCount);
+    }
+    // Keep the compiler from optimizing the scan away
+    if (checksum == 0) {
+        fprintf(stderr, "    unexpected empty index range\n");
+    }
+}
+
+template <typename T, VkIndexType index_type>
+static void IndexBufferVertexReuse(State &state) {
+    const std::vector<T> indices = MeshIndices<T>();
+    const index_buffer::MinMax range = index_buffer::ScanMinMax(indices.data(), kIndexCount, index_type);
+    uint32_t checksum = 0;
+    for (uint32_t i = 0; i < state.Iterations(); ++i) {
+        state.ResumeTiming();
+        const index_buffer::VertexReuse reuse = index_buffer::ScanVertexReuse(indices.data(), kIndexCount, index_type, true, range);
+        state.PauseTiming();
+        checksum += reuse.shaded_count;
+        state.AddCalls(kIndexCount);
+    }
+    if (checksum == 0) {
+        fprintf(stderr, "    unexpected zero shaded vertex count\n");
+    }
+}
+
+const std::vector<Kernel> &GetKernels() {
+    static const std::vector<Kernel> kernels = {
+        {"index_buffer_min_max_uint16", IndexBufferMinMax<uint16_t, VK_INDEX_TYPE_UINT16>, 100},
+        {"index_buffer_min_max_uint32", IndexBufferMinMax<uint32_t, VK_INDEX_TYPE_UINT32>, 100},
+        {"index_buffer_vertex_reuse_uint16", IndexBufferVertexReuse<uint16_t, VK_INDEX_TYPE_UINT16>, 10},
+        {"index_buffer_vertex_reuse_uint32", IndexBufferVertexReuse<uint32_t, VK_INDEX_TYPE_UINT32>, 10},
+    };
+    return kernels;
+}
+
+}  // namespace bench
@@ -797,6 +797,74 @@ TEST_F(NegativeCommand, ExecuteCommandsPrimaryCB) {
     m_commandBuffer->end();
 }
 
+// Large batches of secondaries are validated on the device thread pool, the messages must still come in pCommandBuffers order
+TEST_F(NegativeCommand, ExecuteCommandsPrimaryCBLargeBatch) {
+    AddRequiredExtensions(VK_EXT_DEBUG_UTILS_EXTENSION_NAME);
+    RETURN_IF_SKIP(Init());
+
+    vkt::CommandBuffer secondary_cb(*m_device, m_command_pool, VK_COMMAND_BUFFER_LEVEL_SECONDARY);
+    secondary_cb.begin(VK_COMMAND_BUFFER_USAGE_SIMULTANEOUS_USE_BIT);
+    secondary_cb.end();
+
+    constexpr uint32_t kCommandBufferCount = 256;
+    constexpr uint32_t kInvalidStride = 16;
+    // Distinct primaries, a duplicated one would also be reported as 00093
+    std::vector<vkt::CommandBuffer> primary_cbs;
+    std::vector<VkCommandBuffer> command_buffers(kCommandBufferCount, secondary_cb.handle());
+    std::vector<std::string> expected;
+    for (uint32_t i = 0; i < kCommandBufferCount; i += kInvalidStride) {
+        primary_cbs.emplace_back(*m_device, m_command_pool);
+        primary_cbs.back().begin();
+        primary_cbs.back().end();
+        command_buffers[i] = primary_cbs.back().handle();
+        expected.emplace_back("pCommandBuffers[" + std::to_string(i) + "]");
+    }
+
+    std::vector<std::string> reported;
+    DebugUtilsLabelCheckData callback_data;
+    callback_data.count = 0;
+    callback_data.callback = [&reported](const VkDebugUtilsMessengerCallbackDataEXT *pCallbackData, DebugUtilsLabelCheckData *) {
+        reported.emplace_back(pCallbackData->pMessage);
+    };
+    VkDebugUtilsMessengerCreateInfoEXT callback_create_info = vku::InitStructHelper();
+    callback_create_info.messageSeverity = VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT;
+    callback_create_info.messageType = VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT;
+    callback_create_info.pfnUserCallback = DebugUtilsCallback;
+    callback_create_info.pUserData = &callback_data;
+    VkDebugUtilsMessengerEXT messenger = VK_NULL_HANDLE;
+    vk::CreateDebugUtilsMessengerEXT(instance(), &callback_create_info, nullptr, &messenger);
+
+    m_commandBuffer->begin();
+    m_errorMonitor->SetDesiredError("VUID-vkCmdExecuteCommands-pCommandBuffers-00088", kCommandBufferCount / kInvalidStride);
+    vk::CmdExecuteCommands(m_commandBuffer->handle(), kCommandBufferCount, command_buffers.data());
+    m_errorMonitor->VerifyFound();
+    m_commandBuffer->end();
+    vk::DestroyDebugUtilsMessengerEXT(instance(), messenger, nullptr);
+
+    ASSERT_EQ(expected.size(), reported.size());
+    for (size_t i = 0; i < expected.size(); i++) {
+        ASSERT_NE(std::string::npos, reported[i].find(expected[i])) << reported[i];
+    }
+}
+
+TEST_F(NegativeCommand, ExecuteCommandsDuplicatePrimaryCB) {
+    TEST_DESCRIPTION("Execute the same primary command buffer twice, without VK_COMMAND_BUFFER_USAGE_SIMULTANEOUS_USE_BIT");
+
+    RETURN_IF_SKIP(Init());
+
+    vkt::CommandBuffer cb(*m_device, m_command_pool);
+    cb.begin();
+    cb.end();
+    VkCommandBuffer handles[2] = {cb.handle(), cb.handle()};
+
+    m_commandBuffer->begin();
+    m_errorMonitor->SetDesiredError("VUID-vkCmdExecuteCommands-pCommandBuffers-00088", 2);
+    m_errorMonitor->SetDesiredError("VUID-vkCmdExecuteCommands-pCommandBuffers-00093");
+    vk::CmdExecuteCommands(m_commandBuffer->handle(), 2, handles);
+    m_errorMonitor->VerifyFound();
+    m_commandBuffer->end();
+}
+
 TEST_F(NegativeCommand, SimultaneousUseOneShot) {
     TEST_DESCRIPTION("Submit the same command buffer twice in one submit looking for simultaneous use and one time submit errors");
     const char *simultaneous_use_message = "is already in use and is not marked for simultaneous use";
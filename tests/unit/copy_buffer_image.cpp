@@ -2896,6 +2896,38 @@ TEST_F(NegativeCopyBufferImage, OverlappingImage) {
     m_commandBuffer->end();
 }
 
+TEST_F(NegativeCopyBufferImage, OverlappingImageManyRegions) {
+    TEST_DESCRIPTION("Copy columns of the top half of an image to the bottom half, with one region overlapping itself");
+
+    RETURN_IF_SKIP(Init());
+
+    vkt::Image image(*m_device, 64, 64, 1, VK_FORMAT_R8G8B8A8_UNORM,
+                     VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT);
+    image.SetLayout(VK_IMAGE_LAYOUT_GENERAL);
+
+    m_commandBuffer->begin();
+
+    std::vector<VkImageCopy> image_copies(16);
+    for (uint32_t i = 0; i < 16; ++i) {
+        VkImageCopy &image_copy = image_copies[i];
+        image_copy.srcSubresource = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 0, 1};
+        image_copy.srcOffset = {static_cast<int32_t>(i * 4), 0, 0};
+        image_copy.dstSubresource = image_copy.srcSubresource;
+        image_copy.dstOffset = {static_cast<int32_t>(i * 4), 32, 0};
+        image_copy.extent = {4, 32, 1};
+    }
+    vk::CmdCopyImage(m_commandBuffer->handle(), image, VK_IMAGE_LAYOUT_GENERAL, image, VK_IMAGE_LAYOUT_GENERAL,
+                     size32(image_copies), image_copies.data());
+
+    image_copies[9].dstOffset.y = 16;
+    m_errorMonitor->SetDesiredError("VUID-vkCmdCopyImage-pRegions-00124");
+    vk::CmdCopyImage(m_commandBuffer->handle(), image, VK_IMAGE_LAYOUT_GENERAL, image, VK_IMAGE_LAYOUT_GENERAL,
+                     size32(image_copies), image_copies.data());
+    m_errorMonitor->VerifyFound();
+
+    m_commandBuffer->end();
+}
+
 TEST_F(NegativeCopyBufferImage, MinImageTransferGranularity) {
     TEST_DESCRIPTION("Tests for validation of Queue Family property minImageTransferGranularity.");
     RETURN_IF_SKIP(Init());
@@ -3148,3 +3180,28 @@ TEST_F(NegativeCopyBufferImage, InterleavedRegions) {
 
     m_commandBuffer->end();
 }
+
+TEST_F(NegativeCopyBufferImage, InterleavedRegionsMany) {
+    TEST_DESCRIPTION("Test copying between many interleaved source and destination regions, with a single overlap.");
+    RETURN_IF_SKIP(Init());
+
+    std::vector<VkBufferCopy> copy_infos(256);
+    for (uint32_t i = 0; i < 256; ++i) {
+        // Regions are listed in reverse memory order
+        const VkDeviceSize offset = (255 - i) * 8;
+        copy_infos[i] = {offset, offset + 4, 4};
+    }
+
+    vkt::Buffer buffer(*m_device, 2048, VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT, 0);
+
+    m_commandBuffer->begin();
+
+    vk::CmdCopyBuffer(m_commandBuffer->handle(), buffer.handle(), buffer.handle(), size32(copy_infos), copy_infos.data());
+
+    copy_infos[100].dstOffset = copy_infos[101].srcOffset + 2;
+    m_errorMonitor->SetDesiredError("VUID-vkCmdCopyBuffer-pRegions-00117");
+    vk::CmdCopyBuffer(m_commandBuffer->handle(), buffer.handle(), buffer.handle(), size32(copy_infos), copy_infos.data());
+    m_errorMonitor->VerifyFound();
+
+    m_commandBuffer->end();
+}
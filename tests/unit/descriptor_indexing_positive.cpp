@@ -115,6 +115,80 @@ TEST_F(PositiveDescriptorIndexing, BindingPartiallyBound) {
     m_default_queue->Wait();
 }
 
+TEST_F(PositiveDescriptorIndexing, PartiallyBoundDestroyReferencedBuffer) {
+    TEST_DESCRIPTION("Destroy a buffer referenced by both a regular and a PARTIALLY_BOUND binding of the same set");
+    SetTargetApiVersion(VK_API_VERSION_1_1);
+    AddRequiredExtensions(VK_EXT_DESCRIPTOR_INDEXING_EXTENSION_NAME);
+    AddRequiredFeature(vkt::Feature::descriptorBindingPartiallyBound);
+    RETURN_IF_SKIP(Init());
+
+    VkDescriptorBindingFlagsEXT ds_binding_flags[2] = {0, VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT_EXT};
+    VkDescriptorSetLayoutBindingFlagsCreateInfoEXT layout_createinfo_binding_flags = vku::InitStructHelper();
+    layout_createinfo_binding_flags.bindingCount = 2;
+    layout_createinfo_binding_flags.pBindingFlags = ds_binding_flags;
+
+    OneOffDescriptorSet descriptor_set(m_device,
+                                       {
+                                           {0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1, VK_SHADER_STAGE_ALL, nullptr},
+                                           {1, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 64, VK_SHADER_STAGE_ALL, nullptr},
+                                       },
+                                       0, &layout_createinfo_binding_flags, 0);
+
+    vkt::Buffer buffer(*m_device, 32, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT);
+    descriptor_set.WriteDescriptorBufferInfo(0, buffer.handle(), 0, VK_WHOLE_SIZE);
+    for (uint32_t i = 0; i < 64; ++i) {
+        descriptor_set.WriteDescriptorBufferInfo(1, buffer.handle(), 0, VK_WHOLE_SIZE, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, i);
+    }
+    descriptor_set.UpdateDescriptorSets();
+
+    buffer.destroy();
+
+    vkt::Buffer other_buffer(*m_device, 32, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT);
+    descriptor_set.Clear();
+    descriptor_set.WriteDescriptorBufferInfo(0, other_buffer.handle(), 0, VK_WHOLE_SIZE);
+    descriptor_set.UpdateDescriptorSets();
+}
+
+TEST_F(PositiveDescriptorIndexing, PartiallyBoundCopyDestroyReferencedBuffer) {
+    TEST_DESCRIPTION("Copy a descriptor from a regular binding into a PARTIALLY_BOUND one, then destroy the buffer it references");
+    SetTargetApiVersion(VK_API_VERSION_1_1);
+    AddRequiredExtensions(VK_EXT_DESCRIPTOR_INDEXING_EXTENSION_NAME);
+    AddRequiredFeature(vkt::Feature::descriptorBindingPartiallyBound);
+    RETURN_IF_SKIP(Init());
+
+    OneOffDescriptorSet src_set(m_device, {{0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1, VK_SHADER_STAGE_ALL, nullptr}});
+
+    VkDescriptorBindingFlagsEXT ds_binding_flags = VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT_EXT;
+    VkDescriptorSetLayoutBindingFlagsCreateInfoEXT layout_createinfo_binding_flags = vku::InitStructHelper();
+    layout_createinfo_binding_flags.bindingCount = 1;
+    layout_createinfo_binding_flags.pBindingFlags = &ds_binding_flags;
+    OneOffDescriptorSet dst_set(m_device, {{0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1, VK_SHADER_STAGE_ALL, nullptr}}, 0,
+                                &layout_createinfo_binding_flags, 0);
+    const vkt::PipelineLayout pipeline_layout(*m_device, {&dst_set.layout_});
+
+    vkt::Buffer buffer(*m_device, 32, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT);
+    src_set.WriteDescriptorBufferInfo(0, buffer.handle(), 0, VK_WHOLE_SIZE);
+    src_set.UpdateDescriptorSets();
+
+    VkCopyDescriptorSet copy_ds_update = vku::InitStructHelper();
+    copy_ds_update.srcSet = src_set.set_;
+    copy_ds_update.srcBinding = 0;
+    copy_ds_update.dstSet = dst_set.set_;
+    copy_ds_update.dstBinding = 0;
+    copy_ds_update.descriptorCount = 1;
+    vk::UpdateDescriptorSets(device(), 0, nullptr, 1, &copy_ds_update);
+
+    m_commandBuffer->begin();
+    vk::CmdBindDescriptorSets(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline_layout.handle(), 0, 1,
+                              &dst_set.set_, 0, nullptr);
+    m_commandBuffer->end();
+
+    // The copied descriptor is in a PARTIALLY_BOUND binding, destroying its buffer must not invalidate the command buffer
+    buffer.destroy();
+    m_default_queue->Submit(*m_commandBuffer);
+    m_default_queue->Wait();
+}
+
 TEST_F(PositiveDescriptorIndexing, UpdateAfterBind) {
     TEST_DESCRIPTION("Test UPDATE_AFTER_BIND does not reset command buffers.");
 
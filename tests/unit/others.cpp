@@ -254,6 +254,67 @@ TEST_F(VkLayerTest, DuplicateMessageLimit) {
     vk::GetPhysicalDeviceProperties2KHR(gpu(), &properties2);
 }
 
+TEST_F(VkLayerTest, DuplicateMessageLimitSummary) {
+    TEST_DESCRIPTION("Messages dropped by duplicate_message_limit are summarized when a device is destroyed");
+    AddRequiredExtensions(VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME);
+
+    uint32_t value = 3;
+    const VkLayerSettingEXT setting = {OBJECT_LAYER_NAME, "duplicate_message_limit", VK_LAYER_SETTING_TYPE_UINT32_EXT, 1, &value};
+    VkLayerSettingsCreateInfoEXT create_info = {VK_STRUCTURE_TYPE_LAYER_SETTINGS_CREATE_INFO_EXT, nullptr, 1, &setting};
+
+    RETURN_IF_SKIP(InitFramework(&create_info));
+    RETURN_IF_SKIP(InitState());
+
+    std::vector<std::string> summaries;
+    DebugUtilsLabelCheckData callback_data;
+    callback_data.count = 0;
+    callback_data.callback = [&summaries](const VkDebugUtilsMessengerCallbackDataEXT *pCallbackData, DebugUtilsLabelCheckData *) {
+        if (std::string_view(pCallbackData->pMessageIdName) == "UNASSIGNED-DuplicateMessageLimit-Summary") {
+            summaries.emplace_back(pCallbackData->pMessage);
+        }
+    };
+    VkDebugUtilsMessengerCreateInfoEXT callback_create_info = vku::InitStructHelper();
+    callback_create_info.messageSeverity = VK_DEBUG_UTILS_MESSAGE_SEVERITY_INFO_BIT_EXT;
+    callback_create_info.messageType = VK_DEBUG_UTILS_MESSAGE_TYPE_GENERAL_BIT_EXT | VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT;
+    callback_create_info.pfnUserCallback = DebugUtilsCallback;
+    callback_create_info.pUserData = &callback_data;
+    VkDebugUtilsMessengerEXT messenger = VK_NULL_HANDLE;
+    vk::CreateDebugUtilsMessengerEXT(instance(), &callback_create_info, nullptr, &messenger);
+
+    VkBaseOutStructure bogus_struct{};
+    bogus_struct.sType = static_cast<VkStructureType>(0x33333333);
+    VkPhysicalDeviceProperties2KHR properties2 = vku::InitStructHelper(&bogus_struct);
+
+    // The first three are reported, the next two are dropped
+    m_errorMonitor->SetDesiredError("VUID-VkPhysicalDeviceProperties2-pNext-pNext", 3);
+    for (uint32_t i = 0; i < 5; ++i) {
+        vk::GetPhysicalDeviceProperties2KHR(gpu(), &properties2);
+    }
+    m_errorMonitor->VerifyFound();
+
+    // Destroying any device reports the messages dropped since the last summary
+    const float priority = 1.0f;
+    VkDeviceQueueCreateInfo queue_info = vku::InitStructHelper();
+    queue_info.queueFamilyIndex = 0;
+    queue_info.queueCount = 1;
+    queue_info.pQueuePriorities = &priority;
+    VkDeviceCreateInfo device_ci = vku::InitStructHelper();
+    device_ci.queueCreateInfoCount = 1;
+    device_ci.pQueueCreateInfos = &queue_info;
+    VkDevice second_device = VK_NULL_HANDLE;
+    ASSERT_EQ(VK_SUCCESS, vk::CreateDevice(gpu(), &device_ci, nullptr, &second_device));
+    vk::DestroyDevice(second_device, nullptr);
+
+    // Nothing was dropped since, so there is no second summary
+    ASSERT_EQ(VK_SUCCESS, vk::CreateDevice(gpu(), &device_ci, nullptr, &second_device));
+    vk::DestroyDevice(second_device, nullptr);
+    vk::DestroyDebugUtilsMessengerEXT(instance(), messenger, nullptr);
+
+    ASSERT_EQ(1u, summaries.size());
+    ASSERT_NE(std::string::npos, summaries[0].find("2 messages were not reported")) << summaries[0];
+    ASSERT_NE(std::string::npos, summaries[0].find("VUID-VkPhysicalDeviceProperties2-pNext-pNext: 2")) << summaries[0];
+}
+
 TEST_F(VkLayerTest, VuidCheckForHashCollisions) {
     TEST_DESCRIPTION("Ensure there are no VUID hash collisions");
 
@@ -269,6 +330,16 @@ TEST_F(VkLayerTest, VuidCheckForHashCollisions) {
     ASSERT_TRUE(it == hashes.end());
 }
 
+TEST_F(VkLayerTest, VuidSpecTextSorted) {
+    TEST_DESCRIPTION("Ensure the VUID spec text table is sorted, spec text lookups rely on a binary search");
+
+    const auto it = std::adjacent_find(std::begin(vuid_spec_text), std::end(vuid_spec_text),
+                                       [](const vuid_spec_text_pair &lhs, const vuid_spec_text_pair &rhs) {
+                                           return std::string_view(lhs.vuid) >= std::string_view(rhs.vuid);
+                                       });
+    ASSERT_TRUE(it == std::end(vuid_spec_text));
+}
+
 TEST_F(VkLayerTest, VuidHashStability) {
     TEST_DESCRIPTION("Ensure stability of VUID hashes clients rely on for filtering");
     ASSERT_TRUE(hash_util::VuidHash("VUID-VkRenderPassCreateInfo-pNext-01963") == 0xa19880e3);
@@ -1001,6 +1001,68 @@ TEST_F(NegativePipeline, MissingEntrypoint) {
     }
 }
 
+// Large batches are validated on the device thread pool. Each invalid pipeline must still be reported once, and in pCreateInfos
+// order. The worker count only depends on the batch size, so this splits the batch on any machine.
+TEST_F(NegativePipeline, MissingEntrypointLargeBatch) {
+    AddRequiredExtensions(VK_EXT_DEBUG_UTILS_EXTENSION_NAME);
+    RETURN_IF_SKIP(Init());
+
+    CreateComputePipelineHelper valid_pipe(*this);
+    valid_pipe.LateBindPipelineInfo();
+    CreateComputePipelineHelper missing_entrypoint_pipe(*this);
+    missing_entrypoint_pipe.cs_ = std::make_unique<VkShaderObj>(this, kMinimalShaderGlsl, VK_SHADER_STAGE_COMPUTE_BIT,
+                                                                SPV_ENV_VULKAN_1_0, SPV_SOURCE_GLSL, nullptr, "foo");
+    missing_entrypoint_pipe.LateBindPipelineInfo();
+
+    // Entry offset is greater than dataSize
+    const VkSpecializationMapEntry entry = {0, 5, sizeof(uint32_t)};
+    uint32_t data = 1;
+    const VkSpecializationInfo specialization_info = {1, &entry, sizeof(uint32_t), &data};
+    CreateComputePipelineHelper bad_specialization_pipe(*this);
+    bad_specialization_pipe.LateBindPipelineInfo();
+    bad_specialization_pipe.cp_ci_.stage.pSpecializationInfo = &specialization_info;
+
+    constexpr uint32_t kPipelineCount = 128;
+    constexpr uint32_t kInvalidStride = 16;
+    constexpr uint32_t kInvalidCount = kPipelineCount / kInvalidStride;
+    std::vector<VkComputePipelineCreateInfo> create_infos(kPipelineCount, valid_pipe.cp_ci_);
+    std::vector<std::pair<std::string, std::string>> expected;  // VUID and the create info it is reported for
+    for (uint32_t i = 0; i < kPipelineCount; i += kInvalidStride) {
+        const bool missing_entrypoint = (i / kInvalidStride) % 2 == 0;
+        create_infos[i] = missing_entrypoint ? missing_entrypoint_pipe.cp_ci_ : bad_specialization_pipe.cp_ci_;
+        expected.emplace_back(missing_entrypoint ? "VUID-VkPipelineShaderStageCreateInfo-pName-00707"
+                                                 : "VUID-VkSpecializationInfo-offset-00773",
+                              "pCreateInfos[" + std::to_string(i) + "]");
+    }
+
+    std::vector<std::pair<std::string, std::string>> reported;
+    DebugUtilsLabelCheckData callback_data;
+    callback_data.count = 0;
+    callback_data.callback = [&reported](const VkDebugUtilsMessengerCallbackDataEXT *pCallbackData, DebugUtilsLabelCheckData *) {
+        reported.emplace_back(pCallbackData->pMessageIdName, pCallbackData->pMessage);
+    };
+    VkDebugUtilsMessengerCreateInfoEXT callback_create_info = vku::InitStructHelper();
+    callback_create_info.messageSeverity = VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT;
+    callback_create_info.messageType = VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT;
+    callback_create_info.pfnUserCallback = DebugUtilsCallback;
+    callback_create_info.pUserData = &callback_data;
+    VkDebugUtilsMessengerEXT messenger = VK_NULL_HANDLE;
+    vk::CreateDebugUtilsMessengerEXT(instance(), &callback_create_info, nullptr, &messenger);
+
+    std::vector<VkPipeline> pipelines(kPipelineCount, VK_NULL_HANDLE);
+    m_errorMonitor->SetDesiredError("VUID-VkPipelineShaderStageCreateInfo-pName-00707", kInvalidCount / 2);
+    m_errorMonitor->SetDesiredError("VUID-VkSpecializationInfo-offset-00773", kInvalidCount / 2);
+    vk::CreateComputePipelines(device(), VK_NULL_HANDLE, kPipelineCount, create_infos.data(), nullptr, pipelines.data());
+    m_errorMonitor->VerifyFound();
+    vk::DestroyDebugUtilsMessengerEXT(instance(), messenger, nullptr);
+
+    ASSERT_EQ(expected.size(), reported.size());
+    for (size_t i = 0; i < expected.size(); i++) {
+        ASSERT_EQ(expected[i].first, reported[i].first);
+        ASSERT_NE(std::string::npos, reported[i].second.find(expected[i].second)) << reported[i].second;
+    }
+}
+
 TEST_F(NegativePipeline, DepthStencilRequired) {
     m_errorMonitor->SetDesiredError("VUID-VkGraphicsPipelineCreateInfo-renderPass-09028");
 
@@ -166,6 +166,40 @@ TEST_F(PositiveQuery, BasicQuery) {
     m_default_queue->Wait();
 }
 
+TEST_F(PositiveQuery, ResubmitAfterReRecording) {
+    TEST_DESCRIPTION("Query states replayed for a command buffer must not be reused once it is recorded again");
+    RETURN_IF_SKIP(Init());
+
+    vkt::QueryPool query_pool(*m_device, VK_QUERY_TYPE_OCCLUSION, 2);
+
+    // Query 0 ends up available, query 1 reset
+    m_commandBuffer->begin();
+    vk::CmdResetQueryPool(*m_commandBuffer, query_pool, 0, 2);
+    vk::CmdBeginQuery(*m_commandBuffer, query_pool, 0, 0);
+    vk::CmdEndQuery(*m_commandBuffer, query_pool, 0);
+    m_commandBuffer->end();
+    m_default_queue->Submit(*m_commandBuffer);
+    m_default_queue->Wait();
+
+    // Same number of query updates, but query 0 ends up reset and query 1 available
+    m_commandBuffer->begin();
+    vk::CmdResetQueryPool(*m_commandBuffer, query_pool, 0, 2);
+    vk::CmdBeginQuery(*m_commandBuffer, query_pool, 1, 0);
+    vk::CmdEndQuery(*m_commandBuffer, query_pool, 1);
+    m_commandBuffer->end();
+    m_default_queue->Submit(*m_commandBuffer);
+    m_default_queue->Wait();
+
+    // Query 0 can only be begun without a reset if the states of the second recording were applied
+    vkt::CommandBuffer cb(*m_device, m_command_pool);
+    cb.begin();
+    vk::CmdBeginQuery(cb, query_pool, 0, 0);
+    vk::CmdEndQuery(cb, query_pool, 0);
+    cb.end();
+    m_default_queue->Submit(cb);
+    m_default_queue->Wait();
+}
+
 TEST_F(PositiveQuery, DestroyQueryPoolBasedOnQueryPoolResults) {
     TEST_DESCRIPTION("Destroy a QueryPool based on vkGetQueryPoolResults");
     RETURN_IF_SKIP(Init());
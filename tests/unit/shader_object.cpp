@@ -7053,3 +7053,81 @@ TEST_F(NegativeShaderObject, DispatchBaseFlag) {
     m_errorMonitor->VerifyFound();
     m_commandBuffer->end();
 }
+
+TEST_F(NegativeShaderObject, DeferredSpirvValidationBindShaders) {
+    TEST_DESCRIPTION("With check_shaders_async, spirv-val errors are reported when the shader is first bound");
+    SetTargetApiVersion(VK_API_VERSION_1_1);
+    AddRequiredExtensions(VK_EXT_SHADER_OBJECT_EXTENSION_NAME);
+    AddRequiredExtensions(VK_KHR_DYNAMIC_RENDERING_EXTENSION_NAME);
+    AddRequiredFeature(vkt::Feature::dynamicRendering);
+    AddRequiredFeature(vkt::Feature::shaderObject);
+    const VkBool32 value = true;
+    const VkLayerSettingEXT setting = {OBJECT_LAYER_NAME, "check_shaders_async", VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1, &value};
+    VkLayerSettingsCreateInfoEXT layer_settings_create_info = {VK_STRUCTURE_TYPE_LAYER_SETTINGS_CREATE_INFO_EXT, nullptr, 1,
+                                                               &setting};
+    RETURN_IF_SKIP(InitFramework(&layer_settings_create_info));
+    RETURN_IF_SKIP(InitState());
+
+    // GLCompute entry point without a LocalSize
+    const char *spv_source = R"(
+               OpCapability Shader
+               OpMemoryModel Logical GLSL450
+               OpEntryPoint GLCompute %main "main"
+       %void = OpTypeVoid
+          %3 = OpTypeFunction %void
+       %main = OpFunction %void None %3
+          %5 = OpLabel
+               OpReturn
+               OpFunctionEnd
+        )";
+    std::vector<uint32_t> spv;
+    ASMtoSPV(SPV_ENV_VULKAN_1_1, 0, spv_source, spv);
+
+    // Creating the shader does not wait for spirv-val
+    const vkt::Shader comp_shader(*m_device, VK_SHADER_STAGE_COMPUTE_BIT, spv);
+
+    m_commandBuffer->begin();
+    m_errorMonitor->SetDesiredError("VUID-VkShaderCreateInfoEXT-pCode-08737");
+    m_commandBuffer->BindCompShader(comp_shader);
+    m_errorMonitor->VerifyFound();
+
+    // The errors of a shader are only reported once, binding it again reports nothing
+    m_commandBuffer->BindCompShader(comp_shader);
+    m_commandBuffer->end();
+}
+
+TEST_F(NegativeShaderObject, DeferredSpirvValidationDestroyShader) {
+    TEST_DESCRIPTION("With check_shaders_async, spirv-val errors of a shader never bound are reported when it is destroyed");
+    SetTargetApiVersion(VK_API_VERSION_1_1);
+    AddRequiredExtensions(VK_EXT_SHADER_OBJECT_EXTENSION_NAME);
+    AddRequiredExtensions(VK_KHR_DYNAMIC_RENDERING_EXTENSION_NAME);
+    AddRequiredFeature(vkt::Feature::dynamicRendering);
+    AddRequiredFeature(vkt::Feature::shaderObject);
+    const VkBool32 value = true;
+    const VkLayerSettingEXT setting = {OBJECT_LAYER_NAME, "check_shaders_async", VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1, &value};
+    VkLayerSettingsCreateInfoEXT layer_settings_create_info = {VK_STRUCTURE_TYPE_LAYER_SETTINGS_CREATE_INFO_EXT, nullptr, 1,
+                                                               &setting};
+    RETURN_IF_SKIP(InitFramework(&layer_settings_create_info));
+    RETURN_IF_SKIP(InitState());
+
+    // GLCompute entry point without a LocalSize
+    const char *spv_source = R"(
+               OpCapability Shader
+               OpMemoryModel Logical GLSL450
+               OpEntryPoint GLCompute %main "main"
+       %void = OpTypeVoid
+          %3 = OpTypeFunction %void
+       %main = OpFunction %void None %3
+          %5 = OpLabel
+               OpReturn
+               OpFunctionEnd
+        )";
+    std::vector<uint32_t> spv;
+    ASMtoSPV(SPV_ENV_VULKAN_1_1, 0, spv_source, spv);
+
+    vkt::Shader comp_shader(*m_device, VK_SHADER_STAGE_COMPUTE_BIT, spv);
+
+    m_errorMonitor->SetDesiredError("VUID-VkShaderCreateInfoEXT-pCode-08737");
+    comp_shader.destroy();
+    m_errorMonitor->VerifyFound();
+}
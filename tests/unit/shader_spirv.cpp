@@ -2477,4 +2477,201 @@ TEST_F(NegativeShaderSpirv, ScalarBlockLayoutShaderCache) {
     m_errorMonitor->SetDesiredError("VUID-VkShaderModuleCreateInfo-pCode-08737");
     VkShaderObj cs(this, cs_source, VK_SHADER_STAGE_COMPUTE_BIT, SPV_ENV_VULKAN_1_2);
     m_errorMonitor->VerifyFound();
-}
\ No newline at end of file
+}
+
+TEST_F(NegativeShaderSpirv, DeferredSpirvValidation) {
+    TEST_DESCRIPTION("With check_shaders_async, spirv-val errors are reported when the shader module is first used");
+    SetTargetApiVersion(VK_API_VERSION_1_0);
+    const VkBool32 value = true;
+    const VkLayerSettingEXT setting = {OBJECT_LAYER_NAME, "check_shaders_async", VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1, &value};
+    VkLayerSettingsCreateInfoEXT layer_settings_create_info = {VK_STRUCTURE_TYPE_LAYER_SETTINGS_CREATE_INFO_EXT, nullptr, 1,
+                                                               &setting};
+    RETURN_IF_SKIP(InitFramework(&layer_settings_create_info));
+    RETURN_IF_SKIP(InitState());
+    if (DeviceValidationVersion() > VK_API_VERSION_1_0) {
+        GTEST_SKIP() << "Tests for 1.0 only";
+    }
+
+    // layout(std430, set = 0, binding = 0) uniform ubo430 {
+    //     float floatArray430[8];
+    // };
+    const char *spv_source = R"(
+               OpCapability Shader
+          %1 = OpExtInstImport "GLSL.std.450"
+               OpMemoryModel Logical GLSL450
+               OpEntryPoint GLCompute %main "main"
+               OpExecutionMode %main LocalSize 1 1 1
+               OpSource GLSL 450
+               OpDecorate %_arr_float_uint_8 ArrayStride 4
+               OpMemberDecorate %ubo430 0 Offset 0
+               OpDecorate %ubo430 Block
+               OpDecorate %_ DescriptorSet 0
+               OpDecorate %_ Binding 0
+       %void = OpTypeVoid
+          %3 = OpTypeFunction %void
+      %float = OpTypeFloat 32
+       %uint = OpTypeInt 32 0
+     %uint_8 = OpConstant %uint 8
+%_arr_float_uint_8 = OpTypeArray %float %uint_8
+     %ubo430 = OpTypeStruct %_arr_float_uint_8
+%_ptr_Uniform_ubo430 = OpTypePointer Uniform %ubo430
+          %_ = OpVariable %_ptr_Uniform_ubo430 Uniform
+       %main = OpFunction %void None %3
+          %5 = OpLabel
+               OpReturn
+               OpFunctionEnd
+        )";
+
+    // Creating the module does not wait for spirv-val
+    CreateComputePipelineHelper pipe(*this);
+    pipe.cs_ = std::make_unique<VkShaderObj>(this, spv_source, VK_SHADER_STAGE_COMPUTE_BIT, SPV_ENV_VULKAN_1_0, SPV_SOURCE_ASM);
+
+    m_errorMonitor->SetDesiredError("VUID-VkShaderModuleCreateInfo-pCode-08737");
+    pipe.CreateComputePipeline();
+    m_errorMonitor->VerifyFound();
+
+    // The errors of a module are only reported once, using it again reports nothing
+    CreateComputePipelineHelper pipe2(*this);
+    pipe2.LateBindPipelineInfo();
+    pipe2.cp_ci_.stage = pipe.cs_->GetStageCreateInfo();
+    pipe2.CreateComputePipeline(false);
+}
+
+TEST_F(NegativeShaderSpirv, DeferredSpirvValidationDestroyShaderModule) {
+    TEST_DESCRIPTION("With check_shaders_async, spirv-val errors of a shader module never used are reported when it is destroyed");
+    const VkBool32 value = true;
+    const VkLayerSettingEXT setting = {OBJECT_LAYER_NAME, "check_shaders_async", VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1, &value};
+    VkLayerSettingsCreateInfoEXT layer_settings_create_info = {VK_STRUCTURE_TYPE_LAYER_SETTINGS_CREATE_INFO_EXT, nullptr, 1,
+                                                               &setting};
+    RETURN_IF_SKIP(InitFramework(&layer_settings_create_info));
+    RETURN_IF_SKIP(InitState());
+
+    // GLCompute entry point without a LocalSize
+    const char *spv_source = R"(
+               OpCapability Shader
+               OpMemoryModel Logical GLSL450
+               OpEntryPoint GLCompute %main "main"
+       %void = OpTypeVoid
+          %3 = OpTypeFunction %void
+       %main = OpFunction %void None %3
+          %5 = OpLabel
+               OpReturn
+               OpFunctionEnd
+        )";
+
+    VkShaderObj cs(this, spv_source, VK_SHADER_STAGE_COMPUTE_BIT, SPV_ENV_VULKAN_1_0, SPV_SOURCE_ASM);
+
+    m_errorMonitor->SetDesiredError("VUID-VkShaderModuleCreateInfo-pCode-08737");
+    cs.destroy();
+    m_errorMonitor->VerifyFound();
+}
+
+TEST_F(NegativeShaderSpirv, DeferredSpirvValidationDestroyDevice) {
+    TEST_DESCRIPTION("With check_shaders_async, spirv-val errors of the shader modules never used are reported at vkDestroyDevice");
+    SetTargetApiVersion(VK_API_VERSION_1_0);
+    const VkBool32 value = true;
+    const VkLayerSettingEXT setting = {OBJECT_LAYER_NAME, "check_shaders_async", VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1, &value};
+    VkLayerSettingsCreateInfoEXT layer_settings_create_info = {VK_STRUCTURE_TYPE_LAYER_SETTINGS_CREATE_INFO_EXT, nullptr, 1,
+                                                               &setting};
+    RETURN_IF_SKIP(InitFramework(&layer_settings_create_info));
+    if (!IsPlatformMockICD()) {
+        // This test leaks shader modules (on purpose) and should not be run on a real driver
+        GTEST_SKIP() << "This test only runs on the mock ICD";
+    }
+    if (DeviceValidationVersion() > VK_API_VERSION_1_0) {
+        GTEST_SKIP() << "Tests for 1.0 only";
+    }
+
+    // layout(std430, set = 0, binding = 0) uniform ubo430 {
+    //     float floatArray430[8];
+    // };
+    const char *layout_source = R"(
+               OpCapability Shader
+               OpMemoryModel Logical GLSL450
+               OpEntryPoint GLCompute %main "main"
+               OpExecutionMode %main LocalSize 1 1 1
+               OpDecorate %_arr_float_uint_8 ArrayStride 4
+               OpMemberDecorate %ubo430 0 Offset 0
+               OpDecorate %ubo430 Block
+               OpDecorate %_ DescriptorSet 0
+               OpDecorate %_ Binding 0
+       %void = OpTypeVoid
+          %3 = OpTypeFunction %void
+      %float = OpTypeFloat 32
+       %uint = OpTypeInt 32 0
+     %uint_8 = OpConstant %uint 8
+%_arr_float_uint_8 = OpTypeArray %float %uint_8
+     %ubo430 = OpTypeStruct %_arr_float_uint_8
+%_ptr_Uniform_ubo430 = OpTypePointer Uniform %ubo430
+          %_ = OpVariable %_ptr_Uniform_ubo430 Uniform
+       %main = OpFunction %void None %3
+          %5 = OpLabel
+               OpReturn
+               OpFunctionEnd
+        )";
+
+    // GLCompute entry point without a LocalSize
+    const char *local_size_source = R"(
+               OpCapability Shader
+               OpMemoryModel Logical GLSL450
+               OpEntryPoint GLCompute %main "main"
+       %void = OpTypeVoid
+          %3 = OpTypeFunction %void
+       %main = OpFunction %void None %3
+          %5 = OpLabel
+               OpReturn
+               OpFunctionEnd
+        )";
+
+    std::vector<std::string> messages;
+    DebugUtilsLabelCheckData callback_data;
+    callback_data.count = 0;
+    callback_data.callback = [&messages](const VkDebugUtilsMessengerCallbackDataEXT *pCallbackData, DebugUtilsLabelCheckData *) {
+        if (std::string_view(pCallbackData->pMessageIdName) == "VUID-VkShaderModuleCreateInfo-pCode-08737") {
+            messages.emplace_back(pCallbackData->pMessage);
+        }
+    };
+    VkDebugUtilsMessengerCreateInfoEXT callback_create_info = vku::InitStructHelper();
+    callback_create_info.messageSeverity = VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT;
+    callback_create_info.messageType = VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT;
+    callback_create_info.pfnUserCallback = DebugUtilsCallback;
+    callback_create_info.pUserData = &callback_data;
+    VkDebugUtilsMessengerEXT messenger = VK_NULL_HANDLE;
+    vk::CreateDebugUtilsMessengerEXT(instance(), &callback_create_info, nullptr, &messenger);
+
+    const float priority = 1.0f;
+    VkDeviceQueueCreateInfo queue_ci = vku::InitStructHelper();
+    queue_ci.queueFamilyIndex = 0;
+    queue_ci.queueCount = 1;
+    queue_ci.pQueuePriorities = &priority;
+    VkDeviceCreateInfo device_ci = vku::InitStructHelper();
+    device_ci.queueCreateInfoCount = 1;
+    device_ci.pQueueCreateInfos = &queue_ci;
+    VkDevice leaky_device = VK_NULL_HANDLE;
+    ASSERT_EQ(VK_SUCCESS, vk::CreateDevice(gpu(), &device_ci, nullptr, &leaky_device));
+
+    for (const char *source : {layout_source, local_size_source}) {
+        std::vector<uint32_t> spv;
+        ASMtoSPV(SPV_ENV_VULKAN_1_0, 0, source, spv);
+        VkShaderModuleCreateInfo module_ci = vku::InitStructHelper();
+        module_ci.codeSize = spv.size() * sizeof(uint32_t);
+        module_ci.pCode = spv.data();
+        VkShaderModule leaked_module = VK_NULL_HANDLE;
+        ASSERT_EQ(VK_SUCCESS, vk::CreateShaderModule(leaky_device, &module_ci, nullptr, &leaked_module));
+    }
+
+    // Both modules are reported, in the order they were created
+    m_errorMonitor->SetDesiredError("VUID-VkShaderModuleCreateInfo-pCode-08737", 2);
+    m_errorMonitor->SetDesiredError("VUID-vkDestroyDevice-device-05137", 2);
+    vk::DestroyDevice(leaky_device, nullptr);
+    m_errorMonitor->VerifyFound();
+    vk::DestroyDebugUtilsMessengerEXT(instance(), messenger, nullptr);
+
+    ASSERT_EQ(2u, messages.size());
+    ASSERT_EQ(std::string::npos, messages[0].find("LocalSize")) << messages[0];
+    ASSERT_NE(std::string::npos, messages[1].find("LocalSize")) << messages[1];
+
+    // There's no way we can destroy the shader modules at this point
+    m_errorMonitor->SetUnexpectedError("VUID-vkDestroyDevice-device-05137");
+    m_errorMonitor->SetUnexpectedError("VUID-vkDestroyInstance-instance-00629");
+}
@@ -274,6 +274,75 @@ TEST_F(NegativeSparseBuffer, OverlappingBufferCopy) {
     m_default_queue->Wait();
 }
 
+TEST_F(NegativeSparseBuffer, OverlappingBufferCopyPageBinds) {
+    TEST_DESCRIPTION("Bind sparse buffers one page at a time, out of order, and copy between pages sharing device memory");
+
+    AddRequiredFeature(vkt::Feature::sparseBinding);
+    RETURN_IF_SKIP(Init());
+
+    if (m_device->QueuesWithSparseCapability().empty()) {
+        GTEST_SKIP() << "Required SPARSE_BINDING queue families not present";
+    }
+
+    VkBufferCreateInfo b_info =
+        vkt::Buffer::create_info(4 * 65536, VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT, nullptr);
+    b_info.flags = VK_BUFFER_CREATE_SPARSE_BINDING_BIT;
+    vkt::Buffer buffer_sparse(*m_device, b_info, vkt::no_mem);
+    vkt::Buffer buffer_sparse2(*m_device, b_info, vkt::no_mem);
+
+    VkMemoryRequirements buffer_mem_reqs;
+    vk::GetBufferMemoryRequirements(device(), buffer_sparse.handle(), &buffer_mem_reqs);
+    const VkDeviceSize page_size = buffer_mem_reqs.alignment;
+    const uint32_t page_count = static_cast<uint32_t>(buffer_mem_reqs.size / page_size);
+    if (page_count < 4) {
+        GTEST_SKIP() << "Buffer needs at least 4 sparse pages";
+    }
+
+    VkMemoryAllocateInfo buffer_mem_alloc =
+        vkt::DeviceMemory::get_resource_alloc_info(*m_device, buffer_mem_reqs, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+    buffer_mem_alloc.allocationSize = 2 * buffer_mem_reqs.size;
+    vkt::DeviceMemory buffer_mem(*m_device, buffer_mem_alloc);
+
+    // Pages are bound last to first, they still end up as one contiguous binding of buffer_mem.
+    // Only page 2 of buffer_sparse2 shares memory with buffer_sparse.
+    std::vector<VkSparseMemoryBind> binds;
+    std::vector<VkSparseMemoryBind> binds2;
+    for (uint32_t page = page_count; page-- > 0;) {
+        binds.push_back({page * page_size, page_size, buffer_mem.handle(), page * page_size, 0});
+        const VkDeviceSize memory_page = (page == 2) ? page : page_count + page;
+        binds2.push_back({page * page_size, page_size, buffer_mem.handle(), memory_page * page_size, 0});
+    }
+
+    VkSparseBufferMemoryBindInfo buffer_memory_bind_infos[2] = {};
+    buffer_memory_bind_infos[0].buffer = buffer_sparse.handle();
+    buffer_memory_bind_infos[0].bindCount = size32(binds);
+    buffer_memory_bind_infos[0].pBinds = binds.data();
+    buffer_memory_bind_infos[1].buffer = buffer_sparse2.handle();
+    buffer_memory_bind_infos[1].bindCount = size32(binds2);
+    buffer_memory_bind_infos[1].pBinds = binds2.data();
+
+    VkBindSparseInfo bind_info = vku::InitStructHelper();
+    bind_info.bufferBindCount = 2;
+    bind_info.pBufferBinds = buffer_memory_bind_infos;
+
+    VkQueue sparse_queue = m_device->QueuesWithSparseCapability()[0]->handle();
+    vkt::Fence sparse_queue_fence(*m_device);
+    vk::QueueBindSparse(sparse_queue, 1, &bind_info, sparse_queue_fence);
+    ASSERT_EQ(VK_SUCCESS, sparse_queue_fence.wait(kWaitTimeout));
+
+    // Page 0 does not overlap, page 2 does
+    VkBufferCopy copy_infos[2] = {{0, 0, page_size}, {2 * page_size, 2 * page_size, page_size}};
+    m_commandBuffer->begin();
+    vk::CmdCopyBuffer(m_commandBuffer->handle(), buffer_sparse.handle(), buffer_sparse2.handle(), 2, copy_infos);
+    m_commandBuffer->end();
+
+    m_errorMonitor->SetDesiredError("VUID-vkCmdCopyBuffer-pRegions-00117");
+    m_default_queue->Submit(*m_commandBuffer);
+    m_errorMonitor->VerifyFound();
+
+    m_default_queue->Wait();
+}
+
 TEST_F(NegativeSparseBuffer, OverlappingBufferCopy2) {
     TEST_DESCRIPTION("Test overlapping sparse buffers' copy with overlapping device memory");
 
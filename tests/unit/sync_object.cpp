@@ -3163,6 +3163,29 @@ TEST_F(NegativeSyncObject, EventStageMaskOneCommandBufferFail) {
     m_default_queue->Wait();
 }
 
+TEST_F(NegativeSyncObject, EventStageMaskSecondaryCommandBufferFail) {
+    TEST_DESCRIPTION("Event set in a secondary command buffer is waited on with the wrong stage mask in the primary");
+    RETURN_IF_SKIP(Init());
+
+    vkt::Event event(*m_device);
+    vkt::CommandBuffer secondary(*m_device, m_command_pool, VK_COMMAND_BUFFER_LEVEL_SECONDARY);
+    secondary.begin();
+    vk::CmdSetEvent(secondary.handle(), event.handle(), VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT);
+    secondary.end();
+
+    m_commandBuffer->begin();
+    vk::CmdExecuteCommands(m_commandBuffer->handle(), 1, &secondary.handle());
+    // wrong srcStageMask
+    vk::CmdWaitEvents(m_commandBuffer->handle(), 1, &event.handle(), VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+                      VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, 0, nullptr, 0, nullptr, 0, nullptr);
+    m_commandBuffer->end();
+
+    m_errorMonitor->SetDesiredError("VUID-vkCmdWaitEvents-srcStageMask-parameter");
+    m_default_queue->Submit(*m_commandBuffer);
+    m_errorMonitor->VerifyFound();
+    m_default_queue->Wait();
+}
+
 TEST_F(NegativeSyncObject, EventStageMaskTwoCommandBufferPass) {
     RETURN_IF_SKIP(Init());
 
@@ -1089,6 +1089,35 @@ TEST_F(PositiveSyncObject, BasicSetAndWaitEvent) {
     m_device->Wait();
 }
 
+TEST_F(PositiveSyncObject, SetEventAfterReRecording) {
+    TEST_DESCRIPTION("Event states replayed for a command buffer must not be reused once it is recorded again");
+    RETURN_IF_SKIP(Init());
+
+    const vkt::Event event(*m_device);
+
+    m_commandBuffer->begin();
+    vk::CmdSetEvent(*m_commandBuffer, event, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT);
+    m_commandBuffer->end();
+    m_default_queue->Submit(*m_commandBuffer);
+    m_default_queue->Wait();
+
+    // Same number of event updates, with a different stage
+    m_commandBuffer->begin();
+    vk::CmdSetEvent(*m_commandBuffer, event, VK_PIPELINE_STAGE_TRANSFER_BIT);
+    m_commandBuffer->end();
+    m_default_queue->Submit(*m_commandBuffer);
+    m_default_queue->Wait();
+
+    // The source stage of the wait is only valid if the stage set by the second recording was applied
+    vkt::CommandBuffer cb(*m_device, m_command_pool);
+    cb.begin();
+    vk::CmdWaitEvents(cb, 1, &event.handle(), VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, 0, nullptr, 0,
+                      nullptr, 0, nullptr);
+    cb.end();
+    m_default_queue->Submit(cb);
+    m_default_queue->Wait();
+}
+
 TEST_F(PositiveSyncObject, BasicSetAndWaitEvent2) {
     TEST_DESCRIPTION("Sets event and then wait for it using CmdSetEvent2/CmdWaitEvents2");
     SetTargetApiVersion(VK_API_VERSION_1_3);
@@ -1332,6 +1332,49 @@ TEST_F(NegativeSyncVal, CopyBufferImageHazards) {
     m_commandBuffer->end();
 }
 
+TEST_F(NegativeSyncVal, CopyBufferImageLayersPartialBarrier) {
+    TEST_DESCRIPTION("Write all layers of an image in one copy, then only synchronize some of them");
+    RETURN_IF_SKIP(InitSyncValFramework());
+    RETURN_IF_SKIP(InitState());
+
+    constexpr uint32_t kLayerCount = 4;
+    VkBufferUsageFlags transfer_usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+    vkt::Buffer buffer(*m_device, 32 * 32 * 4 * kLayerCount, transfer_usage, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+
+    VkImageUsageFlags usage = VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT;
+    const auto image_ci = vkt::Image::ImageCreateInfo2D(32, 32, 1, kLayerCount, VK_FORMAT_R8G8B8A8_UNORM, usage);
+    vkt::Image image(*m_device, image_ci);
+
+    // One region per layer, the layer ranges written by the copy are adjacent and end up with the same access state
+    std::vector<VkBufferImageCopy> regions(kLayerCount);
+    for (uint32_t layer = 0; layer < kLayerCount; ++layer) {
+        regions[layer] = {layer * 32 * 32 * 4, 32, 32, {VK_IMAGE_ASPECT_COLOR_BIT, 0, layer, 1}, {0, 0, 0}, {32, 32, 1}};
+    }
+
+    m_commandBuffer->begin();
+    image.SetLayout(m_commandBuffer, VK_IMAGE_ASPECT_COLOR_BIT, VK_IMAGE_LAYOUT_GENERAL);
+    auto cb = m_commandBuffer->handle();
+    vk::CmdCopyBufferToImage(cb, buffer.handle(), image.handle(), VK_IMAGE_LAYOUT_GENERAL, size32(regions), regions.data());
+
+    VkImageMemoryBarrier image_barrier = vku::InitStructHelper();
+    image_barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    image_barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    image_barrier.oldLayout = VK_IMAGE_LAYOUT_GENERAL;
+    image_barrier.newLayout = VK_IMAGE_LAYOUT_GENERAL;
+    image_barrier.image = image.handle();
+    image_barrier.subresourceRange = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 2};
+    vk::CmdPipelineBarrier(cb, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0, nullptr, 1,
+                           &image_barrier);
+
+    vk::CmdCopyBufferToImage(cb, buffer.handle(), image.handle(), VK_IMAGE_LAYOUT_GENERAL, 1, &regions[1]);
+
+    m_errorMonitor->SetDesiredError("SYNC-HAZARD-WRITE-AFTER-WRITE");
+    vk::CmdCopyBufferToImage(cb, buffer.handle(), image.handle(), VK_IMAGE_LAYOUT_GENERAL, 1, &regions[3]);
+    m_errorMonitor->VerifyFound();
+
+    m_commandBuffer->end();
+}
+
 TEST_F(NegativeSyncVal, BlitImageHazards) {
     RETURN_IF_SKIP(InitSyncValFramework());
     RETURN_IF_SKIP(InitState());
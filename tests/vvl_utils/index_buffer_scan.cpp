@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+
+#include <algorithm>
+#include <random>
+
+#include "utils/index_buffer_scan.h"
+
+// Straightforward implementation of the LRU cache model, the vectorized one must behave exactly the same
+class ReferenceCacheModel {
+  public:
+    bool Query(uint32_t value) {
+        auto hit = std::find_if(entries_.begin(), entries_.end(), [value](const Entry& entry) { return entry.value == value; });
+        if (hit != entries_.end()) {
+            hit->age = iteration_++;
+            return true;
+        }
+        Entry new_entry = {value, iteration_};
+        if (iteration_ < entries_.size()) {
+            entries_[iteration_] = new_entry;
+        } else {
+            *std::min_element(entries_.begin(), entries_.end(), [](const Entry& a, const Entry& b) { return a.age < b.age; }) =
+                new_entry;
+        }
+        iteration_++;
+        return false;
+    }
+
+  private:
+    struct Entry {
+        uint32_t value;
+        uint32_t age;
+    };
+    std::vector<Entry> entries_ = std::vector<Entry>(index_buffer::PostTransformCacheModel::kSize, Entry{0, 0});
+    uint32_t iteration_ = 0;
+};
+
+template <typename T>
+static void CheckIndexBufferScan(const std::vector<T>& indices, VkIndexType index_type, bool primitive_restart_enable) {
+    const uint32_t index_count = static_cast<uint32_t>(indices.size());
+    uint32_t expected_min = ~0u;
+    uint32_t expected_max = 0u;
+    for (const T index : indices) {
+        expected_min = std::min<uint32_t>(expected_min, index);
+        expected_max = std::max<uint32_t>(expected_max, index);
+    }
+
+    const index_buffer::MinMax range = index_buffer::ScanMinMax(indices.data(), index_count, index_type);
+    ASSERT_EQ(expected_min, range.min);
+    ASSERT_EQ(expected_max, range.max);
+
+    if (range.max <= range.min || range.max - range.min >= index_count) {
+        return;
+    }
+
+    ReferenceCacheModel cache;
+    uint32_t expected_shaded_count = 0;
+    std::vector<bool> referenced(range.max - range.min + 1, false);
+    for (const T index : indices) {
+        if (!primitive_restart_enable || index != std::numeric_limits<T>::max()) {
+            expected_shaded_count += cache.Query(index) ? 0 : 1;
+        }
+        referenced[index - range.min] = true;
+    }
+    const uint32_t expected_referenced_count = static_cast<uint32_t>(std::count(referenced.begin(), referenced.end(), true));
+
+    const index_buffer::VertexReuse reuse =
+        index_buffer::ScanVertexReuse(indices.data(), index_count, index_type, primitive_restart_enable, range);
+    ASSERT_EQ(expected_shaded_count, reuse.shaded_count);
+    ASSERT_EQ(expected_referenced_count, reuse.referenced_count);
+}
+
+template <typename T>
+static std::vector<T> RandomIndices(std::mt19937& rng, uint32_t index_count, uint32_t max_index) {
+    std::vector<T> indices(index_count);
+    for (T& index : indices) {
+        index = static_cast<T>(rng() % (uint64_t(max_index) + 1));
+    }
+    return indices;
+}
+
+TEST(IndexBufferScan, Uint8) {
+    std::mt19937 rng(0);
+    // Cover counts smaller than, equal to and not multiple of the SIMD width
+    for (uint32_t index_count : {0u, 1u, 15u, 16u, 31u, 32u, 33u, 100u, 1000u}) {
+        CheckIndexBufferScan(RandomIndices<uint8_t>(rng, index_count, 0xFF), VK_INDEX_TYPE_UINT8_KHR, false);
+        CheckIndexBufferScan(RandomIndices<uint8_t>(rng, index_count, 0xFF), VK_INDEX_TYPE_UINT8_KHR, true);
+    }
+}
+
+TEST(IndexBufferScan, Uint16) {
+    std::mt19937 rng(0);
+    for (uint32_t index_count : {0u, 1u, 7u, 8u, 17u, 100u, 1000u, 70000u}) {
+        CheckIndexBufferScan(RandomIndices<uint16_t>(rng, index_count, 0xFFFF), VK_INDEX_TYPE_UINT16, false);
+        CheckIndexBufferScan(RandomIndices<uint16_t>(rng, index_count, 0xFFFF), VK_INDEX_TYPE_UINT16, true);
+        CheckIndexBufferScan(RandomIndices<uint16_t>(rng, index_count, 64), VK_INDEX_TYPE_UINT16, false);
+    }
+}
+
+TEST(IndexBufferScan, Uint32) {
+    std::mt19937 rng(0);
+    for (uint32_t index_count : {0u, 1u, 3u, 4u, 9u, 100u, 1000u, 10000u}) {
+        // High values check unsigned comparisons are used
+        CheckIndexBufferScan(RandomIndices<uint32_t>(rng, index_count, 0xFFFFFFFF), VK_INDEX_TYPE_UINT32, false);
+        CheckIndexBufferScan(RandomIndices<uint32_t>(rng, index_count, index_count), VK_INDEX_TYPE_UINT32, false);
+        CheckIndexBufferScan(RandomIndices<uint32_t>(rng, index_count, 100), VK_INDEX_TYPE_UINT32, true);
+    }
+}
+
+TEST(IndexBufferScan, PrimitiveRestart) {
+    // Restart values are part of the range, but do not go through the cache model
+    const std::vector<uint8_t> indices = {250, 251, 252, 0xFF, 252, 253, 254, 0xFF, 250, 254, 253, 0xFF, 251, 250, 252};
+    CheckIndexBufferScan(indices, VK_INDEX_TYPE_UINT8_KHR, true);
+    CheckIndexBufferScan(indices, VK_INDEX_TYPE_UINT8_KHR, false);
+
+    const index_buffer::MinMax range =
+        index_buffer::ScanMinMax(indices.data(), static_cast<uint32_t>(indices.size()), VK_INDEX_TYPE_UINT8_KHR);
+    ASSERT_EQ(250u, range.min);
+    ASSERT_EQ(0xFFu, range.max);
+    const index_buffer::VertexReuse reuse =
+        index_buffer::ScanVertexReuse(indices.data(), static_cast<uint32_t>(indices.size()), VK_INDEX_TYPE_UINT8_KHR, true, range);
+    ASSERT_EQ(6u, reuse.referenced_count);
+}
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+
+#include <vector>
+
+#include "utils/pnext_chain_index.h"
+
+TEST(PnextChainIndex, Empty) {
+    vvl::PnextChainIndex index(nullptr);
+    ASSERT_EQ(0u, index.Size());
+    ASSERT_EQ(nullptr, index.Find<VkPipelineRenderingCreateInfo>());
+}
+
+TEST(PnextChainIndex, Find) {
+    VkPipelineRenderingCreateInfo s1 = vku::InitStructHelper();
+    VkPipelineLibraryCreateInfoKHR s2 = vku::InitStructHelper(&s1);
+    VkPipelineRobustnessCreateInfoEXT s3 = vku::InitStructHelper(&s2);
+
+    vvl::PnextChainIndex index(&s3);
+    ASSERT_EQ(3u, index.Size());
+    ASSERT_EQ(&s1, index.Find<VkPipelineRenderingCreateInfo>());
+    ASSERT_EQ(&s2, index.Find<VkPipelineLibraryCreateInfoKHR>());
+    ASSERT_EQ(&s3, index.Find<VkPipelineRobustnessCreateInfoEXT>());
+    ASSERT_EQ(nullptr, index.Find<VkGraphicsPipelineLibraryCreateInfoEXT>());
+}
+
+// Like vku::FindStructInPNextChain, the first struct of a type is returned
+TEST(PnextChainIndex, Duplicates) {
+    VkPipelineRenderingCreateInfo s1 = vku::InitStructHelper();
+    VkPipelineRenderingCreateInfo s2 = vku::InitStructHelper(&s1);
+
+    vvl::PnextChainIndex index(&s2);
+    ASSERT_EQ(&s2, index.Find<VkPipelineRenderingCreateInfo>());
+    ASSERT_EQ(vku::FindStructInPNextChain<VkPipelineRenderingCreateInfo>(&s2), index.Find<VkPipelineRenderingCreateInfo>());
+}
+
+// Structs past the indexed ones are still found, by walking the rest of the chain
+TEST(PnextChainIndex, LongChain) {
+    std::vector<VkPipelineRobustnessCreateInfoEXT> padding(vvl::PnextChainIndex::kMaxEntries);
+    VkPipelineRenderingCreateInfo last = vku::InitStructHelper();
+    void *chain = &last;
+    for (auto &s : padding) {
+        s = vku::InitStructHelper(chain);
+        chain = &s;
+    }
+
+    vvl::PnextChainIndex index(chain);
+    ASSERT_EQ(vvl::PnextChainIndex::kMaxEntries, index.Size());
+    ASSERT_EQ(&padding.back(), index.Find<VkPipelineRobustnessCreateInfoEXT>());
+    ASSERT_EQ(&last, index.Find<VkPipelineRenderingCreateInfo>());
+    ASSERT_EQ(nullptr, index.Find<VkPipelineLibraryCreateInfoKHR>());
+}
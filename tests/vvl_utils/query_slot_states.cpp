@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+
+#include <map>
+#include <vector>
+
+#include "state_tracker/query_state.h"
+
+static std::map<uint32_t, QueryState> GetStates(const QuerySlotStates &states) {
+    std::map<uint32_t, QueryState> result;
+    states.ForEach([&result](uint32_t slot, QueryState state) { result.emplace(slot, state); });
+    return result;
+}
+
+TEST(QuerySlotStates, Empty) {
+    QuerySlotStates states;
+    ASSERT_TRUE(states.Empty());
+    ASSERT_EQ(QUERYSTATE_UNKNOWN, states.Get(0));
+    ASSERT_EQ(QUERYSTATE_UNKNOWN, states.Get(1000));
+    states.SetRange(10, 0, QUERYSTATE_RESET);
+    ASSERT_TRUE(states.Empty());
+}
+
+TEST(QuerySlotStates, RangeAcrossPages) {
+    constexpr uint32_t kPageSize = QuerySlotStates::kPageSize;
+    QuerySlotStates states;
+    // Ends of a partial page, a full page and the start of another partial page
+    const uint32_t first = kPageSize - 3;
+    const uint32_t count = 3 + kPageSize + 5;
+    states.SetRange(first, count, QUERYSTATE_RESET);
+
+    ASSERT_EQ(QUERYSTATE_UNKNOWN, states.Get(first - 1));
+    for (uint32_t slot = first; slot < first + count; ++slot) {
+        ASSERT_EQ(QUERYSTATE_RESET, states.Get(slot)) << slot;
+    }
+    ASSERT_EQ(QUERYSTATE_UNKNOWN, states.Get(first + count));
+
+    const auto all = GetStates(states);
+    ASSERT_EQ(count, all.size());
+    ASSERT_EQ(first, all.begin()->first);
+    ASSERT_EQ(first + count - 1, all.rbegin()->first);
+
+    // Overwrite a single slot in the middle of the full page
+    states.SetRange(kPageSize + 7, 1, QUERYSTATE_ENDED);
+    ASSERT_EQ(QUERYSTATE_ENDED, states.Get(kPageSize + 7));
+    ASSERT_EQ(QUERYSTATE_RESET, states.Get(kPageSize + 6));
+    ASSERT_EQ(QUERYSTATE_RESET, states.Get(kPageSize + 8));
+    ASSERT_EQ(count, GetStates(states).size());
+
+    states.Clear();
+    ASSERT_TRUE(states.Empty());
+    ASSERT_EQ(QUERYSTATE_UNKNOWN, states.Get(first));
+}
+
+TEST(QuerySlotStates, RangeAtEndOfSlots) {
+    QuerySlotStates states;
+    // Slots past UINT32_MAX are dropped instead of wrapping around to 0
+    states.SetRange(UINT32_MAX - 1, 4, QUERYSTATE_RESET);
+    ASSERT_EQ(QUERYSTATE_RESET, states.Get(UINT32_MAX - 1));
+    ASSERT_EQ(QUERYSTATE_RESET, states.Get(UINT32_MAX));
+    ASSERT_EQ(QUERYSTATE_UNKNOWN, states.Get(0));
+    ASSERT_EQ(QUERYSTATE_UNKNOWN, states.Get(1));
+    ASSERT_EQ(2u, GetStates(states).size());
+}
+
+TEST(QuerySlotStates, ForEachInRange) {
+    constexpr uint32_t kPageSize = QuerySlotStates::kPageSize;
+    QuerySlotStates states;
+    states.SetRange(2, 3, QUERYSTATE_RESET);
+    states.SetRange(2 * kPageSize, 2, QUERYSTATE_ENDED);
+
+    // Every slot of the range is visited in order, including the ones without a state and the pages which are not stored
+    std::vector<std::pair<uint32_t, QueryState>> visited;
+    states.ForEachInRange(1, 2 * kPageSize + 2, [&visited](uint32_t slot, QueryState state) {
+        visited.emplace_back(slot, state);
+        return true;
+    });
+    ASSERT_EQ(2 * kPageSize + 2, visited.size());
+    for (uint32_t i = 0; i < visited.size(); ++i) {
+        const uint32_t slot = 1 + i;
+        ASSERT_EQ(slot, visited[i].first);
+        ASSERT_EQ(states.Get(slot), visited[i].second) << slot;
+    }
+
+    // Stops once the callback returns false
+    uint32_t last_slot = 0;
+    states.ForEachInRange(0, 2 * kPageSize + 2, [&last_slot](uint32_t slot, QueryState state) {
+        last_slot = slot;
+        return state != QUERYSTATE_ENDED;
+    });
+    ASSERT_EQ(2 * kPageSize, last_slot);
+}
+
+TEST(QuerySlotStates, QueryMapForEachInRange) {
+    const VkQueryPool pool = CastFromUint64<VkQueryPool>(1);
+    const VkQueryPool other_pool = CastFromUint64<VkQueryPool>(2);
+    QueryMap map;
+    map.SetRange(pool, 4, 2, 0, QUERYSTATE_RESET);
+    map.SetRange(pool, 4, 2, 1, QUERYSTATE_ENDED);
+
+    std::vector<QueryState> visited;
+    const auto visit = [&visited](uint32_t, QueryState state) {
+        visited.push_back(state);
+        return true;
+    };
+    map.ForEachInRange(pool, 3, 4, 0, visit);
+    ASSERT_EQ((std::vector<QueryState>{QUERYSTATE_UNKNOWN, QUERYSTATE_RESET, QUERYSTATE_RESET, QUERYSTATE_UNKNOWN}), visited);
+
+    visited.clear();
+    map.ForEachInRange(pool, 4, 2, 1, visit);
+    ASSERT_EQ((std::vector<QueryState>{QUERYSTATE_ENDED, QUERYSTATE_ENDED}), visited);
+
+    // A pool without states still visits every slot
+    visited.clear();
+    map.ForEachInRange(other_pool, 0, 3, 0, visit);
+    ASSERT_EQ((std::vector<QueryState>{QUERYSTATE_UNKNOWN, QUERYSTATE_UNKNOWN, QUERYSTATE_UNKNOWN}), visited);
+}
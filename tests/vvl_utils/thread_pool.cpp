@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+
+#include <atomic>
+#include <vector>
+
+#include "utils/thread_pool.h"
+
+TEST(ThreadPool, Empty) { vvl::ThreadPool pool(4); }
+
+// The destructor runs the tasks still queued before joining
+TEST(ThreadPool, RunsAllTasks) {
+    std::atomic<uint32_t> count{0};
+    {
+        vvl::ThreadPool pool(4);
+        for (uint32_t i = 0; i < 1000; i++) {
+            pool.Submit([&count]() { count.fetch_add(1); });
+        }
+    }
+    ASSERT_EQ(1000u, count.load());
+}
+
+// With a single thread, tasks run in submission order
+TEST(ThreadPool, SubmissionOrder) {
+    std::vector<uint32_t> order;
+    {
+        vvl::ThreadPool pool(1);
+        for (uint32_t i = 0; i < 100; i++) {
+            pool.Submit([&order, i]() { order.push_back(i); });
+        }
+    }
+    ASSERT_EQ(100u, order.size());
+    for (uint32_t i = 0; i < 100; i++) {
+        ASSERT_EQ(i, order[i]);
+    }
+}
+
+TEST(ThreadPool, ParallelForCallsEachIndexOnce) {
+    vvl::ThreadPool pool(4);
+    for (uint32_t run = 0; run < 100; run++) {
+        std::vector<std::atomic<uint32_t>> calls(1000);
+        vvl::ParallelFor(&pool, 1000, 8, [&calls](uint32_t i) { calls[i].fetch_add(1); });
+        for (uint32_t i = 0; i < 1000; i++) {
+            ASSERT_EQ(1u, calls[i].load());
+        }
+    }
+}
+
+// Without a pool the indices are processed in order on the calling thread
+TEST(ThreadPool, ParallelForWithoutPool) {
+    std::vector<uint32_t> order;
+    vvl::ParallelFor(nullptr, 100, 8, [&order](uint32_t i) { order.push_back(i); });
+    ASSERT_EQ(100u, order.size());
+    for (uint32_t i = 0; i < 100; i++) {
+        ASSERT_EQ(i, order[i]);
+    }
+}